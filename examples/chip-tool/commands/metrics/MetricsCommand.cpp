@@ -0,0 +1,54 @@
+/*
+ *   Copyright (c) 2026 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "MetricsCommand.h"
+
+#include <TracingCommandLineArgument.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+using chip::CommandLineApp::TracingSetup;
+
+namespace {
+
+chip::Tracing::Histograms::MetricHistogramBackend * GetHistogramBackend()
+{
+    auto * backend = TracingSetup::HistogramBackend();
+    if (backend == nullptr)
+    {
+        ChipLogError(chipTool, "Metric histograms are not enabled. Start interactive mode with --trace-to histograms.");
+    }
+    return backend;
+}
+
+} // namespace
+
+CHIP_ERROR MetricsShowCommand::Run()
+{
+    auto * backend = GetHistogramBackend();
+    VerifyOrReturnError(backend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    TracingSetup::LogMetricHistograms(*backend);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MetricsResetCommand::Run()
+{
+    auto * backend = GetHistogramBackend();
+    VerifyOrReturnError(backend != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    backend->Reset();
+    return CHIP_NO_ERROR;
+}
@@ -17,6 +17,7 @@
  */
 #include <TracingCommandLineArgument.h>
 
+#include <lib/support/CHIPMemString.h>
 #include <lib/support/StringSplitter.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <tracing/json/json_tracing.h>
@@ -27,6 +28,10 @@
 #include <tracing/perfetto/simple_initialize.h> // nogncheck
 #endif
 
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+
 #include <memory>
 #include <string>
 
@@ -47,6 +52,23 @@ bool StartsWith(CharSpan argument, const char * prefix)
     return argument.data_equal(CharSpan(prefix, prefix_len));
 }
 
+// Ring buffer dumps requested by SIGUSR2. Dump() is async-signal-safe, so the handler dumps directly.
+const ::chip::Tracing::RingBuffer::RingBufferBackend * gRingBufferDumpBackend = nullptr;
+char gRingBufferDumpPath[PATH_MAX];
+
+void RingBufferDumpSignalHandler(int)
+{
+    // Dump() makes system calls, which must not change errno for the interrupted code.
+    int savedErrno = errno;
+    if (gRingBufferDumpBackend != nullptr)
+    {
+        (void) gRingBufferDumpBackend->Dump(gRingBufferDumpPath);
+    }
+    errno = savedErrno;
+}
+
+::chip::Tracing::Histograms::MetricHistogramBackend * gHistogramBackend = nullptr;
+
 } // namespace
 
 void TracingSetup::EnableTracingFor(const char * cliArg)
@@ -74,6 +96,38 @@ void TracingSetup::EnableTracingFor(const char * cliArg)
             }
             chip::Tracing::Register(mJsonBackend);
         }
+        else if (StartsWith(value, "ring:"))
+        {
+            std::string fileName(value.data() + 5, value.size() - 5);
+            if (mRingBufferEnabled || fileName.empty() || fileName.size() >= sizeof(gRingBufferDumpPath))
+            {
+                ChipLogError(AppServer, "Invalid ring buffer trace output: '%s'", fileName.c_str());
+                continue;
+            }
+
+            // Set the path before the handler can see the backend.
+            chip::Platform::CopyString(gRingBufferDumpPath, fileName.c_str());
+            gRingBufferDumpBackend = &mRingBufferBackend;
+
+            struct sigaction sa = {};
+            sa.sa_handler       = RingBufferDumpSignalHandler;
+            sa.sa_flags         = SA_RESTART;
+            sigemptyset(&sa.sa_mask);
+            sigaction(SIGUSR2, &sa, nullptr);
+
+            chip::Tracing::Register(mRingBufferBackend);
+            mRingBufferEnabled = true;
+            ChipLogProgress(AppServer, "Tracing to ring buffers; send SIGUSR2 to dump them to %s", gRingBufferDumpPath);
+        }
+        else if (value.data_equal("histograms"_span))
+        {
+            if (!mHistogramsEnabled)
+            {
+                chip::Tracing::Register(mHistogramBackend);
+                gHistogramBackend  = &mHistogramBackend;
+                mHistogramsEnabled = true;
+            }
+        }
 #if ENABLE_PERFETTO_TRACING
         else if (value.data_equal("perfetto"_span))
         {
@@ -113,6 +167,43 @@ void TracingSetup::StopTracing()
 #endif
 
     chip::Tracing::Unregister(mJsonBackend);
+
+    if (mRingBufferEnabled)
+    {
+        signal(SIGUSR2, SIG_DFL);
+        gRingBufferDumpBackend = nullptr;
+        chip::Tracing::Unregister(mRingBufferBackend);
+        CHIP_ERROR err = mRingBufferBackend.Dump(gRingBufferDumpPath);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(AppServer, "Failed to dump ring buffer traces: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+        mRingBufferEnabled = false;
+    }
+
+    if (mHistogramsEnabled)
+    {
+        chip::Tracing::Unregister(mHistogramBackend);
+        gHistogramBackend = nullptr;
+        LogMetricHistograms(mHistogramBackend);
+        mHistogramsEnabled = false;
+    }
+}
+
+::chip::Tracing::Histograms::MetricHistogramBackend * TracingSetup::HistogramBackend()
+{
+    return gHistogramBackend;
+}
+
+void TracingSetup::LogMetricHistograms(::chip::Tracing::Histograms::MetricHistogramBackend & backend)
+{
+    backend.ForEachSummary([](const ::chip::Tracing::Histograms::MetricSummary & summary) {
+        ChipLogProgress(AppServer, "%s: count=%u errors=%u min=%u p50=%u p90=%u p99=%u max=%u%s", summary.key,
+                        static_cast<unsigned>(summary.count), static_cast<unsigned>(summary.errors),
+                        static_cast<unsigned>(summary.min), static_cast<unsigned>(summary.p50),
+                        static_cast<unsigned>(summary.p90), static_cast<unsigned>(summary.p99),
+                        static_cast<unsigned>(summary.max), summary.isDuration ? " (us)" : "");
+    });
 }
 
 } // namespace CommandLineApp
@@ -19,7 +19,9 @@
 
 #include "tracing/enabled_features.h"
 
+#include <tracing/histograms/histogram_tracing.h>
 #include <tracing/json/json_tracing.h>
+#include <tracing/ring_buffer/ring_buffer_tracing.h>
 
 #if ENABLE_PERFETTO_TRACING
 #include <tracing/perfetto/file_output.h>      // nogncheck
@@ -29,9 +31,9 @@
 /// A string with supported command line tracing targets
 /// to be pretty-printed in help strings if needed
 #if ENABLE_PERFETTO_TRACING
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, perfetto, perfetto:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, ring:<path>, histograms, perfetto, perfetto:<path>"
 #else
-#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>"
+#define SUPPORTED_COMMAND_LINE_TRACING_TARGETS "json:log, json:<path>, ring:<path>, histograms"
 #endif
 
 namespace chip {
@@ -48,6 +50,12 @@ public:
     ///
     /// Single arguments as well as comma separated ones are accepted.
     ///
+    /// "ring:<path>" records traces into in-memory ring buffers, written to
+    /// <path> whenever the process receives SIGUSR2 and when tracing stops.
+    ///
+    /// "histograms" aggregates metric events into per-metric latency histograms,
+    /// logged when tracing stops and available through HistogramBackend().
+    ///
     /// Calling this method multiple times is ok and will enable each of
     /// the given tracing modules if not already enabled.
     void EnableTracingFor(const char * cliArg);
@@ -56,8 +64,19 @@ public:
     /// to unregister tracing backends
     void StopTracing();
 
+    /// The backend of the "histograms" target, or nullptr if no TracingSetup
+    /// has that target enabled.
+    static ::chip::Tracing::Histograms::MetricHistogramBackend * HistogramBackend();
+
+    /// Logs the statistics of every metric aggregated by `backend`.
+    static void LogMetricHistograms(::chip::Tracing::Histograms::MetricHistogramBackend & backend);
+
 private:
     ::chip::Tracing::Json::JsonBackend mJsonBackend;
+    ::chip::Tracing::RingBuffer::RingBufferBackend mRingBufferBackend;
+    bool mRingBufferEnabled = false;
+    ::chip::Tracing::Histograms::MetricHistogramBackend mHistogramBackend;
+    bool mHistogramsEnabled = false;
 
 #if ENABLE_PERFETTO_TRACING
     chip::Tracing::Perfetto::FileTraceOutput mPerfettoFileOutput;
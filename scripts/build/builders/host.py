@@ -623,6 +623,13 @@ class HostBuilder(GnBuilder):
 
         if app == HostApp.TESTS:
             self.extra_gn_options.append('chip_build_tests=true')
+            # Exercise concurrent CASE handshakes in unit tests
+            self.extra_gn_options.append('chip_config_case_server_max_concurrent_handshakes=4')
+            # Exercise the wildcard path expansion cache of ReadHandler in unit tests
+            self.extra_gn_options.append('chip_im_server_max_num_cached_expanded_paths=2048')
+            if board.PlatformName() == 'linux':
+                # Build SessionCryptoWorkerPool so that its unit tests run
+                self.extra_gn_options.append('chip_config_session_crypto_offload=true')
             self.build_command = 'check'
 
         if app == HostApp.EFR32_TEST_RUNNER:
@@ -28,6 +28,8 @@
 
 #include <credentials/GroupDataProvider.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Access {
 
@@ -225,6 +227,7 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+        InvalidateCheckCache();
     }
 
     return retval;
@@ -234,6 +237,7 @@ void AccessControl::Finish()
 {
     VerifyOrReturn(IsInitialized());
     ChipLogProgress(DataManagement, "AccessControl: finishing");
+    InvalidateCheckCache();
     mDelegate->Finish();
     mDelegate = nullptr;
 
@@ -259,6 +263,7 @@ CHIP_ERROR AccessControl::CreateEntry(const SubjectDescriptor * subjectDescripto
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
 
     size_t i = 0;
+    InvalidateCheckCache();
     ReturnErrorOnFailure(mDelegate->CreateEntry(&i, entry, &fabric));
 
     if (index)
@@ -275,6 +280,7 @@ CHIP_ERROR AccessControl::UpdateEntry(const SubjectDescriptor * subjectDescripto
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
+    InvalidateCheckCache();
     ReturnErrorOnFailure(mDelegate->UpdateEntry(index, entry, &fabric));
     NotifyEntryChanged(subjectDescriptor, fabric, index, &entry, EntryListener::ChangeType::kUpdated);
     return CHIP_NO_ERROR;
@@ -289,6 +295,7 @@ CHIP_ERROR AccessControl::DeleteEntry(const SubjectDescriptor * subjectDescripto
     {
         p = &entry;
     }
+    InvalidateCheckCache();
     ReturnErrorOnFailure(mDelegate->DeleteEntry(index, &fabric));
     if (p && p->HasDefaultDelegate())
     {
@@ -439,6 +446,25 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+    {
+        CHIP_ERROR result = CheckCompiledACL(subjectDescriptor, requestPath, requestPrivilege);
+        if (result == CHIP_NO_ERROR)
+        {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return result;
+        }
+        if (result == CHIP_ERROR_ACCESS_DENIED)
+        {
+            ChipLogProgress(DataManagement, "AccessControl: denied");
+            return result;
+        }
+        // Otherwise the entries could not be compiled, so check them one by one below.
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -553,6 +579,214 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
     return CHIP_ERROR_ACCESS_DENIED;
 }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+CHIP_ERROR AccessControl::CheckCompiledACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                           Privilege requestPrivilege)
+{
+    if (mCompileState == CompileState::kStale)
+    {
+        CHIP_ERROR err = CompileEntries();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogDetail(DataManagement, "AccessControl: not compiling entries: %" CHIP_ERROR_FORMAT, err.Format());
+            mCompiledEntries.Free();
+            mCompiledSubjects.Free();
+            mCompiledTargets.Free();
+            mCompileState = CompileState::kUncompilable;
+        }
+    }
+    VerifyOrReturnError(mCompileState == CompileState::kCompiled, CHIP_ERROR_NOT_IMPLEMENTED);
+
+    uint64_t hash = subjectDescriptor.subject ^ (static_cast<uint64_t>(requestPath.cluster) << 16) ^ requestPath.endpoint ^
+        (static_cast<uint64_t>(subjectDescriptor.fabricIndex) << 56) ^
+        (static_cast<uint64_t>(to_underlying(requestPrivilege)) << 48);
+    CachedCheck & cached =
+        mCheckCache[static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> 32) & (CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE - 1)];
+    if (cached.inUse && cached.subject == subjectDescriptor.subject && cached.cluster == requestPath.cluster &&
+        cached.endpoint == requestPath.endpoint && cached.fabricIndex == subjectDescriptor.fabricIndex &&
+        cached.authMode == subjectDescriptor.authMode && cached.privilege == requestPrivilege &&
+        cached.cats.values == subjectDescriptor.cats.values)
+    {
+        return cached.allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+    }
+
+    // Device type targets depend on the endpoint composition, which may change without notice,
+    // so results that depended on them are not cached.
+    bool dependsOnDeviceType = false;
+    bool allowed             = false;
+
+    const CompiledEntry * entries    = mCompiledEntries.Get();
+    const CompiledEntry * entriesEnd = entries + mCompiledEntries.AllocatedSize();
+    const CompiledEntry * begin      = std::lower_bound(entries, entriesEnd, subjectDescriptor.fabricIndex,
+                                                        [](const CompiledEntry & e, FabricIndex f) { return e.fabricIndex < f; });
+    for (const CompiledEntry * entry = begin;
+         !allowed && entry != entriesEnd && entry->fabricIndex == subjectDescriptor.fabricIndex; ++entry)
+    {
+        if (entry->authMode != subjectDescriptor.authMode ||
+            !CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, entry->privilege))
+        {
+            continue;
+        }
+
+        bool subjectMatched = (entry->subjectCount == 0);
+        for (size_t i = entry->firstSubject; !subjectMatched && i < entry->firstSubject + entry->subjectCount; ++i)
+        {
+            // CompileEntries() ensured that the kind of each subject matches the auth mode.
+            NodeId subject = mCompiledSubjects[i];
+            subjectMatched = IsCASEAuthTag(subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subject)
+                                                    : (subject == subjectDescriptor.subject);
+        }
+        if (!subjectMatched)
+        {
+            continue;
+        }
+
+        bool targetMatched = (entry->targetCount == 0);
+        for (size_t i = entry->firstTarget; !targetMatched && i < entry->firstTarget + entry->targetCount; ++i)
+        {
+            const Entry::Target & target = mCompiledTargets[i];
+            if ((target.flags & Entry::Target::kCluster) && target.cluster != requestPath.cluster)
+            {
+                continue;
+            }
+            if ((target.flags & Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+            {
+                continue;
+            }
+            if (target.flags & Entry::Target::kDeviceType)
+            {
+                dependsOnDeviceType = true;
+                if (!mDeviceTypeResolver->IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+                {
+                    continue;
+                }
+            }
+            targetMatched = true;
+        }
+        allowed = targetMatched;
+    }
+
+    if (!dependsOnDeviceType)
+    {
+        cached.subject     = subjectDescriptor.subject;
+        cached.cats        = subjectDescriptor.cats;
+        cached.cluster     = requestPath.cluster;
+        cached.endpoint    = requestPath.endpoint;
+        cached.fabricIndex = subjectDescriptor.fabricIndex;
+        cached.authMode    = subjectDescriptor.authMode;
+        cached.privilege   = requestPrivilege;
+        cached.inUse       = true;
+        cached.allowed     = allowed;
+    }
+
+    return allowed ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+}
+
+CHIP_ERROR AccessControl::CompileEntries()
+{
+    // First pass: size the compiled arrays.
+    size_t entryCount   = 0;
+    size_t subjectCount = 0;
+    size_t targetCount  = 0;
+    {
+        EntryIterator iterator;
+        ReturnErrorOnFailure(Entries(iterator));
+
+        Entry entry;
+        while (iterator.Next(entry) == CHIP_NO_ERROR)
+        {
+            size_t count = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(count));
+            subjectCount += count;
+            ReturnErrorOnFailure(entry.GetTargetCount(count));
+            targetCount += count;
+            entryCount++;
+        }
+    }
+    VerifyOrReturnError(subjectCount <= UINT16_MAX && targetCount <= UINT16_MAX, CHIP_ERROR_NO_MEMORY);
+
+    mCompiledEntries.Free();
+    mCompiledSubjects.Free();
+    mCompiledTargets.Free();
+    VerifyOrReturnError(entryCount == 0 || mCompiledEntries.Alloc(entryCount), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(subjectCount == 0 || mCompiledSubjects.Alloc(subjectCount), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(targetCount == 0 || mCompiledTargets.Alloc(targetCount), CHIP_ERROR_NO_MEMORY);
+
+    // Second pass: copy and validate the entries, rejecting any that CheckACL() would fail on.
+    size_t entryIndex   = 0;
+    size_t subjectIndex = 0;
+    size_t targetIndex  = 0;
+    EntryIterator iterator;
+    ReturnErrorOnFailure(Entries(iterator));
+
+    Entry entry;
+    while (iterator.Next(entry) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(entryIndex < entryCount, CHIP_ERROR_INCORRECT_STATE);
+        CompiledEntry compiled;
+        ReturnErrorOnFailure(entry.GetFabricIndex(compiled.fabricIndex));
+        ReturnErrorOnFailure(entry.GetAuthMode(compiled.authMode));
+        VerifyOrReturnError(compiled.authMode == AuthMode::kCase || compiled.authMode == AuthMode::kGroup,
+                            CHIP_ERROR_INCORRECT_STATE);
+        ReturnErrorOnFailure(entry.GetPrivilege(compiled.privilege));
+
+        size_t count = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(count));
+        VerifyOrReturnError(count <= subjectCount - subjectIndex, CHIP_ERROR_INCORRECT_STATE);
+        compiled.firstSubject = static_cast<uint16_t>(subjectIndex);
+        compiled.subjectCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            NodeId subject = kUndefinedNodeId;
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+            {
+                VerifyOrReturnError(compiled.authMode == AuthMode::kCase, CHIP_ERROR_INCORRECT_STATE);
+            }
+            else
+            {
+                VerifyOrReturnError(IsGroupId(subject) && compiled.authMode == AuthMode::kGroup, CHIP_ERROR_INCORRECT_STATE);
+            }
+            mCompiledSubjects[subjectIndex++] = subject;
+        }
+
+        ReturnErrorOnFailure(entry.GetTargetCount(count));
+        VerifyOrReturnError(count <= targetCount - targetIndex, CHIP_ERROR_INCORRECT_STATE);
+        compiled.firstTarget = static_cast<uint16_t>(targetIndex);
+        compiled.targetCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            ReturnErrorOnFailure(entry.GetTarget(i, mCompiledTargets[targetIndex++]));
+        }
+
+        // Insertion sort by fabric index, keeping the delegate's order within a fabric.
+        size_t position = entryIndex++;
+        while (position > 0 && mCompiledEntries[position - 1].fabricIndex > compiled.fabricIndex)
+        {
+            mCompiledEntries[position] = mCompiledEntries[position - 1];
+            position--;
+        }
+        mCompiledEntries[position] = compiled;
+    }
+    VerifyOrReturnError(entryIndex == entryCount, CHIP_ERROR_INCORRECT_STATE);
+
+    mCompileState = CompileState::kCompiled;
+    return CHIP_NO_ERROR;
+}
+
+void AccessControl::InvalidateCheckCache()
+{
+    mCompiledEntries.Free();
+    mCompiledSubjects.Free();
+    mCompiledTargets.Free();
+    mCompileState = CompileState::kStale;
+    for (auto & cached : mCheckCache)
+    {
+        cached.inUse = false;
+    }
+}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 CHIP_ERROR AccessControl::CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
                                    Privilege requestPrivilege)
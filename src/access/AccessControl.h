@@ -32,6 +32,7 @@
 #include <lib/core/CHIPCore.h>
 #include <lib/core/Global.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 
 // Dump function for use during development only (0 for disabled, non-zero for enabled).
 #define CHIP_ACCESS_CONTROL_DUMP_ENABLED 0
@@ -525,6 +526,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCheckCache();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -575,6 +577,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCheckCache();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -596,6 +599,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateCheckCache();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -754,6 +758,27 @@ private:
      */
     CHIP_ERROR CheckARL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
 
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+    /**
+     * Check the compiled entries (compiling them first if needed) for whether access
+     * should be allowed or denied, using and updating the check cache.
+     *
+     * @retval #CHIP_NO_ERROR if allowed.
+     * @retval #CHIP_ERROR_ACCESS_DENIED if denied.
+     * @retval #CHIP_ERROR_NOT_IMPLEMENTED if the entries cannot be compiled, in which
+     *         case the caller must check the entries through the delegate.
+     */
+    CHIP_ERROR CheckCompiledACL(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                Privilege requestPrivilege);
+
+    CHIP_ERROR CompileEntries();
+
+    // Drops the compiled entries and cached results. Must be called before any entry changes.
+    void InvalidateCheckCache();
+#else
+    void InvalidateCheckCache() {}
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+
 private:
     Delegate * mDelegate = nullptr;
 
@@ -773,6 +798,51 @@ private:
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
+
+#if CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+    static_assert((CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE & (CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE - 1)) == 0,
+                  "CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE must be a power of two");
+
+    enum class CompileState : uint8_t
+    {
+        kStale,        // Entries changed since they were last compiled.
+        kCompiled,     // mCompiledEntries reflects the current entries.
+        kUncompilable, // Some entry cannot be compiled; check the entries through the delegate.
+    };
+
+    // An entry with its subjects and targets stored in mCompiledSubjects and mCompiledTargets.
+    struct CompiledEntry
+    {
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        uint16_t firstSubject;
+        uint16_t subjectCount;
+        uint16_t firstTarget;
+        uint16_t targetCount;
+    };
+
+    struct CachedCheck
+    {
+        NodeId subject;
+        CATValues cats;
+        ClusterId cluster;
+        EndpointId endpoint;
+        FabricIndex fabricIndex;
+        AuthMode authMode;
+        Privilege privilege;
+        bool inUse;
+        bool allowed;
+    };
+
+    // Compiled entries, sorted by fabric index and otherwise in delegate iteration order.
+    Platform::ScopedMemoryBufferWithSize<CompiledEntry> mCompiledEntries;
+    Platform::ScopedMemoryBufferWithSize<NodeId> mCompiledSubjects;
+    Platform::ScopedMemoryBufferWithSize<Entry::Target> mCompiledTargets;
+    CompileState mCompileState = CompileState::kStale;
+
+    CachedCheck mCheckCache[CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE] = {};
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
 };
 
 /**
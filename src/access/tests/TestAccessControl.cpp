@@ -37,6 +37,8 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
+#include <chrono>
+
 namespace {
 
 constexpr uint16_t kMaxGroupsPerFabric    = 5;
@@ -448,7 +450,9 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return deviceTypeOnEndpoint; }
+
+    bool deviceTypeOnEndpoint = false;
 } testDeviceTypeResolver;
 
 // For testing, supports one subject and target, allows any value (valid or invalid)
@@ -1990,6 +1994,135 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckAfterEntryChanges)
+{
+    // Repeated checks must observe entry changes made through either the notifying or non-notifying methods.
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId3 };
+    const RequestPath requestPath             = { .cluster = kAccessControlCluster, .endpoint = 0 };
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    // Entry 0 is the only one granting administer to kOperationalNodeId3 on fabric 1.
+    EntryData updateData   = entryData1[0];
+    updateData.subjects[0] = kOperationalNodeId4;
+    {
+        Entry entry;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, updateData), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.UpdateEntry(0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+
+    {
+        Entry entry;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, entryData1[0]), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.UpdateEntry(nullptr, 1, 0, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    EXPECT_EQ(accessControl.DeleteEntry(nullptr, 1, 0), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+
+    {
+        Entry entry;
+        EXPECT_EQ(accessControl.PrepareEntry(entry), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadEntry(entry, entryData1[0]), CHIP_NO_ERROR);
+        EXPECT_EQ(accessControl.CreateEntry(nullptr, entry), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_NO_ERROR);
+
+    size_t count = 0;
+    EXPECT_EQ(accessControl.GetEntryCount(count), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.DeleteEntry(count - 1), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kAdminister), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckDeviceTypeTarget)
+{
+    // Device type membership can change without any entry change, so it must be re-evaluated on every check.
+    EntryData entryData = {
+        .fabricIndex = 1,
+        .privilege   = Privilege::kOperate,
+        .authMode    = AuthMode::kCase,
+        .subjects    = { kOperationalNodeId1 },
+        .targets     = { { .flags = Target::kDeviceType, .deviceType = validDeviceTypes[0] } },
+    };
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &entryData, 1));
+
+    const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    const RequestPath requestPath             = { .cluster = kOnOffCluster, .endpoint = 1 };
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    testDeviceTypeResolver.deviceTypeOnEndpoint = true;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    testDeviceTypeResolver.deviceTypeOnEndpoint = false;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckPerformance)
+{
+    // Time the checks of a wildcard read (every cluster of every endpoint) against growing numbers of
+    // entries with full subject and target lists, where only the last entry grants access.
+    constexpr EndpointId kEndpoints = 20;
+    constexpr ClusterId kClusters   = 30;
+    constexpr int kReads            = 20;
+
+    size_t maxEntries = 0;
+    EXPECT_EQ(accessControl.GetMaxEntriesPerFabric(maxEntries), CHIP_NO_ERROR);
+
+    for (size_t entryCount = 1; entryCount <= maxEntries; ++entryCount)
+    {
+        EXPECT_EQ(ClearAccessControl(accessControl), CHIP_NO_ERROR);
+        for (size_t i = 0; i + 1 < entryCount; ++i)
+        {
+            EntryData entry = {
+                .fabricIndex = 1,
+                .privilege   = Privilege::kView,
+                .authMode    = AuthMode::kCase,
+                .subjects    = { kOperationalNodeId0, kCASEAuthTagAsNodeId0, kOperationalNodeId2 },
+                .targets     = { { .flags = Target::kEndpoint, .endpoint = 0 },
+                                 { .flags = Target::kCluster, .cluster = kColorControlCluster + 1 },
+                                 { .flags = Target::kCluster | Target::kEndpoint, .cluster = kOnOffCluster, .endpoint = 0 } },
+            };
+            EXPECT_EQ(LoadAccessControl(accessControl, &entry, 1), CHIP_NO_ERROR);
+        }
+        EntryData lastEntry = {
+            .fabricIndex = 1,
+            .privilege   = Privilege::kView,
+            .authMode    = AuthMode::kCase,
+            .subjects    = { kOperationalNodeId0, kCASEAuthTagAsNodeId0, kOperationalNodeId1 },
+        };
+        EXPECT_EQ(LoadAccessControl(accessControl, &lastEntry, 1), CHIP_NO_ERROR);
+
+        const SubjectDescriptor subjectDescriptor = { .fabricIndex = 1,
+                                                      .authMode    = AuthMode::kCase,
+                                                      .subject     = kOperationalNodeId1,
+                                                      .cats        = { { kCASEAuthTag4 } } };
+        size_t allowed                            = 0;
+        auto start                                = std::chrono::steady_clock::now();
+        for (int read = 0; read < kReads; ++read)
+        {
+            for (EndpointId endpoint = 1; endpoint <= kEndpoints; ++endpoint)
+            {
+                for (ClusterId cluster = 1; cluster <= kClusters; ++cluster)
+                {
+                    RequestPath requestPath = { .cluster = cluster, .endpoint = endpoint };
+                    allowed += (accessControl.Check(subjectDescriptor, requestPath, Privilege::kView) == CHIP_NO_ERROR);
+                }
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        EXPECT_EQ(allowed, static_cast<size_t>(kReads * kEndpoints * kClusters));
+        ChipLogProgress(Test, "Check with %u entries: %u ns per check", static_cast<unsigned>(entryCount),
+                        static_cast<unsigned>(elapsed.count() / (kReads * kEndpoints * kClusters)));
+    }
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
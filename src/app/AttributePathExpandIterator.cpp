@@ -23,6 +23,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/ReadOnlyBuffer.h>
 
+#include <algorithm>
 #include <optional>
 
 using namespace chip::app::DataModel;
@@ -30,8 +31,14 @@ using namespace chip::app::DataModel;
 namespace chip {
 namespace app {
 
-AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position) :
-    mDataModelProvider(dataModel), mPosition(position)
+AttributePathExpandIterator::AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position,
+                                                         AttributePathExpansionCache * cache) :
+    mDataModelProvider(dataModel),
+    mPosition(position)
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+    ,
+    mCache(cache)
+#endif
 {}
 
 bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::AttributeEntry> * entry)
@@ -95,6 +102,20 @@ bool AttributePathExpandIterator::AdvanceOutputPath(std::optional<DataModel::Att
 
 bool AttributePathExpandIterator::Next(ConcreteAttributePath & path, std::optional<DataModel::AttributeEntry> * entry)
 {
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+    // The cache does not hold attribute entries, so it can only be used if the caller does not need them.
+    if ((mCache != nullptr) && (entry == nullptr) && mCache->Prepare(mDataModelProvider, mPosition.mAttributePathList))
+    {
+        std::optional<size_t> next = mCache->FindNext(mPosition);
+        if (next.has_value())
+        {
+            return NextFromCache(*next, path);
+        }
+        // The position does not come from the current expansion (e.g. its cluster went away): let the
+        // data model decide where to go from there.
+    }
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
     while (mPosition.mAttributePath != nullptr)
     {
         if (AdvanceOutputPath(entry))
@@ -109,6 +130,28 @@ bool AttributePathExpandIterator::Next(ConcreteAttributePath & path, std::option
     return false;
 }
 
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+bool AttributePathExpandIterator::NextFromCache(size_t index, ConcreteAttributePath & path)
+{
+    if (index >= mCache->mEntryCount)
+    {
+        mPosition.mAttributePath = nullptr;
+        mPosition.mOutputPath    = ConcreteReadAttributePath(kInvalidEndpointId, kInvalidClusterId, kInvalidAttributeId);
+        mPosition.mCacheIndex    = kInvalidIndex;
+        return false;
+    }
+
+    const AttributePathExpansionCache::Entry & cached = mCache->mEntries[index];
+    mPosition.mAttributePath                          = mCache->mPaths[cached.pathIndex];
+    mPosition.mOutputPath           = ConcreteAttributePath(cached.endpointId, cached.clusterId, cached.attributeId);
+    mPosition.mOutputPath.mExpanded = mPosition.mAttributePath->mValue.IsWildcardPath();
+    mPosition.mCacheIndex           = index;
+
+    path = mPosition.mOutputPath;
+    return true;
+}
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
 std::optional<AttributeId> AttributePathExpandIterator::NextAttribute(std::optional<DataModel::AttributeEntry> * entry)
 {
     if (mPosition.mOutputPath.mAttributeId == kInvalidAttributeId)
@@ -310,5 +353,165 @@ std::optional<EndpointId> AttributePathExpandIterator::NextEndpointId()
     return mEndpoints[mEndpointIndex].id;
 }
 
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+void AttributePathExpansionCache::Invalidate()
+{
+    mEntries.Free();
+    mPaths.Free();
+    mFirstEntry.Free();
+    mEntryCount = 0;
+    mPathCount  = 0;
+    mProvider   = nullptr;
+    mPathList   = nullptr;
+    mState      = State::kEmpty;
+}
+
+bool AttributePathExpansionCache::Prepare(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * paths)
+{
+    if ((mState != State::kEmpty) && (mProvider == provider) && (mPathList == paths) &&
+        (mGeneration == provider->GetMetadataStructureGeneration()))
+    {
+        return mState == State::kFilled;
+    }
+
+    Invalidate();
+    mProvider   = provider;
+    mPathList   = paths;
+    mGeneration = provider->GetMetadataStructureGeneration();
+    mState      = State::kUnusable;
+
+    if (!Fill(provider, paths))
+    {
+        // Remember that this expansion does not fit until the structure changes, rather than trying again for every report.
+        mEntries.Free();
+        mPaths.Free();
+        mFirstEntry.Free();
+        mEntryCount = 0;
+        mPathCount  = 0;
+        return false;
+    }
+
+    mState = State::kFilled;
+    return true;
+}
+
+bool AttributePathExpansionCache::Fill(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * paths)
+{
+    size_t pathCount = 0;
+    for (auto * node = paths; node != nullptr; node = node->mpNext)
+    {
+        pathCount++;
+    }
+    VerifyOrReturnValue(pathCount <= std::numeric_limits<uint16_t>::max(), false);
+    VerifyOrReturnValue(pathCount == 0 || mPaths.Calloc(pathCount), false);
+    VerifyOrReturnValue(mFirstEntry.Calloc(pathCount + 1), false);
+
+    size_t pathIndex = 0;
+    for (auto * node = paths; node != nullptr; node = node->mpNext)
+    {
+        mPaths[pathIndex++] = node;
+    }
+
+    // Expand once into a buffer that grows as needed, giving up as soon as the expansion does not fit.
+    size_t capacity   = 0;
+    size_t entryCount = 0;
+    pathIndex         = 0;
+
+    ConcreteAttributePath path;
+    auto position = AttributePathExpandIterator::Position::StartIterating(paths);
+    for (AttributePathExpandIterator iterator(provider, position); iterator.Next(path);)
+    {
+        if (entryCount == capacity)
+        {
+            VerifyOrReturnValue(capacity < kMaxPaths, false);
+            capacity = std::min(std::max(capacity * 2, kInitialCapacity), kMaxPaths);
+            VerifyOrReturnValue(Resize(entryCount, capacity), false);
+        }
+        while ((pathIndex < pathCount) && (mPaths[pathIndex] != position.mAttributePath))
+        {
+            mFirstEntry[++pathIndex] = entryCount;
+        }
+        VerifyOrReturnValue(pathIndex < pathCount, false);
+        mEntries[entryCount++] = { path.mClusterId, path.mAttributeId, path.mEndpointId, static_cast<uint16_t>(pathIndex) };
+    }
+
+    while (pathIndex < pathCount)
+    {
+        mFirstEntry[++pathIndex] = entryCount;
+    }
+
+    // Do not hold on to the unused part of the buffer for the lifetime of the subscription.
+    VerifyOrReturnValue(entryCount == capacity || Resize(entryCount, entryCount), false);
+
+    mEntryCount = entryCount;
+    mPathCount  = pathCount;
+    return true;
+}
+
+bool AttributePathExpansionCache::Resize(size_t entryCount, size_t capacity)
+{
+    Platform::ScopedMemoryBuffer<Entry> entries;
+    if (capacity > 0)
+    {
+        VerifyOrReturnValue(entries.Alloc(capacity), false);
+        std::copy(mEntries.Get(), mEntries.Get() + entryCount, entries.Get());
+    }
+    mEntries = std::move(entries);
+    return true;
+}
+
+bool AttributePathExpansionCache::IsAt(size_t index, const AttributePathExpandIterator::Position & position) const
+{
+    const Entry & entry = mEntries[index];
+    return (mPaths[entry.pathIndex] == position.mAttributePath) && (entry.endpointId == position.mOutputPath.mEndpointId) &&
+        (entry.clusterId == position.mOutputPath.mClusterId) && (entry.attributeId == position.mOutputPath.mAttributeId);
+}
+
+std::optional<size_t> AttributePathExpansionCache::FindNext(const AttributePathExpandIterator::Position & position) const
+{
+    VerifyOrReturnValue(position.mAttributePath != nullptr, mEntryCount);
+
+    // Positions usually come from the previous call, which left a hint of where they are.
+    if ((position.mCacheIndex < mEntryCount) && IsAt(position.mCacheIndex, position))
+    {
+        return position.mCacheIndex + 1;
+    }
+
+    size_t pathIndex = 0;
+    while ((pathIndex < mPathCount) && (mPaths[pathIndex] != position.mAttributePath))
+    {
+        pathIndex++;
+    }
+    VerifyOrReturnValue(pathIndex < mPathCount, std::nullopt);
+
+    const ConcreteAttributePath & outputPath = position.mOutputPath;
+    if (outputPath.mEndpointId == kInvalidEndpointId)
+    {
+        // Starting on this path; if it expands to nothing, this is where the next paths start.
+        return mFirstEntry[pathIndex];
+    }
+
+    for (size_t index = mFirstEntry[pathIndex]; index < mFirstEntry[pathIndex + 1]; index++)
+    {
+        const Entry & entry = mEntries[index];
+        if ((entry.endpointId != outputPath.mEndpointId) || (entry.clusterId != outputPath.mClusterId))
+        {
+            continue;
+        }
+        if (outputPath.mAttributeId == kInvalidAttributeId)
+        {
+            // Iteration was reset to the start of this cluster.
+            return index;
+        }
+        if (entry.attributeId == outputPath.mAttributeId)
+        {
+            return index + 1;
+        }
+    }
+
+    return std::nullopt;
+}
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
 } // namespace app
 } // namespace chip
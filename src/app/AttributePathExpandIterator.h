@@ -24,6 +24,7 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/LinkedList.h>
 #include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/Span.h>
 
 #include <limits>
@@ -31,6 +32,8 @@
 namespace chip {
 namespace app {
 
+class AttributePathExpansionCache;
+
 /// Handles attribute path expansions
 /// Usage:
 ///
@@ -71,6 +74,7 @@ public:
         // for external code. We allow friendship here to not have specific get/set for methods (clearer interface and less
         // likelihood of extra code usage).
         friend class AttributePathExpandIterator;
+        friend class AttributePathExpansionCache;
 
         /// External callers can only ever start iterating on a new path from the beginning
         static Position StartIterating(SingleLinkedListNode<AttributePathParams> * path) { return Position(path); }
@@ -95,13 +99,28 @@ public:
     protected:
         Position(SingleLinkedListNode<AttributePathParams> * path) :
             mAttributePath(path), mOutputPath(kInvalidEndpointId, kInvalidClusterId, kInvalidAttributeId)
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+            ,
+            mAttributePathList(path)
+#endif
         {}
 
         SingleLinkedListNode<AttributePathParams> * mAttributePath;
         ConcreteAttributePath mOutputPath;
+
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+        // Head of the path list being iterated, which identifies the expansion to use from an AttributePathExpansionCache,
+        // and a hint of where mOutputPath is located in that expansion.
+        SingleLinkedListNode<AttributePathParams> * mAttributePathList = nullptr;
+        size_t mCacheIndex                                             = std::numeric_limits<size_t>::max();
+#endif
     };
 
-    AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position);
+    /// `cache` is optional. When provided, paths are served from the expansion it holds for the
+    /// path list of `position`, which it fills on first use and refills whenever the metadata
+    /// structure generation of `dataModel` changes.
+    AttributePathExpandIterator(DataModel::Provider * dataModel, Position & position,
+                                AttributePathExpansionCache * cache = nullptr);
 
     // This class may not be copied. A new one should be created when needed and they
     // should not overlap.
@@ -136,6 +155,13 @@ private:
 
     DataModel::Provider * mDataModelProvider;
     Position & mPosition;
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+    AttributePathExpansionCache * mCache;
+
+    /// Moves the position to the cache entry at `index` (the end of the iteration if there is
+    /// no such entry) and outputs its path.
+    bool NextFromCache(size_t index, ConcreteAttributePath & path);
+#endif
 
     ReadOnlyBuffer<DataModel::EndpointEntry> mEndpoints; // all endpoints
     size_t mEndpointIndex = kInvalidIndex;
@@ -171,6 +197,84 @@ private:
     std::optional<EndpointId> NextEndpointId();
 };
 
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+/// Remembers the concrete paths that a list of attribute paths expands to, so that iterating over
+/// the list again does not need to go through the endpoint, cluster and attribute metadata of the
+/// data model provider.
+///
+/// The expansion is computed the first time an AttributePathExpandIterator uses the cache and
+/// remains valid for as long as the provider, the head of the path list and the metadata structure
+/// generation of the provider stay the same. Call Invalidate() if the path list is modified in place.
+///
+/// Path lists that expand to more than CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS paths are not
+/// cached: iterators then go through the data model as if no cache was provided.
+class AttributePathExpansionCache
+{
+public:
+    static constexpr size_t kMaxPaths = CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS;
+
+    AttributePathExpansionCache() = default;
+
+    AttributePathExpansionCache(const AttributePathExpansionCache &)             = delete;
+    AttributePathExpansionCache & operator=(const AttributePathExpansionCache &) = delete;
+
+    /// Forgets the cached expansion, releasing its memory.
+    void Invalidate();
+
+    /// Number of concrete paths in the cached expansion.
+    size_t Size() const { return mEntryCount; }
+
+private:
+    friend class AttributePathExpandIterator;
+
+    struct Entry
+    {
+        ClusterId clusterId;
+        AttributeId attributeId;
+        EndpointId endpointId;
+        uint16_t pathIndex; // index in mPaths of the path this entry was expanded from
+    };
+
+    enum class State : uint8_t
+    {
+        kEmpty,
+        kFilled,
+        kUnusable, // the expansion did not fit
+    };
+
+    static constexpr size_t kInitialCapacity = 64;
+
+    /// Makes sure that the cache holds the expansion of `paths` for the current structure of `provider`.
+    ///
+    /// Returns false if the expansion cannot be cached.
+    bool Prepare(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * paths);
+
+    bool Fill(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * paths);
+
+    /// Moves the first `entryCount` entries into a new buffer of `capacity` entries.
+    bool Resize(size_t entryCount, size_t capacity);
+
+    /// Returns the index of the entry that follows `position` in the expansion (Size() at the end),
+    /// or std::nullopt if `position` cannot be located in the expansion.
+    std::optional<size_t> FindNext(const AttributePathExpandIterator::Position & position) const;
+
+    bool IsAt(size_t index, const AttributePathExpandIterator::Position & position) const;
+
+    DataModel::Provider * mProvider                       = nullptr;
+    SingleLinkedListNode<AttributePathParams> * mPathList = nullptr;
+    uint32_t mGeneration                                  = 0;
+    State mState                                          = State::kEmpty;
+
+    Platform::ScopedMemoryBuffer<Entry> mEntries;
+    size_t mEntryCount = 0;
+
+    // The nodes of the path list in order, and for each of them the index of its first entry, followed by mEntryCount.
+    Platform::ScopedMemoryBuffer<SingleLinkedListNode<AttributePathParams> *> mPaths;
+    Platform::ScopedMemoryBuffer<size_t> mFirstEntry;
+    size_t mPathCount = 0;
+};
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
 /// RollbackAttributePathExpandIterator is an AttributePathExpandIterator wrapper that rolls back the Next()
 /// call whenever a new `MarkCompleted()` method is not called.
 ///
@@ -202,8 +306,10 @@ private:
 class RollbackAttributePathExpandIterator
 {
 public:
-    RollbackAttributePathExpandIterator(DataModel::Provider * dataModel, AttributePathExpandIterator::Position & position) :
-        mAttributePathExpandIterator(dataModel, position), mPositionTarget(position), mCompletedPosition(position)
+    RollbackAttributePathExpandIterator(DataModel::Provider * dataModel, AttributePathExpandIterator::Position & position,
+                                        AttributePathExpansionCache * cache = nullptr) :
+        mAttributePathExpandIterator(dataModel, position, cache),
+        mPositionTarget(position), mCompletedPosition(position)
     {}
     ~RollbackAttributePathExpandIterator() { mPositionTarget = mCompletedPosition; }
 
@@ -49,8 +49,8 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
 
 } // anonymous namespace
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
@@ -65,9 +65,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::UpdateCache(const ConcreteDataAttributePath & aPath,
+                                                                                TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     AttributeState state;
     bool endpointIsNew = false;
@@ -178,9 +178,10 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                                      const StatusIB * apStatus)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::UpdateEventCache(const EventHeader & aEventHeader,
+                                                                                     TLV::TLVReader * apData,
+                                                                                     const StatusIB * apStatus)
 {
     if (apData)
     {
@@ -227,14 +228,14 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::NotifySubscriptionStillActive(const ReadClient & aReadClient)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::NotifySubscriptionStillActive(const ReadClient & aReadClient)
 {
     mCallback.NotifySubscriptionStillActive(aReadClient);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
@@ -242,8 +243,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
     mCallback.OnReportBegin();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::CommitPendingDataVersion()
 {
     if (!mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -258,8 +259,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     }
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
@@ -288,35 +289,38 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::Get(const ConcreteAttributePath & path,
+                                                                        TLV::TLVReader & reader) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-
-    if (attributeState->template Is<StatusIB>())
+    if constexpr (CanEnableDataCaching)
     {
-        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
-    }
+        CHIP_ERROR err;
+        auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+        ReturnErrorOnFailure(err);
 
-    if (!attributeState->template Is<AttributeData>())
+        if (attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+        }
+
+        if (!attributeState->template Is<AttributeData>())
+        {
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
+
+        reader.Init(attributeState->template Get<AttributeData>().Get(),
+                    attributeState->template Get<AttributeData>().AllocatedSize());
+        return reader.Next();
+    }
+    else
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
-
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
-    return reader.Next();
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
-{
-    return CHIP_ERROR_KEY_NOT_FOUND;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
 
@@ -332,9 +336,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+const typename ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::EndpointState *
+ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
 {
     auto endpointIter = mCache.find(endpointId);
     if (endpointIter == mCache.end())
@@ -347,9 +351,10 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId
     return &endpointIter->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+const typename ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetClusterState(EndpointId endpointId, ClusterId clusterId,
+                                                                         CHIP_ERROR & err) const
 {
     auto endpointState = GetEndpointState(endpointId, err);
     if (err != CHIP_NO_ERROR)
@@ -368,10 +373,10 @@ ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId,
     return &clusterState->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                                            CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+const typename ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::AttributeState *
+ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
+                                                                           AttributeId attributeId, CHIP_ERROR & err) const
 {
     auto clusterState = GetClusterState(endpointId, clusterId, err);
     if (err != CHIP_NO_ERROR)
@@ -390,9 +395,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointI
     return &attributeState->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
-ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+const typename ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::EventData *
+ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
     EventData compareKey;
 
@@ -408,9 +413,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     return &(*eventData);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                               const StatusIB & aStatus)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::OnAttributeData(const ConcreteDataAttributePath & aPath,
+                                                                              TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     //
     // Since the cache itself is a ReadClient::Callback, it may be incorrectly passed in directly when registering with the
@@ -440,9 +445,9 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteClusterPath & aPath,
-                                                                Optional<DataVersion> & aVersion) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetVersion(const ConcreteClusterPath & aPath,
+                                                                               Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
     CHIP_ERROR err;
@@ -452,9 +457,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteCl
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                           const StatusIB * apStatus)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                                                          const StatusIB * apStatus)
 {
     VerifyOrDie(apData != nullptr || apStatus != nullptr);
 
@@ -468,31 +473,34 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetStatus(const ConcreteAttributePath & path,
+                                                                              StatusIB & status) const
 {
-    CHIP_ERROR err;
+    if constexpr (CanEnableDataCaching)
+    {
+        CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+        auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+        ReturnErrorOnFailure(err);
 
-    if (!attributeState->template Is<StatusIB>())
+        if (!attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        status = attributeState->template Get<StatusIB>();
+        return CHIP_NO_ERROR;
+    }
+    else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-
-    status = attributeState->template Get<StatusIB>();
-    return CHIP_NO_ERROR;
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
-{
-    return CHIP_ERROR_INVALID_ARGUMENT;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetStatus(const ConcreteEventPath & path,
+                                                                              StatusIB & status) const
 {
     auto statusIter = mEventStatusCache.find(path);
     if (statusIter == mEventStatusCache.end())
@@ -504,8 +512,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetSortedFilters(
+    std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
     for (auto const & endpointIter : mCache)
     {
@@ -571,8 +580,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
               });
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterList(
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::OnUpdateDataVersionFilterList(
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
@@ -646,14 +655,14 @@ exit:
     return err;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::ClearAttributes(EndpointId endpointId)
 {
     mCache.erase(endpointId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
     // Can't use GetEndpointState here, since that only handles const things.
     auto endpointIter = mCache.find(cluster.mEndpointId);
@@ -666,8 +675,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClu
     endpointState.erase(cluster.mClusterId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+void ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
     // Can't use GetClusterState here, since that only handles const things.
     auto endpointIter = mCache.find(attribute.mEndpointId);
@@ -687,8 +696,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttr
     clusterState.mAttributes.erase(attribute.mAttributeId);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
+template <bool CanEnableDataCaching, typename StoragePolicy>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, StoragePolicy>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -701,6 +710,8 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
 // Ensure that our out-of-line template methods actually get compiled.
 template class ClusterStateCacheT<true>;
 template class ClusterStateCacheT<false>;
+template class ClusterStateCacheT<true, ClusterStateCacheFlatStorage>;
+template class ClusterStateCacheT<false, ClusterStateCacheFlatStorage>;
 
 } // namespace app
 } // namespace chip
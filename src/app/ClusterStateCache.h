@@ -24,6 +24,7 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
@@ -66,8 +67,11 @@ namespace app {
  * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
  *
+ * The StoragePolicy selects the containers for the cached state (see ClusterStateCacheStorage.h). Controllers that
+ * cache many large nodes can use ClusterStateCacheFlatStorage to store it in sorted vectors.
+ *
  */
-template <bool CanEnableDataCaching>
+template <bool CanEnableDataCaching, typename StoragePolicy = ClusterStateCacheMapStorage>
 class ClusterStateCacheT : protected ReadClient::Callback
 {
 public:
@@ -466,7 +470,7 @@ public:
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
         auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        if (endpointIter != mCache.end())
         {
             for (auto & clusterIter : endpointIter->second)
             {
@@ -592,19 +596,30 @@ private:
     // quite a bit of space.
     using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
     using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+    static_assert(std::is_nothrow_move_constructible<AttributeState>::value,
+                  "Containers that relocate attribute states would otherwise copy them");
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
     // value the cluster must be included in a path in mRequestPathSet that has a wildcard attribute
     // and we must not be in the middle of receiving reports for that cluster.
+    //
+    // ClusterState is move-only, so that containers which relocate their elements (such as the flat storage) move
+    // rather than try to copy the attribute data.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        ClusterState()                                 = default;
+        ClusterState(ClusterState &&)                  = default;
+        ClusterState & operator=(ClusterState &&)      = default;
+        ClusterState(const ClusterState &)             = delete;
+        ClusterState & operator=(const ClusterState &) = delete;
+
+        typename StoragePolicy::template Map<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using EndpointState = typename StoragePolicy::template Map<ClusterId, ClusterState>;
+    using NodeState     = typename StoragePolicy::template Map<EndpointId, EndpointState>;
 
     struct Comparator
     {
@@ -617,7 +632,7 @@ private:
     using EventData = std::pair<EventHeader, System::PacketBufferHandle>;
 
     //
-    // This is a custom comparator for use with the std::set<EventData> below. Uniqueness
+    // This is a custom comparator for use with the event set below. Uniqueness
     // is determined solely by the event number associated with each event.
     //
     struct EventDataCompare
@@ -724,7 +739,7 @@ private:
     std::set<AttributePathParams, Comparator> mRequestPathSet; // wildcard attribute request path only
     std::vector<EndpointId> mAddedEndpoints;
 
-    std::set<EventData, EventDataCompare> mEventDataCache;
+    typename StoragePolicy::template Set<EventData, EventDataCompare> mEventDataCache;
     Optional<EventNumber> mHighestReceivedEventNumber;
     std::map<ConcreteEventPath, StatusIB> mEventStatusCache;
     BufferedReadCallback mBufferedReader;
@@ -735,6 +750,9 @@ private:
 using ClusterStateCache       = ClusterStateCacheT<true>;
 using ClusterStateCacheNoData = ClusterStateCacheT<false>;
 
+using ClusterStateCacheFlat       = ClusterStateCacheT<true, ClusterStateCacheFlatStorage>;
+using ClusterStateCacheNoDataFlat = ClusterStateCacheT<false, ClusterStateCacheFlatStorage>;
+
 };     // namespace app
 };     // namespace chip
 #endif // CHIP_CONFIG_ENABLE_READ_CLIENT
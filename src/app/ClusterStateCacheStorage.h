@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/*
+ * Storage policies for ClusterStateCacheT, which select the containers that hold the endpoint, cluster and
+ * attribute maps and the cached events.
+ *
+ * A policy provides two alias templates:
+ *      Map<Key, Value>:  an ordered associative container supporting begin()/end() iteration over
+ *                        std::pair<Key, Value>-like elements, find(), erase(key) and operator[].
+ *      Set<T, Compare>:  an ordered set supporting begin()/end() iteration, find(), insert() and clear(),
+ *                        where insert() does not replace an element that compares equal.
+ */
+
+/*
+ * The default policy: node-based std::map and std::set. Elements are never moved once inserted.
+ */
+struct ClusterStateCacheMapStorage
+{
+    template <typename Key, typename Value>
+    using Map = std::map<Key, Value>;
+
+    template <typename T, typename Compare>
+    using Set = std::set<T, Compare>;
+};
+
+/*
+ * An ordered map stored as a vector of pairs sorted by key.
+ *
+ * Lookups are a binary search over contiguous memory, and there is no per-element allocation. Insertion and
+ * removal are linear in the number of elements after the insertion point, so this suits maps that are mostly
+ * read, or are filled in key order (as reports for wildcard subscriptions are). Inserting or erasing an element
+ * invalidates iterators and references to the elements after it.
+ */
+template <typename Key, typename Value>
+class FlatSortedMap
+{
+public:
+    using value_type     = std::pair<Key, Value>;
+    using iterator       = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator begin() { return mEntries.begin(); }
+    iterator end() { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    size_t size() const { return mEntries.size(); }
+    bool empty() const { return mEntries.empty(); }
+
+    iterator find(const Key & key)
+    {
+        auto iter = LowerBound(key);
+        return (iter != mEntries.end() && iter->first == key) ? iter : mEntries.end();
+    }
+
+    const_iterator find(const Key & key) const
+    {
+        auto iter = std::lower_bound(mEntries.begin(), mEntries.end(), key, KeyLess);
+        return (iter != mEntries.end() && iter->first == key) ? iter : mEntries.end();
+    }
+
+    Value & operator[](const Key & key)
+    {
+        auto iter = LowerBound(key);
+        if (iter == mEntries.end() || iter->first != key)
+        {
+            iter = mEntries.emplace(iter, key, Value());
+        }
+        return iter->second;
+    }
+
+    size_t erase(const Key & key)
+    {
+        auto iter = find(key);
+        if (iter == mEntries.end())
+        {
+            return 0;
+        }
+        mEntries.erase(iter);
+        return 1;
+    }
+
+    void clear() { mEntries.clear(); }
+
+private:
+    static bool KeyLess(const value_type & entry, const Key & key) { return entry.first < key; }
+
+    iterator LowerBound(const Key & key)
+    {
+        // Keys usually arrive in increasing order, so check for an append first.
+        if (mEntries.empty() || mEntries.back().first < key)
+        {
+            return mEntries.end();
+        }
+        return std::lower_bound(mEntries.begin(), mEntries.end(), key, KeyLess);
+    }
+
+    std::vector<value_type> mEntries;
+};
+
+/*
+ * An ordered set stored as a sorted vector, with the same trade-offs as FlatSortedMap.
+ */
+template <typename T, typename Compare>
+class FlatSortedSet
+{
+public:
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    size_t size() const { return mEntries.size(); }
+    bool empty() const { return mEntries.empty(); }
+
+    const_iterator find(const T & value) const
+    {
+        auto iter = std::lower_bound(mEntries.begin(), mEntries.end(), value, Compare());
+        return (iter != mEntries.end() && !Compare()(value, *iter)) ? iter : mEntries.end();
+    }
+
+    std::pair<const_iterator, bool> insert(T && value)
+    {
+        auto iter = mEntries.end();
+        if (!mEntries.empty() && !Compare()(mEntries.back(), value))
+        {
+            iter = std::lower_bound(mEntries.begin(), mEntries.end(), value, Compare());
+            if (!Compare()(value, *iter))
+            {
+                return std::make_pair(const_iterator(iter), false);
+            }
+        }
+        return std::make_pair(const_iterator(mEntries.insert(iter, std::move(value))), true);
+    }
+
+    void clear() { mEntries.clear(); }
+
+private:
+    std::vector<T> mEntries;
+};
+
+/*
+ * A policy that stores the cache in sorted vectors: one allocation per endpoint and per cluster instead of
+ * one per endpoint, cluster, attribute and event, and lookups over contiguous memory. Intended for
+ * controllers that cache many large nodes, where the node-based containers dominate heap use.
+ */
+struct ClusterStateCacheFlatStorage
+{
+    template <typename Key, typename Value>
+    using Map = FlatSortedMap<Key, Value>;
+
+    template <typename T, typename Compare>
+    using Set = FlatSortedSet<T, Compare>;
+};
+
+} // namespace app
+} // namespace chip
@@ -23,6 +23,7 @@
 #include <platform/LockTracker.h>
 #include <protocols/Protocols.h>
 #include <protocols/interaction_model/Constants.h>
+#include <tracing/metric_event.h>
 
 namespace chip {
 namespace app {
@@ -78,6 +79,11 @@ CommandSender::CommandSender(ExtendableCallback * apExtendableCallback, Messagin
 CommandSender::~CommandSender()
 {
     assertChipStackLockedByCurrentThread();
+
+    if (mState == State::AwaitingTimedStatus || mState == State::AwaitingResponse || mState == State::ResponseReceived)
+    {
+        MATTER_LOG_METRIC_END(Tracing::kMetricDeviceInvokeInteraction, CHIP_ERROR_CANCELLED);
+    }
 }
 
 CHIP_ERROR CommandSender::AllocateBuffer()
@@ -174,7 +180,9 @@ CHIP_ERROR CommandSender::SendCommandRequest(const SessionHandle & session, Opti
             mTimedRequest, mTimedInvokeTimeoutMs.HasValue());
         return CHIP_ERROR_INCORRECT_STATE;
     }
-    return SendCommandRequestInternal(session, timeout);
+    ReturnErrorOnFailure(SendCommandRequestInternal(session, timeout));
+    MATTER_LOG_METRIC_BEGIN(Tracing::kMetricDeviceInvokeInteraction);
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR CommandSender::SendGroupCommandRequest(const SessionHandle & session)
@@ -285,6 +293,7 @@ exit:
         {
             FlushNoCommandResponse();
         }
+        MATTER_LOG_METRIC_END(Tracing::kMetricDeviceInvokeInteraction, err);
         Close();
     }
     // Else we got a response to a Timed Request and just sent the invoke.
@@ -351,6 +360,7 @@ void CommandSender::OnResponseTimeout(Messaging::ExchangeContext * apExchangeCon
     ChipLogProgress(DataManagement, "Time out! failed to receive invoke command response from Exchange: " ChipLogFormatExchange,
                     ChipLogValueExchange(apExchangeContext));
 
+    MATTER_LOG_METRIC_END(Tracing::kMetricDeviceInvokeInteraction, CHIP_ERROR_TIMEOUT);
     OnErrorCallback(CHIP_ERROR_TIMEOUT);
     Close();
 }
@@ -62,6 +62,55 @@ EventManagement & EventManagement::GetInstance()
     return sInstance;
 }
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+/**
+ * @brief
+ *   A read-only TLVBackingStore over the bytes of a CircularEventBuffer that
+ *   start at a given offset, wrapping around the end of its storage. Used to
+ *   read an indexed event without going through the events stored before it.
+ */
+class CircularEventBufferRegion : public TLV::TLVBackingStore
+{
+public:
+    CircularEventBufferRegion(const CircularEventBuffer & aBuffer, uint32_t aOffset) :
+        mpQueue(aBuffer.GetQueue()), mQueueSize(aBuffer.GetTotalDataLength()), mOffset(aOffset)
+    {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mpQueue + mOffset;
+        bufLen   = mQueueSize - mOffset;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        // The reader limits itself to the length of the event, so it only asks for more data once, when the event wraps around.
+        bufLen = (bufStart == mpQueue + mQueueSize) ? mOffset : 0;
+        if (bufLen != 0)
+        {
+            bufStart = mpQueue;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mpQueue;
+    uint32_t mQueueSize;
+    uint32_t mOffset;
+};
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
 struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
@@ -134,11 +183,17 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    CircularEventBuffer backup = *nextBuffer;
+    // Only the TLV state of the buffer changes while copying; backing it up rather than the whole CircularEventBuffer keeps
+    // its event index off the stack.
+    TLVCircularBuffer backup = *nextBuffer;
 
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    const uint32_t eventOffset = nextBuffer->GetTailOffset();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     writer.Init(*nextBuffer);
 
     // Set up the reader s.t. it is positioned to read the head event
@@ -153,11 +208,26 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (const EventIndexEntry * oldest = apEventBuffer->GetEventIndex().Oldest())
+    {
+        EventIndexEntry entry = *oldest;
+        entry.mOffset         = eventOffset;
+        entry.mLength         = writer.GetLengthWritten();
+        nextBuffer->GetEventIndex().Append(entry);
+    }
+    else
+    {
+        // The copied event is not indexed, so neither is anything older than it in the next buffer.
+        nextBuffer->GetEventIndex().Invalidate(nextBuffer->DataLength());
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
     {
-        *nextBuffer = backup;
+        static_cast<TLVCircularBuffer &>(*nextBuffer) = backup;
     }
     return err;
 }
@@ -197,7 +267,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            err                                 = eventBuffer->EvictOldestEvent();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -219,7 +289,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
+                    err                                 = eventBuffer->EvictOldestEvent();
                     // if unconditional eviction failed, this
                     // means that we have no way of further
                     // clearing the buffer.  fail out and let the
@@ -428,6 +498,9 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
     InternalEventOptions opts;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    EventIndexEntry eventIndexEntry;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
 
     Timestamp timestamp;
 #if CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
@@ -465,9 +538,26 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    eventIndexEntry.mOffset = mpEventBuffer->GetTailOffset();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     err = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    eventIndexEntry.mEventNumber = mLastEventNumber;
+    eventIndexEntry.mEndpointId  = opts.mPath.mEndpointId;
+    eventIndexEntry.mClusterId   = opts.mPath.mClusterId;
+    eventIndexEntry.mEventId     = opts.mPath.mEventId;
+    eventIndexEntry.mLength      = writer.GetLengthWritten();
+    if (opts.mFabricIndex != kUndefinedFabricIndex)
+    {
+        eventIndexEntry.mFabricIndex.SetValue(opts.mFabricIndex);
+    }
+    mpEventBuffer->GetEventIndex().Append(eventIndexEntry);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     mBytesWritten += writer.GetLengthWritten();
 
 exit:
@@ -532,26 +622,8 @@ bool EventManagement::IncludeEventInReport(EventLoadOutContext * eventLoadOutCon
         return false;
     }
 
-    if (event.mFabricIndex.HasValue() &&
-        (event.mFabricIndex.Value() == kUndefinedFabricIndex ||
-         eventLoadOutContext->mSubjectDescriptor.fabricIndex != event.mFabricIndex.Value()))
-    {
-        return false;
-    }
-
-    bool isPathInterested = false;
     ConcreteEventPath path(event.mEndpointId, event.mClusterId, event.mEventId);
-    // Check whether the event path is in the interested paths
-    for (auto * interestedPath = eventLoadOutContext->mpInterestedEventPaths; interestedPath != nullptr;
-         interestedPath        = interestedPath->mpNext)
-    {
-        if (interestedPath->mValue.IsEventPathSupersetOf(path))
-        {
-            isPathInterested = true;
-            break;
-        }
-    }
-    if (!isPathInterested)
+    if (!IsEventOfInterest(eventLoadOutContext, path, event.mFabricIndex))
     {
         return false;
     }
@@ -589,6 +661,28 @@ bool EventManagement::IncludeEventInReport(EventLoadOutContext * eventLoadOutCon
     return true;
 }
 
+bool EventManagement::IsEventOfInterest(EventLoadOutContext * eventLoadOutContext, const ConcreteEventPath & path,
+                                        const Optional<FabricIndex> & fabricIndex)
+{
+    if (fabricIndex.HasValue() &&
+        (fabricIndex.Value() == kUndefinedFabricIndex ||
+         eventLoadOutContext->mSubjectDescriptor.fabricIndex != fabricIndex.Value()))
+    {
+        return false;
+    }
+
+    // Check whether the event path is in the interested paths
+    for (auto * interestedPath = eventLoadOutContext->mpInterestedEventPaths; interestedPath != nullptr;
+         interestedPath        = interestedPath->mpNext)
+    {
+        if (interestedPath->mValue.IsEventPathSupersetOf(path))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 CHIP_ERROR EventManagement::EventIterator(const TLVReader & aReader, size_t aDepth, EventLoadOutContext * apEventLoadOutContext,
                                           EventEnvelopeContext * event, bool & encodeEvent)
 {
@@ -666,10 +760,20 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
 
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
-    SuccessOrExit(err);
 
-    err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    if (IsEventIndexComplete())
+    {
+        err = FetchIndexedEventsSince(context);
+    }
+    else
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    {
+        err = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+        SuccessOrExit(err);
+
+        err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
+    }
     if (err == CHIP_END_OF_TLV)
     {
         err = CHIP_NO_ERROR;
@@ -690,6 +794,59 @@ exit:
     return err;
 }
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+bool EventManagement::IsEventIndexComplete() const
+{
+    if (mpEventBuffer == nullptr)
+    {
+        return false;
+    }
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        if (!buffer->IsEventIndexComplete())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+CHIP_ERROR EventManagement::FetchIndexedEventsSince(EventLoadOutContext & aContext)
+{
+    // Go through the buffers in the same order as the reader of GetEventReader(PriorityLevel::Critical), i.e. from the
+    // oldest event to the newest one.
+    for (auto * buffer = GetPriorityBuffer(PriorityLevel::Critical); buffer != nullptr;
+         buffer        = buffer->GetPreviousCircularEventBuffer())
+    {
+        const EventIndex & index = buffer->GetEventIndex();
+        size_t position          = index.LowerBound(aContext.mStartingEventNumber);
+        if (position > 0)
+        {
+            // Keep track of the skipped events like CopyEventsSince would have.
+            aContext.mCurrentEventNumber = index[position - 1].mEventNumber;
+        }
+
+        for (; position < index.Count(); position++)
+        {
+            const EventIndexEntry & entry = index[position];
+            aContext.mCurrentEventNumber  = entry.mEventNumber;
+            if (!IsEventOfInterest(&aContext, ConcreteEventPath(entry.mEndpointId, entry.mClusterId, entry.mEventId),
+                                   entry.mFabricIndex))
+            {
+                continue;
+            }
+
+            CircularEventBufferRegion region(*buffer, entry.mOffset);
+            TLVReader reader;
+            ReturnErrorOnFailure(reader.Init(region, entry.mLength));
+            ReturnErrorOnFailure(reader.Next());
+            ReturnErrorOnFailure(CopyEventsSince(reader, 0, &aContext));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
 CHIP_ERROR EventManagement::FabricRemovedCB(const TLV::TLVReader & aReader, size_t aDepth, void * apContext)
 {
     // the function does not actually remove the event, instead, it sets the fabric index to an invalid value.
@@ -746,6 +903,22 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     {
         err = CHIP_NO_ERROR;
     }
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    // Mirror what FabricRemovedCB did to the events themselves.
+    for (auto * buffer = mpEventBuffer; buffer != nullptr; buffer = buffer->GetNextCircularEventBuffer())
+    {
+        EventIndex & index = buffer->GetEventIndex();
+        for (size_t position = 0; position < index.Count(); position++)
+        {
+            Optional<FabricIndex> & fabricIndex = index[position].mFabricIndex;
+            if (fabricIndex.HasValue() && fabricIndex.Value() == aFabricIndex)
+            {
+                fabricIndex.SetValue(kUndefinedFabricIndex);
+            }
+        }
+    }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
     return err;
 }
 
@@ -887,6 +1060,23 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    mEventIndex.Invalidate(DataLength());
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+}
+
+CHIP_ERROR CircularEventBuffer::EvictOldestEvent()
+{
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    const uint32_t dataLength = DataLength();
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
+    ReturnErrorOnFailure(EvictHead());
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    mEventIndex.RemoveOldest(dataLength - DataLength(), DataLength());
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    return CHIP_NO_ERROR;
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -905,6 +1095,73 @@ CHIP_ERROR CircularEventBuffer::OnInit(TLV::TLVWriter & writer, uint8_t *& bufSt
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+size_t EventIndex::LowerBound(EventNumber aEventNumber) const
+{
+    // Events are indexed in the order they were logged, i.e. by increasing event number.
+    size_t low  = 0;
+    size_t high = mCount;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if ((*this)[middle].mEventNumber < aEventNumber)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+void EventIndex::Append(const EventIndexEntry & aEntry)
+{
+    if (mCount == kCapacity)
+    {
+        // Keep indexing the newest events, which are the ones reports are after.
+        mUnindexedLength += mEntries[mFirst].mLength;
+        mIndexedLength -= mEntries[mFirst].mLength;
+        mFirst = (mFirst + 1) % kCapacity;
+        mCount--;
+    }
+    mEntries[(mFirst + mCount) % kCapacity] = aEntry;
+    mCount++;
+    mIndexedLength += aEntry.mLength;
+}
+
+void EventIndex::RemoveOldest(uint32_t aLength, uint32_t aDataLength)
+{
+    if (mUnindexedLength > 0)
+    {
+        if (aLength <= mUnindexedLength)
+        {
+            mUnindexedLength -= aLength;
+            return;
+        }
+    }
+    else if (mCount > 0 && mEntries[mFirst].mLength == aLength)
+    {
+        mIndexedLength -= aLength;
+        mFirst = (mFirst + 1) % kCapacity;
+        mCount--;
+        return;
+    }
+
+    // The buffer does not match the index, stop relying on it until all events left in the buffer are gone.
+    Invalidate(aDataLength);
+}
+
+void EventIndex::Invalidate(uint32_t aDataLength)
+{
+    mFirst           = 0;
+    mCount           = 0;
+    mIndexedLength   = 0;
+    mUnindexedLength = aDataLength;
+}
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
 void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 {
     CircularEventBuffer * prev;
@@ -28,12 +28,14 @@
 
 #include "EventLoggingDelegate.h"
 #include <access/SubjectDescriptor.h>
+#include <app/ConcreteEventPath.h>
 #include <app/EventLoggingTypes.h>
 #include <app/EventReporter.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/MessageDef/StatusIB.h>
 #include <app/data-model-provider/EventsGenerator.h>
 #include <app/util/basic-types.h>
+#include <lib/core/Optional.h>
 #include <lib/core/TLVCircularBuffer.h>
 #include <lib/support/CHIPCounter.h>
 #include <lib/support/LinkedList.h>
@@ -78,6 +80,79 @@ inline constexpr size_t kMaxEventSizeReserve            = 512;
 inline constexpr uint16_t kRequiredEventField =
     (1 << to_underlying(EventDataIB::Tag::kPriority)) | (1 << to_underlying(EventDataIB::Tag::kPath));
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+/**
+ * @brief
+ *   Describes an event stored in a CircularEventBuffer, so that the event can
+ *   be filtered and located without decoding it.
+ */
+struct EventIndexEntry
+{
+    EventNumber mEventNumber = 0;
+    ClusterId mClusterId     = 0;
+    EventId mEventId         = 0;
+    uint32_t mOffset         = 0; ///< Position of the event in the storage of its buffer
+    uint32_t mLength         = 0; ///< Encoded length of the event
+    EndpointId mEndpointId   = 0;
+    Optional<FabricIndex> mFabricIndex;
+};
+
+/**
+ * @brief
+ *   Index of the events of a CircularEventBuffer, from oldest to newest.
+ *
+ * When a buffer holds more events than the index has room for, the index
+ * drops its oldest entries and only covers the newest events of the buffer,
+ * until the events that are not indexed get evicted.
+ */
+class EventIndex
+{
+public:
+    size_t Count() const { return mCount; }
+    const EventIndexEntry & operator[](size_t aPosition) const { return mEntries[(mFirst + aPosition) % kCapacity]; }
+    EventIndexEntry & operator[](size_t aPosition) { return mEntries[(mFirst + aPosition) % kCapacity]; }
+
+    /**
+     * @brief Whether every event of a buffer holding aDataLength bytes is indexed.
+     */
+    bool IsComplete(uint32_t aDataLength) const { return mUnindexedLength == 0 && mIndexedLength == aDataLength; }
+
+    /**
+     * @brief The entry of the oldest event of the buffer, or nullptr if that event is not indexed.
+     */
+    const EventIndexEntry * Oldest() const { return (mUnindexedLength == 0 && mCount > 0) ? &(*this)[0] : nullptr; }
+
+    /**
+     * @brief The position of the oldest indexed event numbered aEventNumber or later, or Count() if there is none.
+     */
+    size_t LowerBound(EventNumber aEventNumber) const;
+
+    /**
+     * @brief Records the event just written at the tail of the buffer.
+     */
+    void Append(const EventIndexEntry & aEntry);
+
+    /**
+     * @brief Accounts for the eviction of the oldest aLength bytes of the buffer, which now holds aDataLength bytes.
+     */
+    void RemoveOldest(uint32_t aLength, uint32_t aDataLength);
+
+    /**
+     * @brief Forgets all entries, treating the aDataLength bytes held by the buffer as not indexed.
+     */
+    void Invalidate(uint32_t aDataLength);
+
+private:
+    static constexpr size_t kCapacity = CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE;
+
+    EventIndexEntry mEntries[kCapacity];
+    size_t mFirst             = 0;
+    size_t mCount             = 0;
+    uint32_t mIndexedLength   = 0; ///< Bytes of the buffer taken by the events in mEntries
+    uint32_t mUnindexedLength = 0; ///< Bytes of the buffer taken by the oldest events, which are not in mEntries
+};
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
 /**
  * @brief
  *   Internal event buffer, built around the TLV::TLVCircularBuffer
@@ -130,6 +205,24 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Evicts the oldest event of the buffer, like EvictHead(), keeping the
+     *   event index up to date.
+     */
+    CHIP_ERROR EvictOldestEvent();
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    EventIndex & GetEventIndex() { return mEventIndex; }
+    const EventIndex & GetEventIndex() const { return mEventIndex; }
+    bool IsEventIndexComplete() const { return mEventIndex.IsComplete(DataLength()); }
+
+    /**
+     * @brief The position in the storage of the buffer where the next event will be written.
+     */
+    uint32_t GetTailOffset() const { return static_cast<uint32_t>(QueueTail() - GetQueue()); }
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     ~CircularEventBuffer() override = default;
 
 private:
@@ -141,6 +234,10 @@ private:
 
     size_t mRequiredSpaceForEvicted = 0; ///< Required space for previous buffer to evict event to new buffer
 
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    EventIndex mEventIndex;
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     CHIP_ERROR OnInit(TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override;
 };
 
@@ -550,6 +647,26 @@ private:
      */
     static bool IncludeEventInReport(EventLoadOutContext * eventLoadOutContext, const EventEnvelopeContext & event);
 
+    /**
+     * @brief Check the part of IncludeEventInReport that only depends on the path and fabric of the event: whether the
+     * event is of a path the report is interested in, and of the fabric of the subject, if fabric-sensitive.
+     */
+    static bool IsEventOfInterest(EventLoadOutContext * eventLoadOutContext, const ConcreteEventPath & path,
+                                  const Optional<FabricIndex> & fabricIndex);
+
+#if CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+    /**
+     * @brief Whether the event indexes cover every event of every buffer.
+     */
+    bool IsEventIndexComplete() const;
+
+    /**
+     * @brief Implement #FetchEventsSince using the event indexes: start at the first event numbered at least
+     * aContext.mStartingEventNumber, and only decode the events that are of interest to the report.
+     */
+    CHIP_ERROR FetchIndexedEventsSince(EventLoadOutContext & aContext);
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE > 0
+
     /**
      * @brief copy event from circular buffer to target buffer for report
      */
@@ -450,6 +450,17 @@ void OperationalSessionSetup::OnSessionEstablishmentError(CHIP_ERROR error, Sess
     VerifyOrReturn(mState == State::Connecting,
                    ChipLogError(Discovery, "OnSessionEstablishmentError was called while we were not connecting"));
 
+    if (CHIP_ERROR_TIMEOUT == error)
+    {
+        // The peer did not answer at the address we tried; make sure the
+        // resolver does not hand that address out again from a cache.
+        auto const * fabricInfo = mInitParams.fabricTable->FindFabricWithIndex(mPeerId.GetFabricIndex());
+        if (fabricInfo != nullptr)
+        {
+            Resolver::Instance().InvalidateCachedAddress(PeerId(fabricInfo->GetCompressedFabricId(), mPeerId.GetNodeId()));
+        }
+    }
+
     // If this condition ever changes, we may need to store the error in a
     // member instead of having a boolean
     // mTryingNextResultDueToSessionEstablishmentError, so we can recover the
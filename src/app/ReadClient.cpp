@@ -100,6 +100,11 @@ ReadClient::~ReadClient()
 {
     assertChipStackLockedByCurrentThread();
 
+    if (mReadMetricActive)
+    {
+        MATTER_LOG_METRIC_END(Tracing::kMetricDeviceReadInteraction, CHIP_ERROR_CANCELLED);
+    }
+
     if (IsSubscriptionType())
     {
         StopResubscription();
@@ -180,6 +185,12 @@ void ReadClient::Close(CHIP_ERROR aError, bool allowResubscription)
 {
     if (IsReadType())
     {
+        if (mReadMetricActive)
+        {
+            MATTER_LOG_METRIC_END(Tracing::kMetricDeviceReadInteraction, aError);
+            mReadMetricActive = false;
+        }
+
         if (aError != CHIP_NO_ERROR)
         {
             mpCallback.OnError(aError);
@@ -367,6 +378,8 @@ CHIP_ERROR ReadClient::SendReadRequest(ReadPrepareParams & aReadPrepareParams)
 
     mPeer = aReadPrepareParams.mSessionHolder->AsSecureSession()->GetPeer();
     MoveToState(ClientState::AwaitingInitialReport);
+    MATTER_LOG_METRIC_BEGIN(Tracing::kMetricDeviceReadInteraction);
+    mReadMetricActive = true;
 
     return CHIP_NO_ERROR;
 }
@@ -677,6 +677,9 @@ private:
 
     bool mIsPeerLIT = false;
 
+    // Whether kMetricDeviceReadInteraction was begun for this read and not yet ended.
+    bool mReadMetricActive = false;
+
     // End Of Container (0x18) uses one byte.
     static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
     // Reserved size for the uint8_t InteractionModelRevision flag, which takes up 1 byte for the control tag and 1 byte for the
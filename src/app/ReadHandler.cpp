@@ -879,7 +879,7 @@ void ReadHandler::AttributePathIsDirty(DataModel::Provider * apDataModel, const
     // TODO (#16699): Currently we can only guarantee the reports generated from a single path in the request are consistent. The
     // data might be inconsistent if the user send a request with two paths from the same cluster. We need to clearify the behavior
     // or make it consistent.
-    if (AttributePathExpandIterator(apDataModel, tempPosition).Next(path) &&
+    if (AttributePathExpandIterator(apDataModel, tempPosition, GetAttributePathExpansionCache()).Next(path) &&
         (aAttributeChanged.HasWildcardEndpointId() || aAttributeChanged.mEndpointId == path.mEndpointId) &&
         (aAttributeChanged.HasWildcardClusterId() || aAttributeChanged.mClusterId == path.mClusterId))
     {
@@ -421,6 +421,13 @@ private:
     CHIP_ERROR OnSubscribeRequest(Messaging::ExchangeContext * apExchangeContext, System::PacketBufferHandle && aPayload);
     void GetSubscriptionId(SubscriptionId & aSubscriptionId) const { aSubscriptionId = mSubscriptionId; }
     AttributePathExpandIterator::Position & AttributeIterationPosition() { return mAttributePathExpandPosition; }
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+    // A priming report expands every path once, which is cheaper than filling the cache on the way. Only the reports
+    // of a subscription that follow it use the cache.
+    AttributePathExpansionCache * GetAttributePathExpansionCache() { return IsPriming() ? nullptr : &mAttributePathExpansionCache; }
+#else
+    AttributePathExpansionCache * GetAttributePathExpansionCache() { return nullptr; }
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
 
     /// @brief Notifies the read handler that a set of attribute paths has been marked dirty. This will schedule a reporting engine
     /// run if the change to the attribute path makes the ReadHandler reportable.
@@ -589,6 +596,11 @@ private:
     /// Iterator position state for any ongoing path expansion for handling wildcard reads/subscriptions.
     AttributePathExpandIterator::Position mAttributePathExpandPosition;
 
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+    /// Expansion of mpAttributePathList, shared by all the reports of this handler.
+    AttributePathExpansionCache mAttributePathExpansionCache;
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
     Messaging::ExchangeHolder mExchangeCtx;
 #if CHIP_CONFIG_UNSAFE_SUBSCRIPTION_EXCHANGE_MANAGER_USE
     // TODO: this should be replaced by a pointer to the InteractionModelEngine that created the ReadHandler
@@ -197,22 +197,24 @@ CHIP_ERROR DefaultSceneTableImpl::DeleteAllScenesInGroup(FabricIndex fabric_inde
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    FabricSceneData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        FabricSceneData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
-    CHIP_ERROR err = fabric.Load(this->mStorage);
-    VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
-    ReturnErrorOnFailure(err);
+        CHIP_ERROR err = fabric.Load(this->mStorage);
+        VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
 
-    for (uint16_t i = 0; i < mMaxPerFabric; i++)
-    {
-        if (fabric.entry_map[i].mGroupId == group_id)
+        for (uint16_t i = 0; i < mMaxPerFabric; i++)
         {
-            // Removing each scene from the nvm and clearing their entry in the scene map
-            ReturnErrorOnFailure(fabric.RemoveEntry(*mStorage, fabric.entry_map[i]));
+            if (fabric.entry_map[i].mGroupId == group_id)
+            {
+                // Removing each scene from the nvm and clearing their entry in the scene map
+                ReturnErrorOnFailure(fabric.RemoveEntry(*mStorage, fabric.entry_map[i]));
+            }
         }
-    }
 
-    return CHIP_NO_ERROR;
+        return CHIP_NO_ERROR;
+    });
 }
 
 /// @brief Register a handler in the handler linked list
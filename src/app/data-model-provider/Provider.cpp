@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 #include "platform/LockTracker.h"
+#include <app-common/zap-generated/ids/Attributes.h>
 #include <app/data-model-provider/Provider.h>
 
 namespace chip::app::DataModel {
@@ -67,6 +68,11 @@ void Provider::NotifyAttributeChanged(const ConcreteAttributePath & path, Attrib
 {
     assertChipStackLockedByCurrentThread();
 
+    if (path.mAttributeId == Clusters::Globals::Attributes::AttributeList::Id)
+    {
+        IncreaseMetadataStructureGeneration();
+    }
+
     // Register this iteration on the stack of active iterators.
     // This allows UnregisterAttributeChangeListener to update us if needed.
     ActiveIterator iter;
@@ -88,6 +94,8 @@ void Provider::NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType t
 {
     assertChipStackLockedByCurrentThread();
 
+    IncreaseMetadataStructureGeneration();
+
     // Register this iteration on the stack of active iterators.
     // This allows UnregisterAttributeChangeListener to update us if needed.
     ActiveIterator iter;
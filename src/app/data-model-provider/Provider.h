@@ -128,6 +128,16 @@ public:
     void NotifyAttributeChanged(const ConcreteAttributePath & path, AttributeChangeType type);
     void NotifyEndpointChanged(EndpointId endpointId, EndpointChangeType type);
 
+    /// Maintains an increasing count of structural changes of the data model: endpoints being
+    /// added or removed, clusters being registered or unregistered and attribute lists changing.
+    ///
+    /// Users that cache results of metadata iteration (e.g. expanded wildcard paths) can compare
+    /// generations to tell whether their cache is still valid. NotifyEndpointChanged and
+    /// changes of the AttributeList global attribute increase the generation automatically;
+    /// implementations increase it through IncreaseMetadataStructureGeneration for other changes.
+    uint32_t GetMetadataStructureGeneration() const { return mMetadataStructureGeneration; }
+    void IncreaseMetadataStructureGeneration() { mMetadataStructureGeneration++; }
+
 private:
     /// Represents an active iteration over the listener list.
     /// Since listeners can be unregistered during notification, and notifications
@@ -144,6 +154,7 @@ private:
 
     AttributeChangeListener * mAttributeChangeListenersHead = nullptr;
     ActiveIterator * mActiveIterators                       = nullptr; // Head of the stack of active iterators
+    uint32_t mMetadataStructureGeneration                   = 0;
 };
 
 } // namespace DataModel
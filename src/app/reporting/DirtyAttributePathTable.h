@@ -0,0 +1,147 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A fixed-capacity table of dirty concrete attribute paths, each stamped with the
+ *      dirty set generation at which it was last marked dirty.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/Generations.h>
+#include <lib/support/CodeUtils.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * Records the last generation at which each of up to kMaxPaths concrete attribute paths was marked
+ * dirty, so that a report can tell exactly which attributes changed since a given generation.
+ *
+ * Unlike the pool of (possibly wildcard) dirty paths in the reporting engine, the table never merges
+ * paths: marking a path that is not in the table fails once kMaxPaths paths are recorded, and the
+ * caller is expected to fall back to a coarser representation. Paths are only removed all at once,
+ * by Clear().
+ *
+ * The table is open-addressed with linear probing and is kept at most three quarters full. Each slot
+ * takes 16 bytes.
+ *
+ * @tparam kMaxPaths the maximum number of paths recorded at once
+ */
+template <size_t kMaxPaths>
+class DirtyAttributePathTable
+{
+public:
+    static_assert(kMaxPaths > 0, "DirtyAttributePathTable needs room for at least one path");
+
+    static constexpr size_t kCapacity = [] {
+        size_t capacity = 2;
+        while (capacity * 3 < kMaxPaths * 4)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }();
+
+    /**
+     * Record that the path was marked dirty at the given generation, which must not be zero.
+     *
+     * @return false if the path is not in the table and kMaxPaths paths are already recorded.
+     */
+    bool Mark(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration)
+    {
+        VerifyOrReturnValue(!aGeneration.IsZero(), false);
+
+        size_t i = Probe(aPath);
+        if (mSlots[i].mGeneration.IsZero())
+        {
+            VerifyOrReturnValue(mSize < kMaxPaths, false);
+            mSlots[i].mEndpointId  = aPath.mEndpointId;
+            mSlots[i].mClusterId   = aPath.mClusterId;
+            mSlots[i].mAttributeId = aPath.mAttributeId;
+            mSize++;
+        }
+        mSlots[i].mGeneration = aGeneration;
+        return true;
+    }
+
+    /**
+     * The generation at which the path was last marked dirty, or a zero generation if it was not
+     * marked dirty since the last Clear().
+     */
+    AttributeGeneration Get(const ConcreteAttributePath & aPath) const { return mSlots[Probe(aPath)].mGeneration; }
+
+    /// Forget every recorded path.
+    void Clear()
+    {
+        VerifyOrReturn(mSize > 0);
+        for (auto & slot : mSlots)
+        {
+            slot.mGeneration.Clear();
+        }
+        mSize = 0;
+    }
+
+    size_t Size() const { return mSize; }
+    bool IsEmpty() const { return mSize == 0; }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+
+    struct Slot
+    {
+        ClusterId mClusterId     = 0;
+        AttributeId mAttributeId = 0;
+        EndpointId mEndpointId   = 0;
+        AttributeGeneration mGeneration;
+    };
+
+    static size_t HomeSlot(const ConcreteAttributePath & aPath)
+    {
+        uint32_t hash = aPath.mAttributeId * 0x9E3779B1u;
+        hash ^= aPath.mClusterId * 0x85EBCA77u;
+        hash ^= static_cast<uint32_t>(aPath.mEndpointId) * 0xC2B2AE3Du;
+        hash ^= hash >> 16;
+        return hash & kMask;
+    }
+
+    /// The slot holding the path, or the empty slot where it would be inserted.
+    size_t Probe(const ConcreteAttributePath & aPath) const
+    {
+        size_t i = HomeSlot(aPath);
+        while (!mSlots[i].mGeneration.IsZero() &&
+               (mSlots[i].mAttributeId != aPath.mAttributeId || mSlots[i].mClusterId != aPath.mClusterId ||
+                mSlots[i].mEndpointId != aPath.mEndpointId))
+        {
+            i = (i + 1) & kMask;
+        }
+        return i;
+    }
+
+    Slot mSlots[kCapacity];
+    size_t mSize = 0;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -319,7 +319,7 @@ void Engine::Shutdown()
 
     mNumReportsInFlight = 0;
     mCurReadHandlerIdx  = 0;
-    mGlobalDirtySet.ReleaseAll();
+    ClearDirtyPaths();
 }
 
 bool Engine::IsClusterDataVersionMatch(const SingleLinkedListNode<DataVersionFilter> * aDataVersionFilterList,
@@ -396,28 +396,16 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
 
         // For each path included in the interested path of the read handler...
         for (RollbackAttributePathExpandIterator iterator(mpImEngine->GetDataModelProvider(),
-                                                          apReadHandler->AttributeIterationPosition());
+                                                          apReadHandler->AttributeIterationPosition(),
+                                                          apReadHandler->GetAttributePathExpansionCache());
              iterator.Next(readPath); iterator.MarkCompleted())
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
-
-                if (!concretePathDirty)
+                if (!IsAttributePathDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration))
                 {
                     // This attribute is not dirty, we just skip this one.
                     continue;
@@ -959,7 +947,7 @@ void Engine::Run()
     {
         ChipLogDetail(DataManagement, "All ReadHandler-s are clean, clear GlobalDirtySet");
 
-        mGlobalDirtySet.ReleaseAll();
+        ClearDirtyPaths();
     }
 }
 
@@ -1098,6 +1086,33 @@ CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttribute
     return CHIP_NO_ERROR;
 }
 
+bool Engine::IsAttributePathDirtySince(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration)
+{
+#if CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS > 0
+    AttributeGeneration pathGeneration = mDirtyAttributePaths.Get(aPath);
+    if (!pathGeneration.IsZero() && pathGeneration.After(aGeneration))
+    {
+        return true;
+    }
+#endif
+
+    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+        if (dirtyPath->IsAttributePathSupersetOf(aPath) && dirtyPath->mGeneration.After(aGeneration))
+        {
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+}
+
+void Engine::ClearDirtyPaths()
+{
+    mGlobalDirtySet.ReleaseAll();
+#if CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS > 0
+    mDirtyAttributePaths.Clear();
+#endif
+}
+
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
@@ -1128,6 +1143,16 @@ CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
     {
         return CHIP_NO_ERROR;
     }
+
+#if CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS > 0
+    if (!aAttributePath.IsWildcardPath())
+    {
+        // The list index does not matter: reports always carry whole attributes.
+        ConcreteAttributePath path(aAttributePath.mEndpointId, aAttributePath.mClusterId, aAttributePath.mAttributeId);
+        VerifyOrReturnError(!mDirtyAttributePaths.Mark(path, GetDirtySetGeneration()), CHIP_NO_ERROR);
+    }
+#endif
+
     ReturnErrorOnFailure(InsertPathIntoDirtySet(aAttributePath));
 
     return CHIP_NO_ERROR;
@@ -29,6 +29,7 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/DirtyAttributePathTable.h>
 #include <app/reporting/Generations.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
@@ -237,6 +238,17 @@ private:
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
+    /**
+     * Returns whether the concrete path was marked dirty after the given generation, either on its own or as part of a
+     * wildcard path in the global dirty set.
+     */
+    bool IsAttributePathDirtySince(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration);
+
+    /**
+     * Forget all dirty paths.
+     */
+    void ClearDirtyPaths();
+
     inline void BumpDirtySetGeneration() { mDirtyGeneration.Increment(); }
 
     /**
@@ -274,6 +286,15 @@ private:
     ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
 #endif
 
+#if CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS > 0
+    /**
+     *  mDirtyAttributePaths tracks concrete attribute paths marked dirty individually, so that a burst of changes to many
+     *  attributes does not exhaust mGlobalDirtySet and get merged into wildcards. Paths that do not fit go to mGlobalDirtySet.
+     *
+     */
+    DirtyAttributePathTable<CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS> mDirtyAttributePaths;
+#endif
+
     /**
      * A generation counter for the dirty attrbute set.
      * ReadHandlers can save the generation value when generating reports.
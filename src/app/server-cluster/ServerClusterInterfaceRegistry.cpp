@@ -22,6 +22,9 @@
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+
+#include <algorithm>
+#include <cstring>
 #include <optional>
 
 namespace chip {
@@ -60,11 +63,16 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
         VerifyOrReturnError(Get(path) == nullptr, CHIP_ERROR_DUPLICATE_KEY_ID);
     }
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    ReturnErrorOnFailure(AddToIndex(*entry.serverClusterInterface));
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
     if (mContext.has_value())
     {
         // To preserve similarity with SetContext, do not fail the register even if Startup fails.
         // This will cause Shutdown to be called for both successful and failed startups.
         LogErrorOnFailure(entry.serverClusterInterface->Startup(*mContext));
+        mContext->provider.IncreaseMetadataStructureGeneration();
     }
 
     entry.next     = mRegistrations;
@@ -98,11 +106,15 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
             {
                 mCachedInterface = nullptr;
             }
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+            RemoveFromIndex(current->serverClusterInterface);
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
 
             current->next = nullptr; // Make sure current does not look like part of a list.
             if (mContext.has_value())
             {
                 current->serverClusterInterface->Shutdown(clusterShutdownType);
+                mContext->provider.IncreaseMetadataStructureGeneration();
             }
 
             return CHIP_NO_ERROR;
@@ -123,6 +135,14 @@ ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClust
         return mCachedInterface;
     }
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    ServerClusterInterface * found = FindInIndex(clusterPath);
+    if (found != nullptr)
+    {
+        mCachedInterface = found;
+    }
+    return found;
+#else
     // The cluster searched for is not cached, do a linear search for it
     ServerClusterRegistration * current = mRegistrations;
 
@@ -139,6 +159,7 @@ ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClust
 
     // not found
     return nullptr;
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
 }
 
 CHIP_ERROR ServerClusterInterfaceRegistry::SetContext(ServerClusterContext && context)
@@ -199,5 +220,74 @@ ServerClusterInterfaceRegistry::ServerClusterInstances ServerClusterInterfaceReg
     return { mRegistrations };
 }
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
+size_t ServerClusterInterfaceRegistry::IndexLowerBound(uint64_t key) const
+{
+    const IndexEntry * begin = mIndex.Get();
+    const IndexEntry * end   = begin + mIndexSize;
+    return static_cast<size_t>(
+        std::lower_bound(begin, end, key, [](const IndexEntry & entry, uint64_t value) { return entry.key < value; }) - begin);
+}
+
+CHIP_ERROR ServerClusterInterfaceRegistry::AddToIndex(ServerClusterInterface & interface)
+{
+    Span<const ConcreteClusterPath> paths = interface.GetPaths();
+
+    if (mIndexSize + paths.size() > mIndex.AllocatedSize())
+    {
+        // Grow geometrically so that registering N clusters costs O(N) copies overall.
+        const size_t capacity = std::max({ mIndex.AllocatedSize() * 2, mIndexSize + paths.size(), static_cast<size_t>(16) });
+
+        Platform::ScopedMemoryBufferWithSize<IndexEntry> grown;
+        VerifyOrReturnError(grown.Alloc(capacity), CHIP_ERROR_NO_MEMORY);
+        if (mIndexSize > 0)
+        {
+            memcpy(grown.Get(), mIndex.Get(), mIndexSize * sizeof(IndexEntry));
+        }
+        mIndex = std::move(grown);
+    }
+
+    for (const ConcreteClusterPath & path : paths)
+    {
+        const uint64_t key = IndexKey(path);
+        const size_t pos   = IndexLowerBound(key);
+        memmove(&mIndex[pos + 1], &mIndex[pos], (mIndexSize - pos) * sizeof(IndexEntry));
+        mIndex[pos] = { key, &interface };
+        mIndexSize++;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ServerClusterInterfaceRegistry::RemoveFromIndex(ServerClusterInterface * interface)
+{
+    // Match on the interface rather than on its current paths, so that entries are removed
+    // even if GetPaths() changed since registration.
+    auto isRemoved     = [interface](const IndexEntry & entry) { return entry.serverClusterInterface == interface; };
+    IndexEntry * begin = mIndex.Get();
+    IndexEntry * end   = std::remove_if(begin, begin + mIndexSize, isRemoved);
+    mIndexSize         = static_cast<size_t>(end - begin);
+}
+
+void ServerClusterInterfaceRegistry::RemoveEndpointFromIndex(EndpointId endpointId)
+{
+    const size_t first = IndexLowerBound(static_cast<uint64_t>(endpointId) << 32);
+    const size_t last  = IndexLowerBound((static_cast<uint64_t>(endpointId) + 1) << 32);
+    VerifyOrReturn(first != last);
+
+    memmove(&mIndex[first], &mIndex[last], (mIndexSize - last) * sizeof(IndexEntry));
+    mIndexSize -= last - first;
+}
+
+ServerClusterInterface * ServerClusterInterfaceRegistry::FindInIndex(const ConcreteClusterPath & path) const
+{
+    const uint64_t key = IndexKey(path);
+    const size_t pos   = IndexLowerBound(key);
+    return (pos < mIndexSize && mIndex[pos].key == key) ? mIndex[pos].serverClusterInterface : nullptr;
+}
+
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
 } // namespace app
 } // namespace chip
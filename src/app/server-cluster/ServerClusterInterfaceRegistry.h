@@ -20,7 +20,9 @@
 #include <app/ConcreteClusterPath.h>
 #include <app/server-cluster/ServerClusterInterface.h>
 #include <lib/core/CHIPError.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/DataModelTypes.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/logging/CHIPLogging.h>
 
 #include <cstdint>
@@ -156,6 +158,9 @@ public:
     ///   - LIFETIME of entry must outlive the Registry (or entry must be unregistered)
     ///
     /// There can be only a single registration for a given `endpointId/clusterId` path.
+    ///
+    /// With CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX, this may also fail with CHIP_ERROR_NO_MEMORY
+    /// if the path index cannot be grown.
     [[nodiscard]] CHIP_ERROR Register(ServerClusterRegistration & entry);
 
     /// Remove an existing registration
@@ -224,8 +229,39 @@ protected:
     // The endpointId specifies which endpoint the cache belongs to.
     ServerClusterInterface * mCachedInterface = nullptr;
 
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    /// Removes all index entries for paths on the given endpoint. Used by subclasses that
+    /// unlink registrations themselves.
+    void RemoveEndpointFromIndex(EndpointId endpointId);
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
+
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+private:
+    // Every registered path, sorted by (endpoint, cluster), so that Get() is a binary search rather
+    // than a walk over all registrations.
+    struct IndexEntry
+    {
+        uint64_t key;
+        ServerClusterInterface * serverClusterInterface;
+    };
+
+    static constexpr uint64_t IndexKey(const ConcreteClusterPath & path)
+    {
+        return (static_cast<uint64_t>(path.mEndpointId) << 32) | path.mClusterId;
+    }
+
+    // Returns the position of the first entry whose key is not less than `key`.
+    size_t IndexLowerBound(uint64_t key) const;
+    CHIP_ERROR AddToIndex(ServerClusterInterface & interface);
+    void RemoveFromIndex(ServerClusterInterface * interface);
+    ServerClusterInterface * FindInIndex(const ConcreteClusterPath & path) const;
+
+    Platform::ScopedMemoryBufferWithSize<IndexEntry> mIndex;
+    size_t mIndexSize = 0;
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
 };
 
 } // namespace app
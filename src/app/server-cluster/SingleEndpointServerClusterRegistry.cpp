@@ -49,6 +49,12 @@ SingleEndpointServerClusterRegistry::ClustersList SingleEndpointServerClusterReg
 
 void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId endpointId, ClusterShutdownType clusterShutdownType)
 {
+#if CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+    // Every path of a registration is on the same endpoint, so the endpoint's index range covers exactly the
+    // registrations removed below.
+    RemoveEndpointFromIndex(endpointId);
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
     ServerClusterRegistration * prev    = nullptr;
     ServerClusterRegistration * current = mRegistrations;
     while (current != nullptr)
@@ -26,10 +26,14 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <memory>
+#include <vector>
 
 using namespace chip;
 using namespace chip::Testing;
@@ -405,3 +409,123 @@ TEST_F(TestServerClusterInterfaceRegistry, StartupShutdownWithoutContext)
     EXPECT_EQ(cluster2.Cluster().GetShutdownCallCount(), 1u);
     EXPECT_EQ(cluster3.Cluster().GetShutdownCallCount(), 1u);
 }
+
+namespace {
+
+// Registers `count` single-path clusters spread like a bridge: 10 clusters on each of count / 10 endpoints.
+class BridgeLikeRegistrations
+{
+public:
+    BridgeLikeRegistrations(ServerClusterInterfaceRegistry & registry, size_t count) : mRegistry(registry)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            const ConcreteClusterPath path = PathFor(i);
+            mClusters.push_back(
+                std::make_unique<RegisteredServerCluster<FakeServerClusterInterface>>(path.mEndpointId, path.mClusterId));
+            EXPECT_EQ(mRegistry.Register(mClusters.back()->Registration()), CHIP_NO_ERROR);
+        }
+    }
+
+    ~BridgeLikeRegistrations()
+    {
+        for (auto & cluster : mClusters)
+        {
+            // Tests may already have unregistered some of the clusters.
+            RETURN_SAFELY_IGNORED mRegistry.Unregister(&cluster->Cluster());
+        }
+    }
+
+    static ConcreteClusterPath PathFor(size_t i)
+    {
+        return { static_cast<EndpointId>(i / 10 + 1), static_cast<ClusterId>(i % 10 + 1) };
+    }
+
+    FakeServerClusterInterface & Cluster(size_t i) { return mClusters[i]->Cluster(); }
+
+private:
+    ServerClusterInterfaceRegistry & mRegistry;
+    std::vector<std::unique_ptr<RegisteredServerCluster<FakeServerClusterInterface>>> mClusters;
+};
+
+} // namespace
+
+TEST_F(TestServerClusterInterfaceRegistry, GetAfterRegisterAndUnregister)
+{
+    constexpr size_t kCount = 200;
+
+    ServerClusterInterfaceRegistry registry;
+    BridgeLikeRegistrations clusters(registry, kCount);
+
+    const std::array<ConcreteClusterPath, 3> kMultiPaths{ {
+        { 500, 1 },
+        { 3, 0xFFF1FC00 },
+        { 501, 7 },
+    } };
+    MultiPathCluster multiPathCluster(kMultiPaths);
+    ServerClusterRegistration multiPathRegistration(multiPathCluster);
+    ASSERT_EQ(registry.Register(multiPathRegistration), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        ASSERT_EQ(registry.Get(BridgeLikeRegistrations::PathFor(i)), &clusters.Cluster(i));
+    }
+    for (const auto & path : kMultiPaths)
+    {
+        EXPECT_EQ(registry.Get(path), &multiPathCluster);
+    }
+    EXPECT_EQ(registry.Get({ 3, 11 }), nullptr);
+    EXPECT_EQ(registry.Get({ 500, 2 }), nullptr);
+    EXPECT_EQ(registry.Get({ 1000, 1 }), nullptr);
+
+    // Unregister every third cluster, including the cached one.
+    EXPECT_EQ(registry.Get(BridgeLikeRegistrations::PathFor(0)), &clusters.Cluster(0));
+    for (size_t i = 0; i < kCount; i += 3)
+    {
+        EXPECT_EQ(registry.Unregister(&clusters.Cluster(i)), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(registry.Unregister(&multiPathCluster), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        ASSERT_EQ(registry.Get(BridgeLikeRegistrations::PathFor(i)), (i % 3 == 0) ? nullptr : &clusters.Cluster(i));
+    }
+    for (const auto & path : kMultiPaths)
+    {
+        EXPECT_EQ(registry.Get(path), nullptr);
+    }
+
+    // Paths of unregistered clusters can be registered again.
+    EXPECT_EQ(registry.Register(multiPathRegistration), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Get(kMultiPaths[1]), &multiPathCluster);
+    EXPECT_EQ(registry.Unregister(&multiPathCluster), CHIP_NO_ERROR);
+}
+
+// Benchmark: cost of Get() for the mixed paths of a wildcard read or a busy controller (so the
+// one-entry cache mostly misses) as a function of the number of registered clusters.
+TEST_F(TestServerClusterInterfaceRegistry, BenchmarkGet)
+{
+    constexpr size_t kLookups = 100000;
+
+    for (size_t count : { 10u, 100u, 1000u })
+    {
+        ServerClusterInterfaceRegistry registry;
+        BridgeLikeRegistrations clusters(registry, count);
+
+        size_t found = 0;
+        auto start   = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kLookups; i++)
+        {
+            // Stride through the registrations with a prime so consecutive lookups hit different clusters.
+            if (registry.Get(BridgeLikeRegistrations::PathFor((i * 7919) % count)) != nullptr)
+            {
+                found++;
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        EXPECT_EQ(found, kLookups);
+        ChipLogProgress(Test, "%u registered clusters: %u ns per Get()", static_cast<unsigned>(count),
+                        static_cast<unsigned>(elapsed.count() / static_cast<long long>(kLookups)));
+    }
+}
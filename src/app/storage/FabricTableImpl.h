@@ -19,6 +19,8 @@
 
 #include <app/data-model-provider/ProviderMetadataTree.h>
 #include <app/storage/TableEntry.h>
+#include <app/storage/WriteBackStorageCache.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/support/CommonIterator.h>
 #include <lib/support/PersistentData.h>
 #include <lib/support/TypeTraits.h>
@@ -95,6 +97,14 @@ public:
     CHIP_ERROR Init(PersistentStorageDelegate & storage);
     void Finish();
 
+    /**
+     * @brief Sets the number of heap bytes the table may use to cache the values it reads from and writes to storage, which takes
+     * effect on the next Init. Defaults to CHIP_CONFIG_FABRIC_TABLE_CACHE_BYTES; 0 disables the cache.
+     *
+     * With a cache, nothing else may modify the storage keys of the table, including other tables on the same storage.
+     */
+    void SetCacheBudget(size_t budgetBytes) { mCacheBudget = budgetBytes; }
+
     // Entry count
     /**
      * @brief Get the total number of stored entries for the entire endpoint
@@ -210,6 +220,10 @@ protected:
     uint16_t mMaxPerEndpoint;
     EndpointId mEndpointId               = kInvalidEndpointId;
     PersistentStorageDelegate * mStorage = nullptr;
+
+    // mStorage points to mCache when the cache is enabled. Operations writing several keys run in mCache.CoalesceWrites().
+    WriteBackStorageCache mCache;
+    size_t mCacheBudget = CHIP_CONFIG_FABRIC_TABLE_CACHE_BYTES;
 }; // class FabricTableImpl
 
 } // namespace Storage
@@ -518,13 +518,29 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::Init(PersistentStorageDelega
     // Verify the initialized parameter respects the maximum allowed values for entry capacity
     VerifyOrReturnError(mMaxPerFabric <= Serializer::kMaxPerFabric() && mMaxPerEndpoint <= Serializer::kMaxPerEndpoint(),
                         CHIP_ERROR_INVALID_INTEGER_VALUE);
-    this->mStorage = &storage;
+    if (mCacheBudget > 0)
+    {
+        mCache.Init(storage, mCacheBudget);
+        this->mStorage = &mCache;
+    }
+    else
+    {
+        mCache.Shutdown();
+        this->mStorage = &storage;
+    }
     return CHIP_NO_ERROR;
 }
 
 template <class StorageId, class StorageData>
 void FabricTableImpl<StorageId, StorageData>::Finish()
-{}
+{
+    // The table stays usable after Finish, directly on the storage.
+    if (mStorage == &mCache)
+    {
+        mStorage = mCache.GetStorage();
+    }
+    mCache.Shutdown();
+}
 
 template <class StorageId, class StorageData>
 CHIP_ERROR FabricTableImpl<StorageId, StorageData>::GetFabricEntryCount(FabricIndex fabric_index, uint8_t & entry_count)
@@ -616,14 +632,15 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::SetTableEntry(FabricIndex fa
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
-    // Load fabric data (defaults to zero)
-    CHIP_ERROR err = fabric.Load(mStorage);
-    VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
+        // Load fabric data (defaults to zero)
+        CHIP_ERROR err = fabric.Load(mStorage);
+        VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
 
-    err = fabric.SaveEntry(*mStorage, id, data, writeBuffer);
-    return err;
+        return fabric.SaveEntry(*mStorage, id, data, writeBuffer);
+    });
 }
 
 template <class StorageId, class StorageData>
@@ -635,23 +652,26 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::GetTableEntry(FabricIndex fa
                                                  Serializer::kFabricMaxBytes(), Serializer::kMaxPerFabric()>;
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
-    TableEntryData<StorageId, StorageData> table_entry(mEndpointId, fabric_index, entry_id, data);
+    // Loading may remove entries that no longer fit the table
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
+        TableEntryData<StorageId, StorageData> table_entry(mEndpointId, fabric_index, entry_id, data);
 
-    ReturnErrorOnFailure(fabric.Load(mStorage));
-    VerifyOrReturnError(fabric.Find(entry_id, table_entry.index) == CHIP_NO_ERROR, CHIP_ERROR_NOT_FOUND);
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+        VerifyOrReturnError(fabric.Find(entry_id, table_entry.index) == CHIP_NO_ERROR, CHIP_ERROR_NOT_FOUND);
 
-    CHIP_ERROR err = table_entry.Load(mStorage, buffer.BufferSpan());
+        CHIP_ERROR err = table_entry.Load(mStorage, buffer.BufferSpan());
 
-    // If entry.Load returns "buffer too small", the entry in memory is too big to be retrieved (this could happen if the
-    // kEntryMaxBytes was reduced by OTA) and therefore must be deleted as is is no longer considered accessible.
-    if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
-    {
-        ReturnErrorOnFailure(this->RemoveTableEntry(fabric_index, entry_id));
-    }
-    ReturnErrorOnFailure(err);
+        // If entry.Load returns "buffer too small", the entry in memory is too big to be retrieved (this could happen if the
+        // kEntryMaxBytes was reduced by OTA) and therefore must be deleted as is is no longer considered accessible.
+        if (err == CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            ReturnErrorOnFailure(this->RemoveTableEntry(fabric_index, entry_id));
+        }
+        ReturnErrorOnFailure(err);
 
-    return CHIP_NO_ERROR;
+        return CHIP_NO_ERROR;
+    });
 }
 
 template <class StorageId, class StorageData>
@@ -677,11 +697,14 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveTableEntry(FabricIndex
                                                  Serializer::kFabricMaxBytes(), Serializer::kMaxPerFabric()>;
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
-    TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
-    ReturnErrorOnFailure(fabric.Load(mStorage));
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        TypedFabricEntryData fabric(mEndpointId, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
+
+        ReturnErrorOnFailure(fabric.Load(mStorage));
 
-    return fabric.RemoveEntry(*mStorage, entry_id);
+        return fabric.RemoveEntry(*mStorage, entry_id);
+    });
 }
 
 /// @brief This function is meant to provide a way to empty the entry table without knowing any specific entry Id. Outside of this
@@ -698,15 +721,17 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveTableEntryAtPosition(E
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    TypedFabricEntryData fabric(endpoint, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        TypedFabricEntryData fabric(endpoint, fabric_index, mMaxPerFabric, mMaxPerEndpoint);
 
-    ReturnErrorOnFailure(fabric.Load(mStorage));
-    StorageId entryId;
-    CHIP_ERROR err = fabric.FindByIndex(*mStorage, entry_idx, entryId);
-    VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
-    ReturnErrorOnFailure(err);
+        ReturnErrorOnFailure(fabric.Load(mStorage));
+        StorageId entryId;
+        CHIP_ERROR err = fabric.FindByIndex(*mStorage, entry_idx, entryId);
+        VerifyOrReturnValue(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+        ReturnErrorOnFailure(err);
 
-    return fabric.RemoveEntry(*mStorage, entryId);
+        return fabric.RemoveEntry(*mStorage, entryId);
+    });
 }
 
 template <class StorageId, class StorageData>
@@ -721,30 +746,32 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveFabric(DataModel::Prov
     ReadOnlyBufferBuilder<DataModel::EndpointEntry> endpointsBuilder;
     ReturnErrorOnFailure(provider.Endpoints(endpointsBuilder));
 
-    for (const auto & ep : endpointsBuilder.TakeBuffer())
-    {
-        EndpointId endpoint = ep.id;
-        TypedFabricEntryData fabric(endpoint, fabric_index);
-        EntryIndex idx = 0;
-        CHIP_ERROR err = fabric.Load(mStorage);
-        VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
-        if (CHIP_ERROR_NOT_FOUND == err)
-        {
-            continue;
-        }
-
-        while (idx < mMaxPerFabric)
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        for (const auto & ep : endpointsBuilder.TakeBuffer())
         {
-            err = RemoveTableEntryAtPosition(endpoint, fabric_index, idx);
+            EndpointId endpoint = ep.id;
+            TypedFabricEntryData fabric(endpoint, fabric_index);
+            EntryIndex idx = 0;
+            CHIP_ERROR err = fabric.Load(mStorage);
             VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
-            idx++;
-        }
+            if (CHIP_ERROR_NOT_FOUND == err)
+            {
+                continue;
+            }
 
-        // Remove fabric entries on endpoint
-        ReturnErrorOnFailure(fabric.Delete(mStorage));
-    }
+            while (idx < mMaxPerFabric)
+            {
+                err = RemoveTableEntryAtPosition(endpoint, fabric_index, idx);
+                VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
+                idx++;
+            }
 
-    return CHIP_NO_ERROR;
+            // Remove fabric entries on endpoint
+            ReturnErrorOnFailure(fabric.Delete(mStorage));
+        }
+
+        return CHIP_NO_ERROR;
+    });
 }
 
 template <class StorageId, class StorageData>
@@ -755,29 +782,31 @@ CHIP_ERROR FabricTableImpl<StorageId, StorageData>::RemoveEndpoint()
 
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
-    for (FabricIndex fabric_index = kMinValidFabricIndex; fabric_index < kMaxValidFabricIndex; fabric_index++)
-    {
-        TypedFabricEntryData fabric(mEndpointId, fabric_index);
-        CHIP_ERROR err = fabric.Load(mStorage);
-        VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
-        if (CHIP_ERROR_NOT_FOUND == err)
+    return mCache.CoalesceWrites([&]() -> CHIP_ERROR {
+        for (FabricIndex fabric_index = kMinValidFabricIndex; fabric_index < kMaxValidFabricIndex; fabric_index++)
         {
-            continue;
-        }
-
-        EntryIndex idx = 0;
-        while (idx < mMaxPerFabric)
-        {
-            err = RemoveTableEntryAtPosition(mEndpointId, fabric_index, idx);
+            TypedFabricEntryData fabric(mEndpointId, fabric_index);
+            CHIP_ERROR err = fabric.Load(mStorage);
             VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
-            idx++;
-        };
+            if (CHIP_ERROR_NOT_FOUND == err)
+            {
+                continue;
+            }
 
-        // Remove fabric entries on endpoint
-        ReturnErrorOnFailure(fabric.Delete(mStorage));
-    }
+            EntryIndex idx = 0;
+            while (idx < mMaxPerFabric)
+            {
+                err = RemoveTableEntryAtPosition(mEndpointId, fabric_index, idx);
+                VerifyOrReturnError(CHIP_NO_ERROR == err || CHIP_ERROR_NOT_FOUND == err, err);
+                idx++;
+            };
 
-    return CHIP_NO_ERROR;
+            // Remove fabric entries on endpoint
+            ReturnErrorOnFailure(fabric.Delete(mStorage));
+        }
+
+        return CHIP_NO_ERROR;
+    });
 }
 
 template <class StorageId, class StorageData>
@@ -0,0 +1,315 @@
+/**
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/storage/WriteBackStorageCache.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace chip {
+namespace app {
+namespace Storage {
+
+void WriteBackStorageCache::Init(PersistentStorageDelegate & storage, size_t budgetBytes)
+{
+    VerifyOrReturn(mStorage != &storage || mBudgetBytes != budgetBytes);
+
+    Shutdown();
+    mStorage     = &storage;
+    mBudgetBytes = budgetBytes;
+}
+
+void WriteBackStorageCache::Shutdown()
+{
+    VerifyOrReturn(mStorage != nullptr);
+
+    LogErrorOnFailure(Flush());
+    DropAll();
+    mStorage     = nullptr;
+    mBudgetBytes = 0;
+}
+
+CHIP_ERROR WriteBackStorageCache::Flush()
+{
+    // Writing in the order the keys were first written, rather than the order they were used in, keeps the storage consistent
+    // for operations that write a key before the ones that depend on it (e.g. a count before the entries it covers).
+    while (mDirtyCount > 0)
+    {
+        Value * value  = FindOldestDirty();
+        CHIP_ERROR err = Write(*value);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to write cached value of %s: %" CHIP_ERROR_FORMAT, value->mKey, err.Format());
+            return err;
+        }
+        value->mDirty = false;
+        mDirtyCount--;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBackStorageCache::SyncGetKeyValue(const char * key, void * buffer, uint16_t & size)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError((buffer != nullptr) || (size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Value * value = Find(key);
+    if (value == nullptr)
+    {
+        CHIP_ERROR err = mStorage->SyncGetKeyValue(key, buffer, size);
+        if (err == CHIP_NO_ERROR)
+        {
+            Put(key, true, buffer, size);
+        }
+        else if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+        {
+            Put(key, false, nullptr, 0);
+        }
+        return err;
+    }
+
+    VerifyOrReturnError(value->mExists, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    VerifyOrReturnError(size != 0 || value->mSize != 0, CHIP_NO_ERROR);
+    VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    size = std::min(size, value->mSize);
+    memcpy(buffer, value->Bytes(), size);
+    return (size < value->mSize) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBackStorageCache::SyncSetKeyValue(const char * key, const void * bytes, uint16_t size)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError((bytes != nullptr) || (size == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    Value * value = Find(key);
+    if (value != nullptr && value->mExists && value->mSize == size && (size == 0 || memcmp(value->Bytes(), bytes, size) == 0))
+    {
+        // Already stored, or about to be.
+        return CHIP_NO_ERROR;
+    }
+
+    if (mCoalesceDepth > 0)
+    {
+        if (PutDirty(value, key, true, bytes, size) != nullptr)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // The values written before must reach the storage first.
+    ReturnErrorOnFailure(Flush());
+
+    CHIP_ERROR err = mStorage->SyncSetKeyValue(key, bytes, size);
+    if (err == CHIP_NO_ERROR)
+    {
+        Put(key, true, bytes, size);
+    }
+    else
+    {
+        // The storage may hold either value now.
+        Drop(Find(key));
+    }
+    return err;
+}
+
+CHIP_ERROR WriteBackStorageCache::SyncDeleteKeyValue(const char * key)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    Value * value = Find(key);
+    VerifyOrReturnError(value == nullptr || value->mExists, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+
+    bool exists = (value != nullptr);
+
+    if (exists && mCoalesceDepth > 0)
+    {
+        if (PutDirty(value, key, false, nullptr, 0) != nullptr)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+
+    // The values written before must reach the storage first.
+    ReturnErrorOnFailure(Flush());
+
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(key);
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND && exists)
+    {
+        // The value was written while coalescing, and not to the storage yet.
+        err = CHIP_NO_ERROR;
+    }
+
+    if (err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        Put(key, false, nullptr, 0);
+    }
+    else
+    {
+        Drop(Find(key));
+    }
+    return err;
+}
+
+bool WriteBackStorageCache::SyncDoesKeyExist(const char * key)
+{
+    VerifyOrReturnValue(mStorage != nullptr, false);
+
+    // A false answer is not cached as a missing key, since it is also given on storage errors.
+    Value * value = Find(key);
+    return (value != nullptr) ? value->mExists : mStorage->SyncDoesKeyExist(key);
+}
+
+uint32_t WriteBackStorageCache::HashKey(const char * key)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (; *key != '\0'; key++)
+    {
+        hash = (hash ^ static_cast<uint8_t>(*key)) * 16777619u;
+    }
+    return hash;
+}
+
+WriteBackStorageCache::Value * WriteBackStorageCache::Find(const char * key)
+{
+    uint32_t hash = HashKey(key);
+    for (auto & value : mValues)
+    {
+        if (value.mHash == hash && strcmp(value.mKey, key) == 0)
+        {
+            mValues.Remove(&value);
+            mValues.PushFront(&value);
+            return &value;
+        }
+    }
+    return nullptr;
+}
+
+WriteBackStorageCache::Value * WriteBackStorageCache::Put(const char * key, bool exists, const void * bytes, uint16_t size)
+{
+    Drop(Find(key));
+
+    size_t keyLength  = strlen(key);
+    size_t valueBytes = sizeof(Value) + size;
+    VerifyOrReturnValue(keyLength <= kKeyLengthMax && valueBytes <= mBudgetBytes, nullptr);
+    VerifyOrReturnValue(MakeRoom(valueBytes) == CHIP_NO_ERROR, nullptr);
+
+    void * memory = Platform::MemoryAlloc(valueBytes);
+    VerifyOrReturnValue(memory != nullptr, nullptr);
+
+    Value * value  = new (memory) Value();
+    value->mHash   = HashKey(key);
+    value->mSize   = size;
+    value->mExists = exists;
+    value->mDirty  = false;
+    memcpy(value->mKey, key, keyLength + 1);
+    if (size > 0)
+    {
+        memcpy(value->Bytes(), bytes, size);
+    }
+
+    mValues.PushFront(value);
+    mUsedBytes += valueBytes;
+    return value;
+}
+
+WriteBackStorageCache::Value * WriteBackStorageCache::PutDirty(Value * previous, const char * key, bool exists, const void * bytes,
+                                                              uint16_t size)
+{
+    uint32_t dirtySequence = (previous != nullptr && previous->mDirty) ? previous->mDirtySequence : mNextDirtySequence++;
+
+    Value * value = Put(key, exists, bytes, size);
+    VerifyOrReturnValue(value != nullptr, nullptr);
+
+    value->mDirty         = true;
+    value->mDirtySequence = dirtySequence;
+    mDirtyCount++;
+    return value;
+}
+
+WriteBackStorageCache::Value * WriteBackStorageCache::FindOldestDirty()
+{
+    Value * oldest = nullptr;
+    for (auto & value : mValues)
+    {
+        // Compares the sequence numbers modulo 2^32, so that they may wrap around.
+        if (value.mDirty && (oldest == nullptr || static_cast<int32_t>(value.mDirtySequence - oldest->mDirtySequence) < 0))
+        {
+            oldest = &value;
+        }
+    }
+    return oldest;
+}
+
+CHIP_ERROR WriteBackStorageCache::MakeRoom(size_t bytes)
+{
+    while (mUsedBytes + bytes > mBudgetBytes && !mValues.Empty())
+    {
+        auto leastRecentlyUsed = mValues.end();
+        --leastRecentlyUsed;
+
+        if (leastRecentlyUsed->mDirty)
+        {
+            // Writing all the dirty values at once keeps them coalesced as much as possible.
+            ReturnErrorOnFailure(Flush());
+            continue;
+        }
+        Drop(&*leastRecentlyUsed);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteBackStorageCache::Write(Value & value)
+{
+    if (value.mExists)
+    {
+        return mStorage->SyncSetKeyValue(value.mKey, value.Bytes(), value.mSize);
+    }
+    return mStorage->SyncDeleteKeyValue(value.mKey).NoErrorIf(CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+void WriteBackStorageCache::Drop(Value * value)
+{
+    VerifyOrReturn(value != nullptr);
+
+    mValues.Remove(value);
+    mUsedBytes -= sizeof(Value) + value->mSize;
+    if (value->mDirty)
+    {
+        mDirtyCount--;
+    }
+    value->~Value();
+    Platform::MemoryFree(value);
+}
+
+void WriteBackStorageCache::DropAll()
+{
+    while (!mValues.Empty())
+    {
+        Drop(&*mValues.begin());
+    }
+}
+
+} // namespace Storage
+} // namespace app
+} // namespace chip
@@ -0,0 +1,152 @@
+/**
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/support/IntrusiveList.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+namespace Storage {
+
+/**
+ * @brief A PersistentStorageDelegate that keeps the values read from and written to another one in RAM.
+ *
+ * Values, and keys that do not exist, are cached up to a budget of heap bytes; the least recently used ones are dropped when it
+ * is exceeded. Values larger than the budget are not cached.
+ *
+ * Writes go through to the storage, unless made in CoalesceWrites(): these are held in RAM (dirty) and written when it returns,
+ * once per key, so that an operation which rewrites the same keys several times writes each of them once. Writing a value that
+ * is already stored does not write to the storage.
+ *
+ * Since values are not read again from the storage, nothing else may modify the keys accessed through the cache.
+ */
+class WriteBackStorageCache : public PersistentStorageDelegate
+{
+public:
+    WriteBackStorageCache() = default;
+    ~WriteBackStorageCache() override { Shutdown(); }
+
+    WriteBackStorageCache(const WriteBackStorageCache &)             = delete;
+    WriteBackStorageCache & operator=(const WriteBackStorageCache &) = delete;
+
+    /**
+     * @brief Caches the values of `storage`, using at most `budgetBytes` of heap. Keeps the cached values if already initialized
+     * with the same storage and budget.
+     */
+    void Init(PersistentStorageDelegate & storage, size_t budgetBytes);
+
+    /**
+     * @brief Writes the dirty values to the storage and drops all the cached values.
+     */
+    void Shutdown();
+
+    bool IsInitialized() const { return mStorage != nullptr; }
+    PersistentStorageDelegate * GetStorage() const { return mStorage; }
+
+    /**
+     * @brief Calls `func` (returning CHIP_ERROR), holding its writes in RAM, then writes them to the storage.
+     *
+     * Calls may be nested; the writes are made when the outermost one returns, in the order the keys were first written. The
+     * writes are made even if `func` fails, the same as they would have been without the cache.
+     *
+     * @return the error returned by `func` if it failed, else the error writing the values, if any.
+     */
+    template <typename Func>
+    CHIP_ERROR CoalesceWrites(Func && func)
+    {
+        mCoalesceDepth++;
+        CHIP_ERROR err = func();
+        mCoalesceDepth--;
+        if (mCoalesceDepth == 0)
+        {
+            CHIP_ERROR flushErr = Flush();
+            err                 = (err == CHIP_NO_ERROR) ? flushErr : err;
+        }
+        return err;
+    }
+
+    /**
+     * @brief Writes the dirty values to the storage, in the order they were first made dirty. Stops at the first write that
+     * fails: that value and the ones after it stay dirty, and are written by the next call.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     * @brief Returns the number of heap bytes used by the cached values.
+     */
+    size_t GetUsedBytes() const { return mUsedBytes; }
+
+    // PersistentStorageDelegate
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override;
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override;
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override;
+    bool SyncDoesKeyExist(const char * key) override;
+
+private:
+    struct Value : public IntrusiveListNodeBase<>
+    {
+        uint32_t mHash;
+        uint16_t mSize;
+        bool mExists;            // false if the key is known not to exist
+        bool mDirty;             // true if the value (or its deletion) was not written to the storage yet
+        uint32_t mDirtySequence; // orders the dirty values by when they were first made dirty
+        char mKey[kKeyLengthMax + 1];
+
+        uint8_t * Bytes() { return reinterpret_cast<uint8_t *>(this + 1); }
+    };
+
+    static uint32_t HashKey(const char * key);
+
+    // Returns the cached value of `key` and marks it most recently used, or nullptr.
+    Value * Find(const char * key);
+
+    // Caches `size` bytes of `bytes` (or that the key does not exist, if `exists` is false) as the value of `key`, replacing its
+    // cached value, if any. Returns nullptr if the value cannot be cached, in which case any previous value was dropped.
+    Value * Put(const char * key, bool exists, const void * bytes, uint16_t size);
+
+    // Same as Put(), and marks the value dirty. If `previous`, the cached value of `key` (or nullptr), was dirty, the value keeps
+    // its place in the order of the writes.
+    Value * PutDirty(Value * previous, const char * key, bool exists, const void * bytes, uint16_t size);
+
+    // Returns the value that was made dirty first, or nullptr.
+    Value * FindOldestDirty();
+
+    // Drops values, least recently used first, until `bytes` more fit in the budget, writing the dirty values first.
+    CHIP_ERROR MakeRoom(size_t bytes);
+
+    CHIP_ERROR Write(Value & value);
+    void Drop(Value * value);
+    void DropAll();
+
+    PersistentStorageDelegate * mStorage = nullptr;
+    IntrusiveList<Value> mValues; // most recently used first
+    size_t mBudgetBytes         = 0;
+    size_t mUsedBytes           = 0;
+    size_t mDirtyCount          = 0;
+    uint32_t mNextDirtySequence = 0;
+    unsigned mCoalesceDepth     = 0;
+};
+
+} // namespace Storage
+} // namespace app
+} // namespace chip
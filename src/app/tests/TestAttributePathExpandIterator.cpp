@@ -32,6 +32,10 @@
 #include <lib/support/LinkedList.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+#include <chrono>
+#include <vector>
 
 using namespace chip;
 using namespace chip::Testing;
@@ -519,4 +523,299 @@ TEST_F(TestAttributePathExpandIterator, TestMultipleClusInfo)
     }
 }
 
+#if CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
+/// A data model of `endpointCount` endpoints with `clusterCount` server clusters of `attributeCount`
+/// attributes each, as exposed by a bridge, which counts how often its metadata is fetched.
+class SyntheticProvider : public DataModel::Provider
+{
+public:
+    SyntheticProvider(EndpointId endpointCount, ClusterId clusterCount, AttributeId attributeCount) :
+        mEndpointCount(endpointCount), mClusterCount(clusterCount), mAttributeCount(attributeCount)
+    {}
+
+    size_t AttributeCount() const { return size_t{ mEndpointCount } * mClusterCount * mAttributeCount; }
+
+    CHIP_ERROR Endpoints(ReadOnlyBufferBuilder<DataModel::EndpointEntry> & builder) override
+    {
+        mMetadataFetches++;
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(mEndpointCount));
+        for (EndpointId id = 1; id <= mEndpointCount; id++)
+        {
+            ReturnErrorOnFailure(builder.Append({ id, kInvalidEndpointId, DataModel::EndpointCompositionPattern::kFullFamily }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ServerClusters(EndpointId endpointId, ReadOnlyBufferBuilder<DataModel::ServerClusterEntry> & builder) override
+    {
+        mMetadataFetches++;
+        VerifyOrReturnError(endpointId >= 1 && endpointId <= mEndpointCount, CHIP_ERROR_NOT_FOUND);
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(mClusterCount));
+        for (ClusterId id = 1; id <= mClusterCount; id++)
+        {
+            ReturnErrorOnFailure(builder.Append({ id, 0, BitFlags<DataModel::ClusterQualityFlags>() }));
+        }
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override
+    {
+        mMetadataFetches++;
+        VerifyOrReturnError(path.mEndpointId >= 1 && path.mEndpointId <= mEndpointCount, CHIP_ERROR_NOT_FOUND);
+        VerifyOrReturnError(path.mClusterId >= 1 && path.mClusterId <= mClusterCount, CHIP_ERROR_NOT_FOUND);
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(mAttributeCount));
+        for (AttributeId id = 0; id < mAttributeCount; id++)
+        {
+            ReturnErrorOnFailure(
+                builder.Append({ id, BitMask<DataModel::AttributeQualityFlags>(), Access::Privilege::kView, std::nullopt }));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR DeviceTypes(EndpointId, ReadOnlyBufferBuilder<DataModel::DeviceTypeEntry> &) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR ClientClusters(EndpointId, ReadOnlyBufferBuilder<ClusterId> &) override { return CHIP_NO_ERROR; }
+#if CHIP_CONFIG_USE_ENDPOINT_UNIQUE_ID
+    CHIP_ERROR EndpointUniqueID(EndpointId, MutableCharSpan &) override { return CHIP_ERROR_NOT_FOUND; }
+#endif
+    CHIP_ERROR EventInfo(const ConcreteEventPath &, DataModel::EventEntry &) override { return CHIP_ERROR_NOT_FOUND; }
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath &, ReadOnlyBufferBuilder<CommandId> &) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath &, ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> &) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest &, AttributeValueEncoder &) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedAttribute;
+    }
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest &, AttributeValueDecoder &) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedAttribute;
+    }
+    void ListAttributeWriteNotification(const ConcreteAttributePath &, DataModel::ListWriteOperation, FabricIndex) override {}
+    std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest &, TLV::TLVReader &,
+                                                               CommandHandler *) override
+    {
+        return Protocols::InteractionModel::Status::UnsupportedCommand;
+    }
+
+    EndpointId mEndpointCount;
+    ClusterId mClusterCount;
+    AttributeId mAttributeCount;
+    size_t mMetadataFetches = 0;
+};
+
+/// Expands `paths` the way a report engine does: a new iterator for every chunk of `chunkSize`
+/// paths, resuming from the position the previous chunk stopped at.
+std::vector<ConcreteAttributePath> ExpandInChunks(DataModel::Provider * provider, SingleLinkedListNode<AttributePathParams> * paths,
+                                                  AttributePathExpansionCache * cache, size_t chunkSize)
+{
+    std::vector<ConcreteAttributePath> expansion;
+    auto position = AttributePathExpandIterator::Position::StartIterating(paths);
+    bool done     = false;
+    while (!done)
+    {
+        RollbackAttributePathExpandIterator iterator(provider, position, cache);
+        ConcreteAttributePath path;
+        for (size_t i = 0; i < chunkSize; i++, iterator.MarkCompleted())
+        {
+            if (!iterator.Next(path))
+            {
+                done = true;
+                break;
+            }
+            expansion.push_back(path);
+        }
+    }
+    return expansion;
+}
+
+TEST_F(TestAttributePathExpandIterator, TestCachedExpansionMatchesDataModel)
+{
+    // Same paths as TestMultipleClusInfo: wildcards at every level, fixed paths and overlaps
+    SingleLinkedListNode<app::AttributePathParams> clusInfo1;
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo2;
+    clusInfo2.mValue.mClusterId   = MockClusterId(3);
+    clusInfo2.mValue.mAttributeId = MockAttributeId(3);
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo3;
+    clusInfo3.mValue.mEndpointId  = kMockEndpoint3;
+    clusInfo3.mValue.mAttributeId = app::Clusters::Globals::Attributes::ClusterRevision::Id;
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo4;
+    clusInfo4.mValue.mEndpointId = kMockEndpoint2;
+    clusInfo4.mValue.mClusterId  = MockClusterId(3);
+
+    SingleLinkedListNode<app::AttributePathParams> clusInfo5;
+    clusInfo5.mValue.mEndpointId  = kMockEndpoint2;
+    clusInfo5.mValue.mClusterId   = MockClusterId(3);
+    clusInfo5.mValue.mAttributeId = MockAttributeId(3);
+
+    // a fixed path that is not part of the data model is still returned
+    SingleLinkedListNode<app::AttributePathParams> clusInfo6;
+    clusInfo6.mValue.mEndpointId  = 1;
+    clusInfo6.mValue.mClusterId   = 122344;
+    clusInfo6.mValue.mAttributeId = 122333;
+
+    clusInfo1.mpNext = &clusInfo2;
+    clusInfo2.mpNext = &clusInfo3;
+    clusInfo3.mpNext = &clusInfo4;
+    clusInfo4.mpNext = &clusInfo5;
+    clusInfo5.mpNext = &clusInfo6;
+
+    DataModel::Provider * provider = CodegenDataModelProviderInstance(&gStorageDelegate);
+    const std::vector<ConcreteAttributePath> expected =
+        ExpandInChunks(provider, &clusInfo1, nullptr, std::numeric_limits<size_t>::max());
+    ASSERT_FALSE(expected.empty());
+    if (expected.size() > AttributePathExpansionCache::kMaxPaths)
+    {
+        GTEST_SKIP() << "Skipping test: expansion does not fit the cache";
+    }
+
+    AttributePathExpansionCache cache;
+    for (size_t chunkSize : { std::numeric_limits<size_t>::max(), size_t{ 1 }, size_t{ 7 } })
+    {
+        std::vector<ConcreteAttributePath> expansion = ExpandInChunks(provider, &clusInfo1, &cache, chunkSize);
+        ASSERT_EQ(expansion.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++)
+        {
+            EXPECT_EQ(expansion[i], expected[i]);
+            EXPECT_EQ(expansion[i].mExpanded, expected[i].mExpanded);
+        }
+        EXPECT_EQ(cache.Size(), expected.size());
+    }
+
+    // Resetting to the start of the current cluster goes back to the same path with or without the cache
+    auto position = AttributePathExpandIterator::Position::StartIterating(&clusInfo1);
+    ConcreteAttributePath path;
+    for (size_t i = 0; i < 8; i++)
+    {
+        ASSERT_TRUE(AttributePathExpandIterator(provider, position, &cache).Next(path));
+    }
+    position.IterateFromTheStartOfTheCurrentClusterIfAttributeWildcard();
+
+    auto uncachedPosition = position;
+    ConcreteAttributePath uncachedPath;
+    ASSERT_TRUE(AttributePathExpandIterator(provider, position, &cache).Next(path));
+    ASSERT_TRUE(AttributePathExpandIterator(provider, uncachedPosition).Next(uncachedPath));
+    EXPECT_EQ(path, uncachedPath);
+    EXPECT_EQ(path, expected[5]);
+}
+
+TEST_F(TestAttributePathExpandIterator, TestCachedExpansionFollowsStructureChanges)
+{
+    SyntheticProvider provider(3, 2, 5);
+    SingleLinkedListNode<app::AttributePathParams> wildcard;
+    if (provider.AttributeCount() > AttributePathExpansionCache::kMaxPaths)
+    {
+        GTEST_SKIP() << "Skipping test: expansion does not fit the cache";
+    }
+    provider.mAttributeCount = 4;
+
+    AttributePathExpansionCache cache;
+    EXPECT_EQ(ExpandInChunks(&provider, &wildcard, &cache, 5).size(), provider.AttributeCount());
+    EXPECT_EQ(cache.Size(), provider.AttributeCount());
+
+    // Further expansions do not go through the data model
+    provider.mMetadataFetches = 0;
+    EXPECT_EQ(ExpandInChunks(&provider, &wildcard, &cache, 5).size(), provider.AttributeCount());
+    EXPECT_EQ(provider.mMetadataFetches, 0u);
+
+    // Until its structure changes
+    provider.mEndpointCount = 2;
+    provider.NotifyEndpointChanged(3, DataModel::EndpointChangeType::kRemoved);
+    EXPECT_EQ(ExpandInChunks(&provider, &wildcard, &cache, 5).size(), provider.AttributeCount());
+    EXPECT_EQ(cache.Size(), provider.AttributeCount());
+    EXPECT_GT(provider.mMetadataFetches, 0u);
+
+    provider.mAttributeCount = 5;
+    provider.NotifyAttributeChanged({ 1, 1, Clusters::Globals::Attributes::AttributeList::Id },
+                                    DataModel::AttributeChangeType::kReportable);
+    EXPECT_EQ(ExpandInChunks(&provider, &wildcard, &cache, 5).size(), provider.AttributeCount());
+    EXPECT_EQ(cache.Size(), provider.AttributeCount());
+
+    // A position left in the middle of a cluster that is gone carries on with the next cluster
+    auto position = AttributePathExpandIterator::Position::StartIterating(&wildcard);
+    ConcreteAttributePath path;
+    for (size_t i = 0; i < 7; i++)
+    {
+        ASSERT_TRUE(AttributePathExpandIterator(&provider, position, &cache).Next(path));
+    }
+    EXPECT_EQ(path, ConcreteAttributePath(1, 2, 1));
+    provider.mClusterCount = 1;
+    provider.IncreaseMetadataStructureGeneration();
+    ASSERT_TRUE(AttributePathExpandIterator(&provider, position, &cache).Next(path));
+    EXPECT_EQ(path, ConcreteAttributePath(2, 1, 0));
+}
+
+TEST_F(TestAttributePathExpandIterator, TestCachedExpansionLimit)
+{
+    SyntheticProvider provider(1, 1, static_cast<AttributeId>(AttributePathExpansionCache::kMaxPaths + 1));
+    SingleLinkedListNode<app::AttributePathParams> wildcard;
+
+    // Expansions that do not fit are served by the data model
+    AttributePathExpansionCache cache;
+    EXPECT_EQ(ExpandInChunks(&provider, &wildcard, &cache, 100).size(), provider.AttributeCount());
+    EXPECT_EQ(cache.Size(), 0u);
+}
+
+TEST_F(TestAttributePathExpandIterator, TestCachedExpansionPerformance)
+{
+    // A bridge with 1500 attributes and a wildcard subscription reported in chunks of 25 attributes.
+    constexpr int kRounds       = 20;
+    constexpr size_t kChunkSize = 25;
+    SyntheticProvider provider(50, 5, 6);
+    SingleLinkedListNode<app::AttributePathParams> wildcard;
+
+    for (bool useCache : { false, true })
+    {
+        // Priming reports expand every path, so filling the cache during the first chunk does not pay off for them:
+        // ReadHandler does not use the cache for priming reports.
+        provider.mMetadataFetches = 0;
+        auto start                = std::chrono::steady_clock::now();
+        for (int round = 0; round < kRounds; round++)
+        {
+            AttributePathExpansionCache cache;
+            EXPECT_EQ(ExpandInChunks(&provider, &wildcard, useCache ? &cache : nullptr, kChunkSize).size(),
+                      provider.AttributeCount());
+        }
+        auto priming = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        const size_t primingFetches = provider.mMetadataFetches;
+
+        // Incremental reports go through the expansion to find the dirty attributes; a single one here.
+        // The priming report of the subscription has already filled the cache.
+        AttributePathExpansionCache cache;
+        AttributePathExpansionCache * pathCache = useCache ? &cache : nullptr;
+        ExpandInChunks(&provider, &wildcard, pathCache, kChunkSize);
+        const ConcreteAttributePath dirtyPath(25, 3, 4);
+        size_t reported           = 0;
+        provider.mMetadataFetches = 0;
+        start                     = std::chrono::steady_clock::now();
+        for (int round = 0; round < kRounds; round++)
+        {
+            auto position = AttributePathExpandIterator::Position::StartIterating(&wildcard);
+            ConcreteAttributePath path;
+            for (RollbackAttributePathExpandIterator iterator(&provider, position, pathCache); iterator.Next(path);
+                 iterator.MarkCompleted())
+            {
+                reported += (path == dirtyPath) ? 1 : 0;
+            }
+        }
+        auto incremental = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        EXPECT_EQ(reported, static_cast<size_t>(kRounds));
+
+        ChipLogProgress(Test,
+                        "%s expansion of %u attributes: priming report %u us (%u metadata fetches), "
+                        "incremental report %u us (%u metadata fetches)",
+                        useCache ? "Cached" : "Uncached", static_cast<unsigned>(provider.AttributeCount()),
+                        static_cast<unsigned>(priming.count() / kRounds), static_cast<unsigned>(primingFetches / kRounds),
+                        static_cast<unsigned>(incremental.count() / kRounds),
+                        static_cast<unsigned>(provider.mMetadataFetches / kRounds));
+    }
+}
+
+#endif // CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS > 0
+
 } // namespace
@@ -0,0 +1,234 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Benchmarks of the generated cluster-object decoders, for representative
+ *      command payloads (DoorLock credentials, Thermostat schedules, Scenes).
+ *
+ *      Each payload is decoded the way a command handler does, including its
+ *      lists, and the cost is logged next to that of walking the same TLV
+ *      without decoding it: the difference is the cost of the generated code,
+ *      the rest is the cost of TLVReader.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app-common/zap-generated/cluster-objects.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <cstdint>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+
+constexpr uint32_t kIterations              = 20000;
+constexpr FabricIndex kAccessingFabricIndex = 1;
+
+/// Visits every element of the container the reader is positioned on, without decoding them.
+CHIP_ERROR WalkContainer(TLV::TLVReader & reader)
+{
+    TLV::TLVType outer;
+    ReturnErrorOnFailure(reader.EnterContainer(outer));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (TLV::TLVTypeIsContainer(reader.GetType()))
+        {
+            ReturnErrorOnFailure(WalkContainer(reader));
+        }
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return reader.ExitContainer(outer);
+}
+
+/// Encodes `request`, then times decoding it into a Decodable (and visiting it with `consume`,
+/// which returns CHIP_NO_ERROR if the decoded value is complete and correct).
+template <typename Decodable, typename Request, typename Consume>
+void RunDecodeBenchmark(const char * name, const Request & request, Consume consume)
+{
+    uint8_t buffer[1024];
+    TLV::TLVWriter writer;
+    writer.Init(buffer);
+    ASSERT_EQ(request.Encode(writer, TLV::AnonymousTag()), CHIP_NO_ERROR);
+    ASSERT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+    const uint32_t length = writer.GetLengthWritten();
+
+    uint64_t startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        TLV::TLVReader reader;
+        reader.Init(buffer, length);
+        ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+        ASSERT_EQ(WalkContainer(reader), CHIP_NO_ERROR);
+    }
+    uint64_t walkUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+
+    startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        TLV::TLVReader reader;
+        reader.Init(buffer, length);
+        ASSERT_EQ(reader.Next(), CHIP_NO_ERROR);
+
+        Decodable decoded;
+        if constexpr (Decodable::kIsFabricScoped)
+        {
+            ASSERT_EQ(decoded.Decode(reader, kAccessingFabricIndex), CHIP_NO_ERROR);
+        }
+        else
+        {
+            ASSERT_EQ(decoded.Decode(reader), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(consume(decoded), CHIP_NO_ERROR);
+    }
+    uint64_t decodeUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+
+    ChipLogProgress(Test, "Decode benchmark: %s (%u bytes): %u ns/decode, %u ns/walk", name, static_cast<unsigned>(length),
+                    static_cast<unsigned>(decodeUs * 1000 / kIterations), static_cast<unsigned>(walkUs * 1000 / kIterations));
+}
+
+TEST(TestClusterObjectDecodeBenchmark, DoorLockSetCredential)
+{
+    using namespace DoorLock;
+
+    static const uint8_t kPIN[] = { '1', '2', '3', '4', '5', '6', '7', '8' };
+
+    Commands::SetCredential::Type request;
+    request.operationType              = DataOperationTypeEnum::kAdd;
+    request.credential.credentialType  = CredentialTypeEnum::kPin;
+    request.credential.credentialIndex = 3;
+    request.credentialData             = ByteSpan(kPIN);
+    request.userIndex.SetNonNull(static_cast<uint16_t>(5));
+    request.userStatus.SetNonNull(UserStatusEnum::kOccupiedEnabled);
+    request.userType.SetNonNull(UserTypeEnum::kUnrestrictedUser);
+
+    auto check = [](const Commands::SetCredential::DecodableType & decoded) {
+        VerifyOrReturnError(decoded.credential.credentialIndex == 3, CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(decoded.credentialData.data_equal(ByteSpan(kPIN)), CHIP_ERROR_INTERNAL);
+        VerifyOrReturnError(!decoded.userType.IsNull() && decoded.userType.Value() == UserTypeEnum::kUnrestrictedUser,
+                            CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    };
+    RunDecodeBenchmark<Commands::SetCredential::DecodableType>("DoorLock SetCredential", request, check);
+}
+
+TEST(TestClusterObjectDecodeBenchmark, ThermostatSetWeeklySchedule)
+{
+    using namespace Thermostat;
+
+    // The spec allows up to 10 transitions per sequence.
+    Structs::WeeklyScheduleTransitionStruct::Type transitions[10];
+    for (uint16_t i = 0; i < MATTER_ARRAY_SIZE(transitions); i++)
+    {
+        transitions[i].transitionTime = static_cast<uint16_t>(i * 120);
+        transitions[i].heatSetpoint.SetNonNull(static_cast<int16_t>(1800 + i * 50));
+        transitions[i].coolSetpoint.SetNonNull(static_cast<int16_t>(2400 + i * 50));
+    }
+
+    Commands::SetWeeklySchedule::Type request;
+    request.numberOfTransitionsForSequence = static_cast<uint8_t>(MATTER_ARRAY_SIZE(transitions));
+    request.dayOfWeekForSequence.Set(ScheduleDayOfWeekBitmap::kMonday).Set(ScheduleDayOfWeekBitmap::kFriday);
+    request.modeForSequence.Set(ScheduleModeBitmap::kHeatSetpointPresent).Set(ScheduleModeBitmap::kCoolSetpointPresent);
+    request.transitions = transitions;
+
+    auto check = [](const Commands::SetWeeklySchedule::DecodableType & decoded) {
+        uint16_t count = 0;
+        auto iter      = decoded.transitions.begin();
+        while (iter.Next())
+        {
+            const auto & transition = iter.GetValue();
+            VerifyOrReturnError(transition.transitionTime == count * 120, CHIP_ERROR_INTERNAL);
+            VerifyOrReturnError(!transition.coolSetpoint.IsNull(), CHIP_ERROR_INTERNAL);
+            count++;
+        }
+        ReturnErrorOnFailure(iter.GetStatus());
+        VerifyOrReturnError(count == decoded.numberOfTransitionsForSequence, CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    };
+    RunDecodeBenchmark<Commands::SetWeeklySchedule::DecodableType>("Thermostat SetWeeklySchedule", request, check);
+}
+
+TEST(TestClusterObjectDecodeBenchmark, ScenesManagementAddScene)
+{
+    using namespace ScenesManagement;
+
+    // A color light scene: on/off, level and color attributes.
+    Structs::AttributeValuePairStruct::Type onOffValues[1];
+    onOffValues[0].attributeID = OnOff::Attributes::OnOff::Id;
+    onOffValues[0].valueUnsigned8.SetValue(1);
+
+    Structs::AttributeValuePairStruct::Type levelValues[1];
+    levelValues[0].attributeID = LevelControl::Attributes::CurrentLevel::Id;
+    levelValues[0].valueUnsigned8.SetValue(200);
+
+    Structs::AttributeValuePairStruct::Type colorValues[4];
+    colorValues[0].attributeID = ColorControl::Attributes::CurrentX::Id;
+    colorValues[0].valueUnsigned16.SetValue(24939);
+    colorValues[1].attributeID = ColorControl::Attributes::CurrentY::Id;
+    colorValues[1].valueUnsigned16.SetValue(24701);
+    colorValues[2].attributeID = ColorControl::Attributes::ColorTemperatureMireds::Id;
+    colorValues[2].valueUnsigned16.SetValue(250);
+    colorValues[3].attributeID = ColorControl::Attributes::EnhancedCurrentHue::Id;
+    colorValues[3].valueUnsigned16.SetValue(12000);
+
+    Structs::ExtensionFieldSetStruct::Type extensionFieldSets[3];
+    extensionFieldSets[0].clusterID          = OnOff::Id;
+    extensionFieldSets[0].attributeValueList = onOffValues;
+    extensionFieldSets[1].clusterID          = LevelControl::Id;
+    extensionFieldSets[1].attributeValueList = levelValues;
+    extensionFieldSets[2].clusterID          = ColorControl::Id;
+    extensionFieldSets[2].attributeValueList = colorValues;
+
+    Commands::AddScene::Type request;
+    request.groupID                  = 0x0101;
+    request.sceneID                  = 7;
+    request.transitionTime           = 1000;
+    request.sceneName                = "Evening"_span;
+    request.extensionFieldSetStructs = extensionFieldSets;
+
+    auto check = [](const Commands::AddScene::DecodableType & decoded) {
+        VerifyOrReturnError(decoded.sceneName.data_equal("Evening"_span), CHIP_ERROR_INTERNAL);
+
+        size_t attributeValueCount = 0;
+        auto fieldSets             = decoded.extensionFieldSetStructs.begin();
+        while (fieldSets.Next())
+        {
+            auto values = fieldSets.GetValue().attributeValueList.begin();
+            while (values.Next())
+            {
+                attributeValueCount++;
+            }
+            ReturnErrorOnFailure(values.GetStatus());
+        }
+        ReturnErrorOnFailure(fieldSets.GetStatus());
+        VerifyOrReturnError(attributeValueCount == 6, CHIP_ERROR_INTERNAL);
+        return CHIP_NO_ERROR;
+    };
+    RunDecodeBenchmark<Commands::AddScene::DecodableType>("ScenesManagement AddScene", request, check);
+}
+
+} // namespace
@@ -16,9 +16,15 @@
  *    limitations under the License.
  */
 
+#include <chrono>
+#include <memory>
 #include <string.h>
 #include <vector>
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
 #include "app-common/zap-generated/ids/Attributes.h"
 #include "app-common/zap-generated/ids/Clusters.h"
 #include "lib/core/TLVTags.h"
@@ -279,7 +285,8 @@ void DataSeriesGenerator::Generate(ForwardedDataCallbackValidator & dataCallback
     callback->OnReportEnd();
 }
 
-class CacheValidator : public ClusterStateCache::Callback
+template <typename CacheType>
+class CacheValidator : public CacheType::Callback
 {
 public:
     CacheValidator(AttributeInstructionListType & instructionList, ForwardedDataCallbackValidator & dataCallbackValidator);
@@ -310,7 +317,7 @@ private:
         }
     }
 
-    void DecodeAttribute(const AttributeInstruction & instruction, const ConcreteAttributePath & path, ClusterStateCache * cache)
+    void DecodeAttribute(const AttributeInstruction & instruction, const ConcreteAttributePath & path, CacheType * cache)
     {
         CHIP_ERROR err;
         bool gotStatus = false;
@@ -323,7 +330,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating A");
 
             Clusters::UnitTesting::Attributes::Int16u::TypeInfo::DecodableType v = 0;
-            err = cache->Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::Int16u::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -342,7 +349,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating B");
 
             Clusters::UnitTesting::Attributes::OctetString::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::OctetString::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -361,7 +368,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating C");
 
             Clusters::UnitTesting::Attributes::StructAttr::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::StructAttr::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::StructAttr::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -380,7 +387,7 @@ private:
             ChipLogProgress(DataManagement, "\t\t -- Validating D");
 
             Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo::DecodableType v;
-            err = cache->Get<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(path, v);
+            err = cache->template Get<Clusters::UnitTesting::Attributes::ListStructOctetString::TypeInfo>(path, v);
             if (err == CHIP_ERROR_IM_STATUS_CODE_RECEIVED)
             {
                 gotStatus = true;
@@ -411,9 +418,9 @@ private:
     }
 
     void DecodeClusterObject(const AttributeInstruction & instruction, const ConcreteAttributePath & path,
-                             ClusterStateCache * cache)
+                             CacheType * cache)
     {
-        std::list<ClusterStateCache::AttributeStatus> statusList;
+        std::list<typename CacheType::AttributeStatus> statusList;
         EXPECT_EQ(cache->Get(path.mEndpointId, path.mClusterId, clusterValue, statusList), CHIP_NO_ERROR);
 
         if (instruction.mValueType == AttributeInstruction::kData)
@@ -463,7 +470,7 @@ private:
         }
     }
 
-    void OnAttributeChanged(ClusterStateCache * cache, const ConcreteAttributePath & path) override
+    void OnAttributeChanged(CacheType * cache, const ConcreteAttributePath & path) override
     {
         // Ensure that the provided path is one that we're expecting to find
         auto iter = mExpectedAttributes.find(path);
@@ -489,14 +496,14 @@ private:
         }
     }
 
-    void OnClusterChanged(ClusterStateCache * cache, EndpointId endpointId, ClusterId clusterId) override
+    void OnClusterChanged(CacheType * cache, EndpointId endpointId, ClusterId clusterId) override
     {
         auto iter = mExpectedClusters.find(std::make_tuple(endpointId, clusterId));
         ASSERT_NE(iter, mExpectedClusters.end());
         mExpectedClusters.erase(iter);
     }
 
-    void OnEndpointAdded(ClusterStateCache * cache, EndpointId endpointId) override
+    void OnEndpointAdded(CacheType * cache, EndpointId endpointId) override
     {
         auto iter = mExpectedEndpoints.find(endpointId);
         ASSERT_NE(iter, mExpectedEndpoints.end());
@@ -522,8 +529,9 @@ private:
     ForwardedDataCallbackValidator & mDataCallbackValidator;
 };
 
-CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
-                               ForwardedDataCallbackValidator & dataCallbackValidator) :
+template <typename CacheType>
+CacheValidator<CacheType>::CacheValidator(AttributeInstructionListType & instructionList,
+                                          ForwardedDataCallbackValidator & dataCallbackValidator) :
     mDataCallbackValidator(dataCallbackValidator)
 {
     for (auto & instruction : instructionList)
@@ -541,11 +549,12 @@ CacheValidator::CacheValidator(AttributeInstructionListType & instructionList,
     }
 }
 
-void RunAndValidateSequence(AttributeInstructionListType list)
+template <typename CacheType>
+void RunAndValidateSequenceWithCache(AttributeInstructionListType list)
 {
     ForwardedDataCallbackValidator dataCallbackValidator;
-    CacheValidator client(list, dataCallbackValidator);
-    ClusterStateCache cache(client);
+    CacheValidator<CacheType> client(list, dataCallbackValidator);
+    CacheType cache(client);
 
     // In order for the cache to track our data versions, we need to claim to it
     // that we are dealing with a wildcard path.  And we need to do that before
@@ -760,6 +769,91 @@ void RunAndValidateSequence(AttributeInstructionListType list)
     }
 }
 
+void RunAndValidateSequence(AttributeInstructionListType list)
+{
+    RunAndValidateSequenceWithCache<ClusterStateCache>(list);
+    RunAndValidateSequenceWithCache<ClusterStateCacheFlat>(list);
+}
+
+template <typename CacheType>
+class NullCacheCallback : public CacheType::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// Feeds one report with a uint16 value for each of the given paths through the cache.
+template <typename CacheType>
+void ReportAttributes(CacheType & cache, const std::vector<ConcreteAttributePath> & paths)
+{
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+    callback.OnReportBegin();
+    for (const auto & path : paths)
+    {
+        uint8_t buf[8];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        EXPECT_SUCCESS(writer.Put(TLV::AnonymousTag(), static_cast<uint16_t>(path.mAttributeId)));
+
+        TLV::TLVReader reader;
+        reader.Init(buf, writer.GetLengthWritten());
+        EXPECT_SUCCESS(reader.Next());
+
+        ConcreteDataAttributePath dataPath(path.mEndpointId, path.mClusterId, path.mAttributeId);
+        dataPath.mDataVersion.SetValue(1);
+        callback.OnAttributeData(dataPath, &reader, StatusIB());
+    }
+    callback.OnReportEnd();
+}
+
+template <typename CacheType>
+void ReportEvents(CacheType & cache, const std::vector<EventNumber> & eventNumbers)
+{
+    ReadClient::Callback & callback = cache.GetBufferedCallback();
+    callback.OnReportBegin();
+    for (auto eventNumber : eventNumbers)
+    {
+        uint8_t buf[32];
+        TLV::TLVWriter writer;
+        writer.Init(buf);
+        TLV::TLVType outer;
+        EXPECT_SUCCESS(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, outer));
+        EXPECT_SUCCESS(writer.Put(TLV::ContextTag(0), eventNumber));
+        EXPECT_SUCCESS(writer.EndContainer(outer));
+
+        TLV::TLVReader reader;
+        reader.Init(buf, writer.GetLengthWritten());
+        EXPECT_SUCCESS(reader.Next());
+
+        EventHeader header;
+        header.mPath        = ConcreteEventPath(1, Clusters::UnitTesting::Id, 1);
+        header.mEventNumber = eventNumber;
+        callback.OnEventData(header, &reader, nullptr);
+    }
+    callback.OnReportEnd();
+}
+
+template <typename CacheType>
+std::vector<ConcreteAttributePath> CachedPaths(CacheType & cache)
+{
+    std::vector<ConcreteAttributePath> paths;
+    EXPECT_SUCCESS(cache.ForEachAttribute([&paths](const ConcreteAttributePath & path) {
+        paths.push_back(path);
+        return CHIP_NO_ERROR;
+    }));
+    return paths;
+}
+
+template <typename CacheType>
+std::vector<EventNumber> CachedEventNumbers(CacheType & cache)
+{
+    std::vector<EventNumber> eventNumbers;
+    EXPECT_SUCCESS(cache.ForEachEventData([&eventNumbers](const EventHeader & header) {
+        eventNumbers.push_back(header.mEventNumber);
+        return CHIP_NO_ERROR;
+    }));
+    return eventNumbers;
+}
+
 /*
  * This validates the cache by issuing different sequences of attribute combinations
  * and ensuring that the latest view in the cache matches up with expectations.
@@ -830,4 +924,138 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+/*
+ * Validates that the flat storage keeps the same ordering and replacement semantics as the map-based storage
+ * when data does not arrive in path order.
+ */
+TEST_F(TestClusterStateCache, TestFlatStorageMatchesMapStorage)
+{
+    NullCacheCallback<ClusterStateCache> mapCallback;
+    NullCacheCallback<ClusterStateCacheFlat> flatCallback;
+    ClusterStateCache mapCache(mapCallback);
+    ClusterStateCacheFlat flatCache(flatCallback);
+
+    const std::vector<ConcreteAttributePath> paths = {
+        ConcreteAttributePath(2, 6, 1), ConcreteAttributePath(0, 40, 3), ConcreteAttributePath(2, 6, 0),
+        ConcreteAttributePath(1, 6, 2), ConcreteAttributePath(0, 29, 0), ConcreteAttributePath(2, 8, 0),
+        ConcreteAttributePath(0, 40, 1), ConcreteAttributePath(2, 6, 1), ConcreteAttributePath(1, 6, 0),
+    };
+    ReportAttributes(mapCache, paths);
+    ReportAttributes(flatCache, paths);
+
+    auto mapPaths = CachedPaths(mapCache);
+    EXPECT_EQ(mapPaths.size(), 8u);
+    EXPECT_TRUE(std::is_sorted(mapPaths.begin(), mapPaths.end()));
+    EXPECT_EQ(CachedPaths(flatCache), mapPaths);
+
+    for (const auto & path : mapPaths)
+    {
+        TLV::TLVReader reader;
+        uint16_t value = 0;
+        EXPECT_SUCCESS(flatCache.Get(path, reader));
+        EXPECT_SUCCESS(reader.Get(value));
+        EXPECT_EQ(value, path.mAttributeId);
+    }
+
+    std::vector<ClusterId> clusters;
+    EXPECT_SUCCESS(flatCache.ForEachCluster(2, [&clusters](ClusterId clusterId) {
+        clusters.push_back(clusterId);
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(clusters, (std::vector<ClusterId>{ 6, 8 }));
+    EXPECT_SUCCESS(flatCache.ForEachCluster(7, [](ClusterId) { return CHIP_ERROR_INTERNAL; }));
+
+    mapCache.ClearAttribute(ConcreteAttributePath(0, 40, 3));
+    flatCache.ClearAttribute(ConcreteAttributePath(0, 40, 3));
+    mapCache.ClearAttributes(ConcreteClusterPath(2, 6));
+    flatCache.ClearAttributes(ConcreteClusterPath(2, 6));
+    mapCache.ClearAttributes(1);
+    flatCache.ClearAttributes(1);
+    EXPECT_EQ(CachedPaths(mapCache).size(), 3u);
+    EXPECT_EQ(CachedPaths(flatCache), CachedPaths(mapCache));
+
+    TLV::TLVReader reader;
+    EXPECT_EQ(flatCache.Get(ConcreteAttributePath(1, 6, 0), reader), CHIP_ERROR_KEY_NOT_FOUND);
+
+    // Events already seen are dropped, so only increasing event numbers are cached.
+    const std::vector<EventNumber> events = { 3, 7, 5, 7, 12 };
+    ReportEvents(mapCache, events);
+    ReportEvents(flatCache, events);
+    EXPECT_EQ(CachedEventNumbers(mapCache), (std::vector<EventNumber>{ 3, 7, 12 }));
+    EXPECT_EQ(CachedEventNumbers(flatCache), CachedEventNumbers(mapCache));
+
+    EXPECT_SUCCESS(flatCache.Get(7, reader));
+    EXPECT_EQ(reader.GetType(), TLV::kTLVType_Structure);
+    EXPECT_EQ(flatCache.Get(5, reader), CHIP_ERROR_KEY_NOT_FOUND);
+
+    flatCache.ClearEventCache();
+    EXPECT_TRUE(CachedEventNumbers(flatCache).empty());
+}
+
+template <typename CacheType>
+void MeasureStorage(const char * name, const std::vector<ConcreteAttributePath> & paths)
+{
+    constexpr size_t kNodes   = 10;
+    constexpr int kLookupRuns = 10;
+
+    NullCacheCallback<CacheType> callbacks[kNodes];
+    std::vector<std::unique_ptr<CacheType>> caches;
+
+#if defined(__GLIBC__)
+    size_t heapBefore = mallinfo().uordblks;
+#endif
+    auto start = std::chrono::steady_clock::now();
+    for (auto & callback : callbacks)
+    {
+        caches.push_back(std::make_unique<CacheType>(callback));
+        ReportAttributes(*caches.back(), paths);
+        // An empty report releases the set of paths changed by the previous one.
+        ReportAttributes(*caches.back(), {});
+    }
+    auto populateTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+#if defined(__GLIBC__)
+    size_t heapUsed = mallinfo().uordblks - heapBefore;
+#else
+    size_t heapUsed = 0;
+#endif
+
+    start = std::chrono::steady_clock::now();
+    for (int run = 0; run < kLookupRuns; run++)
+    {
+        for (auto & cache : caches)
+        {
+            for (const auto & path : paths)
+            {
+                TLV::TLVReader reader;
+                ASSERT_SUCCESS(cache->Get(path, reader));
+            }
+        }
+    }
+    auto lookupTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    ChipLogProgress(DataManagement, "%s: %u nodes x %u attributes: populate %u us, %u bytes of heap, lookup %u ns", name,
+                    static_cast<unsigned>(kNodes), static_cast<unsigned>(paths.size()),
+                    static_cast<unsigned>(populateTime.count()), static_cast<unsigned>(heapUsed),
+                    static_cast<unsigned>(lookupTime.count() / (kLookupRuns * kNodes * paths.size())));
+}
+
+TEST_F(TestClusterStateCache, TestStoragePerformance)
+{
+    // The shape of a full wildcard subscription to a bridge: many endpoints with a few clusters each.
+    std::vector<ConcreteAttributePath> paths;
+    for (EndpointId endpoint = 0; endpoint < 32; endpoint++)
+    {
+        for (ClusterId cluster : { 0x3u, 0x4u, 0x6u, 0x8u, 0x1Du, 0x39u, 0x300u, 0x402u })
+        {
+            for (AttributeId attribute = 0; attribute < 12; attribute++)
+            {
+                paths.push_back(ConcreteAttributePath(endpoint, cluster, attribute));
+            }
+        }
+    }
+
+    MeasureStorage<ClusterStateCache>("Map storage", paths);
+    MeasureStorage<ClusterStateCacheFlat>("Flat storage", paths);
+}
+
 } // namespace
@@ -0,0 +1,118 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyAttributePathTable.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+TEST(TestDirtyAttributePathTable, TestMarkAndGet)
+{
+    DirtyAttributePathTable<4> table;
+    const ConcreteAttributePath path1(1, 6, 0);
+    const ConcreteAttributePath path2(1, 6, 1);
+    const ConcreteAttributePath path3(2, 6, 0);
+
+    EXPECT_TRUE(table.IsEmpty());
+    EXPECT_TRUE(table.Get(path1).IsZero());
+
+    EXPECT_TRUE(table.Mark(path1, AttributeGeneration(5)));
+    EXPECT_TRUE(table.Mark(path2, AttributeGeneration(6)));
+    EXPECT_EQ(table.Size(), 2u);
+    EXPECT_EQ(table.Get(path1).Raw(), 5u);
+    EXPECT_EQ(table.Get(path2).Raw(), 6u);
+    EXPECT_TRUE(table.Get(path3).IsZero());
+
+    // Marking a path again only moves its generation.
+    EXPECT_TRUE(table.Mark(path1, AttributeGeneration(7)));
+    EXPECT_EQ(table.Size(), 2u);
+    EXPECT_EQ(table.Get(path1).Raw(), 7u);
+
+    // Zero is not a valid generation.
+    EXPECT_FALSE(table.Mark(path3, AttributeGeneration(0)));
+    EXPECT_TRUE(table.Get(path3).IsZero());
+
+    table.Clear();
+    EXPECT_TRUE(table.IsEmpty());
+    EXPECT_TRUE(table.Get(path1).IsZero());
+    EXPECT_TRUE(table.Get(path2).IsZero());
+}
+
+TEST(TestDirtyAttributePathTable, TestFull)
+{
+    DirtyAttributePathTable<3> table;
+    EXPECT_TRUE(table.Mark(ConcreteAttributePath(1, 6, 0), AttributeGeneration(1)));
+    EXPECT_TRUE(table.Mark(ConcreteAttributePath(1, 6, 1), AttributeGeneration(2)));
+    EXPECT_TRUE(table.Mark(ConcreteAttributePath(1, 6, 2), AttributeGeneration(3)));
+
+    EXPECT_FALSE(table.Mark(ConcreteAttributePath(1, 6, 3), AttributeGeneration(4)));
+    EXPECT_TRUE(table.Get(ConcreteAttributePath(1, 6, 3)).IsZero());
+
+    // Paths already in the table can still be marked.
+    EXPECT_TRUE(table.Mark(ConcreteAttributePath(1, 6, 1), AttributeGeneration(5)));
+    EXPECT_EQ(table.Get(ConcreteAttributePath(1, 6, 1)).Raw(), 5u);
+    EXPECT_EQ(table.Size(), 3u);
+
+    table.Clear();
+    EXPECT_TRUE(table.Mark(ConcreteAttributePath(1, 6, 3), AttributeGeneration(6)));
+}
+
+TEST(TestDirtyAttributePathTable, TestManyPaths)
+{
+    // A bridge-like burst: many endpoints with the same clusters and attributes, which must not be
+    // confused with each other despite colliding in the table.
+    constexpr EndpointId kEndpoints   = 64;
+    constexpr AttributeId kAttributes = 16;
+    constexpr ClusterId kClusters[]   = { 0x0006, 0x0008, 0x0300 };
+    static DirtyAttributePathTable<kEndpoints * kAttributes * 3> table;
+
+    uint32_t generation = 1;
+    for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster : kClusters)
+        {
+            for (AttributeId attribute = 0; attribute < kAttributes; attribute++)
+            {
+                ASSERT_TRUE(table.Mark(ConcreteAttributePath(endpoint, cluster, attribute), AttributeGeneration(generation++)));
+            }
+        }
+    }
+    EXPECT_EQ(table.Size(), static_cast<size_t>(kEndpoints * kAttributes * 3));
+    EXPECT_FALSE(table.Mark(ConcreteAttributePath(kEndpoints + 1, 0x0006, 0), AttributeGeneration(generation)));
+
+    generation = 1;
+    for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster : kClusters)
+        {
+            for (AttributeId attribute = 0; attribute < kAttributes; attribute++)
+            {
+                ASSERT_EQ(table.Get(ConcreteAttributePath(endpoint, cluster, attribute)).Raw(), generation++);
+            }
+            EXPECT_TRUE(table.Get(ConcreteAttributePath(endpoint, cluster, kAttributes)).IsZero());
+        }
+    }
+    EXPECT_TRUE(table.Get(ConcreteAttributePath(0, 0x0006, 0)).IsZero());
+}
+
+} // namespace
@@ -42,6 +42,9 @@
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
 
+#include <chrono>
+#include <vector>
+
 namespace {
 
 static const chip::ClusterId kLivenessClusterId   = 0x00000022;
@@ -55,6 +58,12 @@ static uint8_t gInfoEventBuffer[120];
 static uint8_t gCritEventBuffer[120];
 static chip::app::CircularEventBuffer gCircularEventBuffer[3];
 
+// Large enough for a few dozen events per buffer, as on a device that keeps a long event history.
+static uint8_t gLargeDebugEventBuffer[1024];
+static uint8_t gLargeInfoEventBuffer[1024];
+static uint8_t gLargeCritEventBuffer[2048];
+static chip::app::CircularEventBuffer gLargeCircularEventBuffer[3];
+
 class TestEventLogging : public chip::Testing::AppContext
 {
 public:
@@ -86,6 +95,35 @@ private:
     chip::MonotonicallyIncreasingCounter<chip::EventNumber> mEventCounter;
 };
 
+class TestEventLoggingManySubscribers : public chip::Testing::AppContext
+{
+public:
+    void SetUp() override
+    {
+        const chip::app::LogStorageResources logStorageResources[] = {
+            { &gLargeDebugEventBuffer[0], sizeof(gLargeDebugEventBuffer), chip::app::PriorityLevel::Debug },
+            { &gLargeInfoEventBuffer[0], sizeof(gLargeInfoEventBuffer), chip::app::PriorityLevel::Info },
+            { &gLargeCritEventBuffer[0], sizeof(gLargeCritEventBuffer), chip::app::PriorityLevel::Critical },
+        };
+
+        AppContext::SetUp();
+        chip::app::InteractionModelEngine::GetInstance()->SetDataModelProvider(
+            chip::app::CodegenDataModelProviderInstance(nullptr));
+        ASSERT_EQ(mEventCounter.Init(0), CHIP_NO_ERROR);
+        chip::app::EventManagement::CreateEventManagement(&GetExchangeManager(), MATTER_ARRAY_SIZE(logStorageResources),
+                                                          gLargeCircularEventBuffer, logStorageResources, &mEventCounter);
+    }
+
+    void TearDown() override
+    {
+        chip::app::EventManagement::DestroyEventManagement();
+        AppContext::TearDown();
+    }
+
+private:
+    chip::MonotonicallyIncreasingCounter<chip::EventNumber> mEventCounter;
+};
+
 void ENFORCE_FORMAT(1, 2) SimpleDumpWriter(const char * aFormat, ...)
 {
     va_list args;
@@ -252,6 +290,177 @@ TEST_F(TestEventLogging, TestCheckLogEventWithEvictToNextBuffer)
     CheckLogReadOut(logMgmt, 0, 6, pathsWithWildcard);
 }
 
+constexpr chip::EndpointId kSubscriberCount = 20;
+
+struct FetchedEvent
+{
+    chip::EventNumber mEventNumber;
+    chip::EndpointId mEndpointId;
+};
+
+// Fetch every event since aEventMin the way a ReadHandler does, one report chunk at a time.
+static std::vector<FetchedEvent> FetchAllEventsSince(chip::app::EventManagement & aLogMgmt,
+                                                     const chip::SingleLinkedListNode<chip::app::EventPathParams> * apPaths,
+                                                     chip::EventNumber & aEventMin)
+{
+    constexpr uint32_t kChunkSize = 256;
+    std::vector<FetchedEvent> events;
+
+    chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+    VerifyOrDie(backingStore.Alloc(kChunkSize));
+
+    while (true)
+    {
+        chip::TLV::TLVWriter writer;
+        size_t eventCount = 0;
+        writer.Init(backingStore.Get(), kChunkSize);
+        CHIP_ERROR err =
+            aLogMgmt.FetchEventsSince(writer, apPaths, aEventMin, eventCount, chip::Access::SubjectDescriptor{});
+
+        chip::TLV::TLVReader reader;
+        size_t chunkEventCount = 0;
+        reader.Init(backingStore.Get(), writer.GetLengthWritten());
+        while (reader.Next() == CHIP_NO_ERROR)
+        {
+            chip::app::EventReportIB::Parser report;
+            chip::app::EventDataIB::Parser data;
+            chip::app::EventPathIB::Parser path;
+            FetchedEvent event;
+            EXPECT_SUCCESS(report.Init(reader));
+            EXPECT_SUCCESS(report.GetEventData(&data));
+            EXPECT_SUCCESS(data.GetPath(&path));
+            EXPECT_SUCCESS(data.GetEventNumber(&event.mEventNumber));
+            EXPECT_SUCCESS(path.GetEndpoint(&event.mEndpointId));
+            events.push_back(event);
+            chunkEventCount++;
+        }
+        EXPECT_EQ(chunkEventCount, eventCount);
+
+        if (err != CHIP_ERROR_BUFFER_TOO_SMALL && err != CHIP_ERROR_NO_MEMORY)
+        {
+            EXPECT_SUCCESS(err);
+            break;
+        }
+        // Each chunk fits several events, so a full chunk always makes progress.
+        EXPECT_GT(eventCount, 0u);
+        VerifyOrReturnValue(eventCount > 0, events);
+    }
+    return events;
+}
+
+// Log events of all priorities on the endpoints of the subscribers, until events have been evicted from and moved across
+// every buffer.
+static void FillEventLog(chip::app::EventManagement & aLogMgmt, size_t aEventCount)
+{
+    TestEventGenerator testEventGenerator;
+    for (size_t i = 0; i < aEventCount; i++)
+    {
+        chip::app::EventOptions options;
+        chip::EventNumber eventNumber;
+        options.mPath     = { static_cast<chip::EndpointId>(1 + i % kSubscriberCount), kLivenessClusterId, kLivenessChangeEvent };
+        options.mPriority = static_cast<chip::app::PriorityLevel>(chip::to_underlying(chip::app::PriorityLevel::First) + i % 3);
+        testEventGenerator.SetStatus(static_cast<int32_t>(i));
+        EXPECT_EQ(aLogMgmt.LogEvent(&testEventGenerator, options, eventNumber), CHIP_NO_ERROR);
+    }
+}
+
+TEST_F(TestEventLoggingManySubscribers, TestFetchEventsSinceFiltersFullLog)
+{
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    FillEventLog(logMgmt, 600);
+
+    // A wildcard fetch returns every event left in the log, oldest first.
+    chip::TLV::TLVReader reader;
+    chip::app::CircularEventBufferWrapper bufWrapper;
+    size_t eventsInLog = 0;
+    EXPECT_SUCCESS(logMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper));
+    EXPECT_SUCCESS(chip::TLV::Utilities::Count(reader, eventsInLog, false));
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> wildcardPath;
+    chip::EventNumber eventMin          = 0;
+    std::vector<FetchedEvent> allEvents = FetchAllEventsSince(logMgmt, &wildcardPath, eventMin);
+    ASSERT_EQ(allEvents.size(), eventsInLog);
+    ASSERT_GT(allEvents.size(), 0u);
+    for (size_t i = 1; i < allEvents.size(); i++)
+    {
+        EXPECT_LT(allEvents[i - 1].mEventNumber, allEvents[i].mEventNumber);
+    }
+    const chip::EventNumber lastEventNumber = allEvents.back().mEventNumber;
+    EXPECT_EQ(eventMin, lastEventNumber + 1);
+
+    // Each subscriber gets the events of its own endpoint since the one it asks for, and resumes after the last event of
+    // the log, as if it had gone through all of them.
+    const chip::EventNumber startingEventNumbers[] = { 0, allEvents[allEvents.size() / 2].mEventNumber, lastEventNumber,
+                                                       lastEventNumber + 1 };
+    for (chip::EndpointId endpoint = 1; endpoint <= kSubscriberCount; endpoint++)
+    {
+        chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+        path.mValue.mEndpointId = endpoint;
+        path.mValue.mClusterId  = kLivenessClusterId;
+
+        for (chip::EventNumber startingEventNumber : startingEventNumbers)
+        {
+            std::vector<chip::EventNumber> expected;
+            for (const auto & event : allEvents)
+            {
+                if (event.mEndpointId == endpoint && event.mEventNumber >= startingEventNumber)
+                {
+                    expected.push_back(event.mEventNumber);
+                }
+            }
+
+            eventMin = startingEventNumber;
+            std::vector<chip::EventNumber> fetched;
+            for (const auto & event : FetchAllEventsSince(logMgmt, &path, eventMin))
+            {
+                EXPECT_EQ(event.mEndpointId, endpoint);
+                fetched.push_back(event.mEventNumber);
+            }
+            EXPECT_EQ(fetched, expected);
+            EXPECT_EQ(eventMin, lastEventNumber + 1);
+        }
+    }
+}
+
+TEST_F(TestEventLoggingManySubscribers, TestFetchEventsSincePerformance)
+{
+    // Time the reports of 20 subscribers, each interested in the events of its own endpoint, over a full event log: first
+    // with subscribers that are up to date but for the last round of events, then with subscribers fetching the whole log.
+    constexpr int kRounds = 50;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    FillEventLog(logMgmt, 600);
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> paths[kSubscriberCount];
+    for (chip::EndpointId i = 0; i < kSubscriberCount; i++)
+    {
+        paths[i].mValue.mEndpointId = static_cast<chip::EndpointId>(i + 1);
+        paths[i].mValue.mClusterId  = kLivenessClusterId;
+    }
+
+    const chip::EventNumber lastEventNumber        = logMgmt.GetLastEventNumber() - 1;
+    const chip::EventNumber startingEventNumbers[] = { lastEventNumber + 1 - kSubscriberCount, 0 };
+    for (chip::EventNumber startingEventNumber : startingEventNumbers)
+    {
+        size_t fetchedEvents = 0;
+        auto start           = std::chrono::steady_clock::now();
+        for (int round = 0; round < kRounds; round++)
+        {
+            for (auto & path : paths)
+            {
+                chip::EventNumber eventMin = startingEventNumber;
+                fetchedEvents += FetchAllEventsSince(logMgmt, &path, eventMin).size();
+            }
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        EXPECT_GE(fetchedEvents, static_cast<size_t>(kRounds * kSubscriberCount));
+        ChipLogProgress(Test, "Fetching events since 0x" ChipLogFormatX64 " for %u subscribers: %u ns per subscriber",
+                        ChipLogValueX64(startingEventNumber), static_cast<unsigned>(kSubscriberCount),
+                        static_cast<unsigned>(elapsed.count() / (kRounds * kSubscriberCount)));
+    }
+}
+
 TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
 {
 
@@ -0,0 +1,771 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      End-to-end benchmarks of the Interaction Model over the loopback transport.
+ *
+ *      Reads, writes, invokes and subscriptions go through the real clients
+ *      (ReadClient, WriteClient, CommandSender) and handlers of the
+ *      InteractionModelEngine, against a code-driven data model whose size and
+ *      attribute payloads are set by each scenario. For every scenario the
+ *      benchmark logs throughput, p50/p99 latency, bytes and messages on the
+ *      wire per operation and the peak usage of exchanges, IM handlers and heap.
+ *
+ *      This is the baseline that performance changes to src/app are measured
+ *      against: run it before and after the change and compare the logs.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <access/Privilege.h>
+#include <app/AttributePathParams.h>
+#include <app/CommandHandler.h>
+#include <app/CommandPathParams.h>
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/ReadClient.h>
+#include <app/ReadPrepareParams.h>
+#include <app/WriteClient.h>
+#include <app/data-model/EncodableToTLV.h>
+#include <app/server-cluster/AttributeListBuilder.h>
+#include <app/server-cluster/DefaultServerCluster.h>
+#include <app/server-cluster/testing/TestServerClusterContext.h>
+#include <app/tests/AppTestContext.h>
+#include <clusters/shared/GlobalIds.h>
+#include <data-model-providers/codedriven/CodeDrivenDataModelProvider.h>
+#include <data-model-providers/codedriven/endpoint/SpanEndpoint.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/DiagnosticDataProvider.h>
+#include <protocols/interaction_model/StatusCode.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::Testing;
+using chip::Protocols::InteractionModel::Status;
+
+// Manufacturer-specific cluster IDs of the test vendor, so that nothing treats them as spec clusters.
+constexpr ClusterId kFirstBenchmarkClusterId   = 0xFFF1'FC00;
+constexpr EndpointId kFirstBenchmarkEndpointId = 1;
+constexpr CommandId kEchoCommandId             = 0x00;
+constexpr CommandId kEchoResponseCommandId     = 0x01;
+
+struct BenchmarkConfig
+{
+    const char * name;
+    uint16_t endpointCount;
+    uint16_t clustersPerEndpoint;
+    uint16_t attributesPerCluster;
+    uint16_t payloadSize; // Size of every attribute value and command payload, in bytes
+    uint16_t concurrency; // Operations in flight; for subscriptions, the number of subscribers
+    uint16_t operations;  // For subscriptions, the number of reports
+    bool wildcard;        // Whether reads and subscriptions cover the whole node instead of one attribute
+};
+
+// clang-format off
+//                                              endpoints  clusters  attributes  payload  concurrency  operations  wildcard
+constexpr BenchmarkConfig kReadScenarios[] = {
+    { "attribute",                                      1,        1,          1,      16,           1,        500,   false },
+    { "attribute, 4 in flight",                         1,        1,          1,      16,           4,        500,   false },
+    { "1 KiB attribute",                                1,        1,          1,    1024,           1,        500,   false },
+    { "wildcard, 4x4x8 attributes",                     4,        4,          8,      16,           1,        100,   true  },
+    { "wildcard, 4x4x8 256 B attributes",               4,        4,          8,     256,           1,         50,   true  },
+};
+
+constexpr BenchmarkConfig kWriteScenarios[] = {
+    { "attribute",                                      1,        1,          1,      16,           1,        500,   false },
+    { "attribute, 4 in flight",                         1,        4,          1,      16,           4,        500,   false },
+    { "1 KiB attribute",                                1,        1,          1,    1024,           1,        500,   false },
+};
+
+constexpr BenchmarkConfig kInvokeScenarios[] = {
+    { "command",                                        1,        1,          0,      16,           1,        500,   false },
+    { "command, 4 in flight",                           1,        4,          0,      16,           4,        500,   false },
+    { "1 KiB command",                                  1,        1,          0,    1024,           1,        500,   false },
+};
+
+constexpr BenchmarkConfig kSubscribeScenarios[] = {
+    { "attribute",                                      1,        1,          1,      16,           1,        200,   false },
+    { "attribute, 4 subscribers",                       1,        1,          1,      16,           4,        200,   false },
+    { "wildcard, 4x4x8 attributes",                     4,        4,          8,      16,           1,        200,   true  },
+    { "wildcard, 4x4x8 attributes, 4 subscribers",      4,        4,          8,      16,           4,        100,   true  },
+};
+// clang-format on
+
+uint64_t NowMicroseconds()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64().count();
+}
+
+/// A command payload: a structure holding a single octet string.
+class EchoPayload : public DataModel::EncodableToTLV
+{
+public:
+    EchoPayload(ByteSpan value) : mValue(value) {}
+
+    CHIP_ERROR EncodeTo(TLV::TLVWriter & writer, TLV::Tag tag) const override
+    {
+        TLV::TLVType outer;
+        ReturnErrorOnFailure(writer.StartContainer(tag, TLV::kTLVType_Structure, outer));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), mValue));
+        return writer.EndContainer(outer);
+    }
+
+private:
+    ByteSpan mValue;
+};
+
+/// A cluster of octet string attributes, and of a command echoing its payload back.
+class BenchmarkCluster : public DefaultServerCluster
+{
+public:
+    BenchmarkCluster(const ConcreteClusterPath & path, uint16_t attributeCount, uint16_t payloadSize) :
+        DefaultServerCluster(path), mValue(payloadSize, 0xA5)
+    {
+        for (AttributeId id = 0; id < attributeCount; id++)
+        {
+            mAttributeEntries.emplace_back(id, BitMask<DataModel::AttributeQualityFlags>(), Access::Privilege::kView,
+                                           Access::Privilege::kOperate);
+        }
+    }
+
+    /// Changes the value of an attribute, as a device would on its own.
+    void Change(AttributeId attributeId)
+    {
+        mValue[0]++;
+        NotifyAttributeChanged(attributeId);
+    }
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        switch (request.path.mAttributeId)
+        {
+        case Clusters::Globals::Attributes::ClusterRevision::Id:
+            return encoder.Encode<uint16_t>(1);
+        case Clusters::Globals::Attributes::FeatureMap::Id:
+            return encoder.Encode<uint32_t>(0);
+        default:
+            VerifyOrReturnValue(request.path.mAttributeId < mAttributeEntries.size(), Status::UnsupportedAttribute);
+            return encoder.Encode(ByteSpan(mValue.data(), mValue.size()));
+        }
+    }
+
+    DataModel::ActionReturnStatus WriteAttribute(const DataModel::WriteAttributeRequest & request,
+                                                 AttributeValueDecoder & decoder) override
+    {
+        VerifyOrReturnValue(request.path.mAttributeId < mAttributeEntries.size(), Status::UnsupportedAttribute);
+
+        ByteSpan value;
+        ReturnErrorOnFailure(decoder.Decode(value));
+        mValue.assign(value.begin(), value.end());
+        NotifyAttributeChanged(request.path.mAttributeId);
+        return Status::Success;
+    }
+
+    CHIP_ERROR Attributes(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<DataModel::AttributeEntry> & builder) override
+    {
+        AttributeListBuilder listBuilder(builder);
+        return listBuilder.Append(Span(mAttributeEntries.data(), mAttributeEntries.size()), {});
+    }
+
+    std::optional<DataModel::ActionReturnStatus> InvokeCommand(const DataModel::InvokeRequest & request,
+                                                               TLV::TLVReader & input_arguments, CommandHandler * handler) override
+    {
+        VerifyOrReturnValue(request.path.mCommandId == kEchoCommandId, Status::UnsupportedCommand);
+
+        TLV::TLVType outer;
+        ByteSpan payload;
+        ReturnErrorOnFailure(input_arguments.EnterContainer(outer));
+        ReturnErrorOnFailure(input_arguments.Next(TLV::ContextTag(0)));
+        ReturnErrorOnFailure(input_arguments.Get(payload));
+
+        handler->AddResponse(request.path, kEchoResponseCommandId, EchoPayload(payload));
+        return std::nullopt;
+    }
+
+    CHIP_ERROR AcceptedCommands(const ConcreteClusterPath & path,
+                                ReadOnlyBufferBuilder<DataModel::AcceptedCommandEntry> & builder) override
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(1));
+        return builder.Append({ kEchoCommandId });
+    }
+
+    CHIP_ERROR GeneratedCommands(const ConcreteClusterPath & path, ReadOnlyBufferBuilder<CommandId> & builder) override
+    {
+        ReturnErrorOnFailure(builder.EnsureAppendCapacity(1));
+        return builder.Append(kEchoResponseCommandId);
+    }
+
+private:
+    std::vector<DataModel::AttributeEntry> mAttributeEntries;
+    std::vector<uint8_t> mValue;
+};
+
+/// The data model of a benchmark scenario: `endpointCount` endpoints of `clustersPerEndpoint` benchmark clusters.
+class BenchmarkNode
+{
+public:
+    BenchmarkNode() : mProvider(mServerClusterContext.StorageDelegate(), mServerClusterContext.AttributePersistenceProvider()) {}
+
+    CHIP_ERROR Build(const BenchmarkConfig & config)
+    {
+        for (uint16_t e = 0; e < config.endpointCount; e++)
+        {
+            auto endpointId = static_cast<EndpointId>(kFirstBenchmarkEndpointId + e);
+            for (uint16_t c = 0; c < config.clustersPerEndpoint; c++)
+            {
+                ConcreteClusterPath path(endpointId, kFirstBenchmarkClusterId + c);
+                mClusters.push_back(std::make_unique<BenchmarkCluster>(path, config.attributesPerCluster, config.payloadSize));
+                mClusterRegistrations.push_back(std::make_unique<ServerClusterRegistration>(*mClusters.back()));
+                ReturnErrorOnFailure(mProvider.AddCluster(*mClusterRegistrations.back()));
+            }
+
+            mEndpoints.push_back(std::make_unique<SpanEndpoint>(SpanEndpoint::Builder().Build()));
+            mEndpointRegistrations.push_back(std::make_unique<EndpointInterfaceRegistration>(
+                *mEndpoints.back(),
+                DataModel::EndpointEntry{ .id                 = endpointId,
+                                          .parentId           = kInvalidEndpointId,
+                                          .compositionPattern = DataModel::EndpointCompositionPattern::kFullFamily }));
+            ReturnErrorOnFailure(mProvider.AddEndpoint(*mEndpointRegistrations.back()));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    DataModel::Provider & Provider() { return mProvider; }
+    size_t ClusterCount() const { return mClusters.size(); }
+    BenchmarkCluster & Cluster(size_t index) { return *mClusters[index]; }
+
+private:
+    TestServerClusterContext mServerClusterContext;
+
+    // Declared before the provider, so that they outlive it.
+    std::vector<std::unique_ptr<BenchmarkCluster>> mClusters;
+    std::vector<std::unique_ptr<ServerClusterRegistration>> mClusterRegistrations;
+    std::vector<std::unique_ptr<SpanEndpoint>> mEndpoints;
+    std::vector<std::unique_ptr<EndpointInterfaceRegistration>> mEndpointRegistrations;
+
+    CodeDrivenDataModelProvider mProvider;
+};
+
+struct BenchmarkResult
+{
+    std::vector<uint64_t> latenciesUs;
+    uint64_t elapsedUs   = 0;
+    uint64_t bytesOnWire = 0;
+    uint32_t messages    = 0;
+    uint32_t failures    = 0;
+
+    size_t peakExchanges       = 0;
+    uint32_t peakReadHandlers  = 0;
+    uint32_t peakWriteHandlers = 0;
+    bool heapUsageAvailable    = false;
+    uint64_t heapUsedAtStart   = 0;
+    uint64_t peakHeapUsed      = 0;
+};
+
+class TestInteractionModelBenchmark;
+
+/// One operation slot of a scenario: starts an operation, and the next one as soon as it completes.
+class BenchmarkOperation
+{
+public:
+    BenchmarkOperation(TestInteractionModelBenchmark & benchmark) : mBenchmark(benchmark) {}
+    virtual ~BenchmarkOperation() = default;
+
+    virtual CHIP_ERROR Start() = 0;
+
+protected:
+    void Done(bool success);
+
+    TestInteractionModelBenchmark & mBenchmark;
+    uint64_t mStartUs = 0;
+};
+
+class TestInteractionModelBenchmark : public AppContext, public LoopbackTransportDelegate
+{
+public:
+    // Performs setup for each individual test in the test suite
+    void SetUp() override
+    {
+        AppContext::SetUp();
+        GetLoopback().SetLoopbackTransportDelegate(this);
+    }
+
+    // Performs teardown for each individual test in the test suite
+    void TearDown() override
+    {
+        GetLoopback().SetLoopbackTransportDelegate(nullptr);
+        AppContext::TearDown();
+    }
+
+    void WillSendMessage(const Transport::PeerAddress & peer, const System::PacketBufferHandle & message) override
+    {
+        mResult.bytesOnWire += message->TotalLength();
+        mResult.messages++;
+
+        InteractionModelEngine * engine = InteractionModelEngine::GetInstance();
+        mResult.peakExchanges           = std::max(mResult.peakExchanges, GetExchangeManager().GetNumActiveExchanges());
+        mResult.peakReadHandlers        = std::max(mResult.peakReadHandlers, engine->GetNumActiveReadHandlers());
+        mResult.peakWriteHandlers       = std::max(mResult.peakWriteHandlers, engine->GetNumActiveWriteHandlers());
+    }
+
+    const BenchmarkConfig & Config() const { return *mConfig; }
+    ByteSpan Payload() const { return ByteSpan(mPayload.data(), mPayload.size()); }
+
+    /// The attribute targeted by the n-th operation, cycling over the attributes of the node.
+    ConcreteAttributePath TargetAttribute(uint32_t n) const
+    {
+        uint32_t attributes = std::max<uint32_t>(mConfig->attributesPerCluster, 1);
+        uint32_t cluster    = (n / attributes) % static_cast<uint32_t>(mNode->ClusterCount());
+        return ConcreteAttributePath(static_cast<EndpointId>(kFirstBenchmarkEndpointId + cluster / mConfig->clustersPerEndpoint),
+                                     kFirstBenchmarkClusterId + cluster % mConfig->clustersPerEndpoint, n % attributes);
+    }
+
+    /// The paths of reads and subscriptions: the whole node, or the first attribute.
+    AttributePathParams ReadPath() const
+    {
+        VerifyOrReturnValue(!mConfig->wildcard, AttributePathParams());
+        ConcreteAttributePath target = TargetAttribute(0);
+        return AttributePathParams(target.mEndpointId, target.mClusterId, target.mAttributeId);
+    }
+
+    /// Attributes expected in the response to a read of ReadPath(), at least.
+    uint32_t ExpectedAttributeCount() const
+    {
+        VerifyOrReturnValue(mConfig->wildcard, 1);
+        return static_cast<uint32_t>(mNode->ClusterCount()) * mConfig->attributesPerCluster;
+    }
+
+    uint32_t NextOperationIndex() const { return mLaunched - 1; }
+
+    void Launch(BenchmarkOperation & operation)
+    {
+        while (mLaunched < mConfig->operations)
+        {
+            mLaunched++;
+            CHIP_ERROR err = operation.Start();
+            if (err == CHIP_NO_ERROR)
+            {
+                return;
+            }
+            ChipLogError(Test, "Benchmark operation failed to start: %" CHIP_ERROR_FORMAT, err.Format());
+            mResult.failures++;
+            mCompleted++;
+        }
+    }
+
+    void OperationDone(BenchmarkOperation & operation, uint64_t startUs, bool success)
+    {
+        mLastCompletionUs = NowMicroseconds();
+        mResult.latenciesUs.push_back(mLastCompletionUs - startUs);
+        mResult.failures += success ? 0 : 1;
+        mCompleted++;
+        SampleHeapUsage();
+
+        Launch(operation);
+    }
+
+    /// Called by subscribers at the end of every report.
+    void OnSubscriptionReport()
+    {
+        VerifyOrReturn(mRoundActive);
+        VerifyOrReturn(++mRoundReports == mConfig->concurrency);
+
+        mLastCompletionUs = NowMicroseconds();
+        mResult.latenciesUs.push_back(mLastCompletionUs - mRoundStartUs);
+        mCompleted++;
+        SampleHeapUsage();
+
+        mRoundActive = false;
+        if (mCompleted < mConfig->operations)
+        {
+            StartRound();
+        }
+    }
+
+protected:
+    void StartScenario(const BenchmarkConfig & config)
+    {
+        mConfig = &config;
+        mPayload.assign(config.payloadSize, 0x5A);
+        mResult           = BenchmarkResult();
+        mLaunched         = 0;
+        mCompleted        = 0;
+        mLastCompletionUs = 0;
+
+        mNode = std::make_unique<BenchmarkNode>();
+        ASSERT_EQ(mNode->Build(config), CHIP_NO_ERROR);
+        mOldProvider = InteractionModelEngine::GetInstance()->SetDataModelProvider(&mNode->Provider());
+
+        uint64_t heapUsed          = 0;
+        mResult.heapUsageAvailable = (DeviceLayer::GetDiagnosticDataProvider().GetCurrentHeapUsed(heapUsed) == CHIP_NO_ERROR);
+        mResult.heapUsedAtStart    = heapUsed;
+        mResult.peakHeapUsed       = heapUsed;
+    }
+
+    void FinishScenario(const char * interaction)
+    {
+        InteractionModelEngine::GetInstance()->ShutdownAllSubscriptionHandlers();
+        DrainAndServiceIO();
+        InteractionModelEngine::GetInstance()->SetDataModelProvider(mOldProvider);
+        mNode.reset();
+
+        EXPECT_EQ(mCompleted, mConfig->operations);
+        EXPECT_EQ(mResult.failures, 0u);
+        LogResult(interaction);
+    }
+
+    /// Runs the operations of the current scenario, `concurrency` of them in flight at any time.
+    template <typename Operation>
+    void RunOperations()
+    {
+        std::vector<std::unique_ptr<Operation>> slots;
+        for (uint16_t i = 0; i < mConfig->concurrency; i++)
+        {
+            slots.push_back(std::make_unique<Operation>(*this));
+        }
+
+        uint64_t startUs = NowMicroseconds();
+        for (auto & slot : slots)
+        {
+            Launch(*slot);
+        }
+        DrainUntilCompleted();
+        mResult.elapsedUs = mLastCompletionUs - startUs;
+    }
+
+    /// Establishes `concurrency` subscriptions, then changes one attribute at a time and measures how long it
+    /// takes until every subscriber has received the report.
+    template <typename Subscriber>
+    void RunSubscriptions()
+    {
+        std::vector<std::unique_ptr<Subscriber>> subscribers;
+        uint64_t startUs = NowMicroseconds();
+        for (uint16_t i = 0; i < mConfig->concurrency; i++)
+        {
+            subscribers.push_back(std::make_unique<Subscriber>(*this));
+            ASSERT_EQ(subscribers.back()->Subscribe(), CHIP_NO_ERROR);
+        }
+        GetIOContext().DriveIOUntil(System::Clock::Seconds16(10), [&] {
+            return std::all_of(subscribers.begin(), subscribers.end(), [](auto & s) { return s->IsEstablished(); });
+        });
+        for (auto & subscriber : subscribers)
+        {
+            ASSERT_TRUE(subscriber->IsEstablished());
+        }
+        ChipLogProgress(Test, "IM benchmark: %u subscriptions to %s primed in %u us", mConfig->concurrency, mConfig->name,
+                        static_cast<unsigned>(NowMicroseconds() - startUs));
+
+        startUs = NowMicroseconds();
+        StartRound();
+        DrainUntilCompleted();
+        mResult.elapsedUs = mLastCompletionUs - startUs;
+
+        for (auto & subscriber : subscribers)
+        {
+            mResult.failures += subscriber->Failures();
+        }
+        subscribers.clear();
+    }
+
+private:
+    void StartRound()
+    {
+        // Non-wildcard subscriptions only cover the first attribute.
+        ConcreteAttributePath target = TargetAttribute(mConfig->wildcard ? mCompleted : 0);
+
+        mRoundActive  = true;
+        mRoundReports = 0;
+        mRoundStartUs = NowMicroseconds();
+        mNode->Cluster((target.mEndpointId - kFirstBenchmarkEndpointId) * mConfig->clustersPerEndpoint +
+                       (target.mClusterId - kFirstBenchmarkClusterId))
+            .Change(target.mAttributeId);
+    }
+
+    void DrainUntilCompleted()
+    {
+        // Operations start one another from their completion callbacks, so one drain normally runs them all.
+        constexpr int kMaxDrains = 20;
+        for (int i = 0; i < kMaxDrains && mCompleted < mConfig->operations; i++)
+        {
+            DrainAndServiceIO();
+        }
+    }
+
+    void SampleHeapUsage()
+    {
+        uint64_t heapUsed = 0;
+        if (mResult.heapUsageAvailable && DeviceLayer::GetDiagnosticDataProvider().GetCurrentHeapUsed(heapUsed) == CHIP_NO_ERROR)
+        {
+            mResult.peakHeapUsed = std::max(mResult.peakHeapUsed, heapUsed);
+        }
+    }
+
+    void LogResult(const char * interaction)
+    {
+        std::vector<uint64_t> & latencies = mResult.latenciesUs;
+        VerifyOrReturn(!latencies.empty());
+        std::sort(latencies.begin(), latencies.end());
+
+        uint64_t p50        = latencies[latencies.size() / 2];
+        uint64_t p99        = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+        uint64_t opsPerSec  = latencies.size() * 1000000 / std::max<uint64_t>(mResult.elapsedUs, 1);
+        uint64_t heapGrowth = mResult.peakHeapUsed - mResult.heapUsedAtStart;
+
+        ChipLogProgress(Test,
+                        "IM benchmark: %-9s %-44s %7u ops/s  p50 %6u us  p99 %6u us  %6u B/op  %5.1f msg/op  "
+                        "peak %u exchanges, %u read / %u write handlers, heap +%u KiB%s",
+                        interaction, mConfig->name, static_cast<unsigned>(opsPerSec), static_cast<unsigned>(p50),
+                        static_cast<unsigned>(p99), static_cast<unsigned>(mResult.bytesOnWire / latencies.size()),
+                        static_cast<double>(mResult.messages) / static_cast<double>(latencies.size()),
+                        static_cast<unsigned>(mResult.peakExchanges), static_cast<unsigned>(mResult.peakReadHandlers),
+                        static_cast<unsigned>(mResult.peakWriteHandlers), static_cast<unsigned>(heapGrowth / 1024),
+                        mResult.heapUsageAvailable ? "" : " (unavailable)");
+    }
+
+    const BenchmarkConfig * mConfig = nullptr;
+    std::vector<uint8_t> mPayload;
+    std::unique_ptr<BenchmarkNode> mNode;
+    DataModel::Provider * mOldProvider = nullptr;
+    BenchmarkResult mResult;
+
+    uint32_t mLaunched         = 0;
+    uint32_t mCompleted        = 0;
+    uint64_t mLastCompletionUs = 0;
+
+    bool mRoundActive      = false;
+    uint16_t mRoundReports = 0;
+    uint64_t mRoundStartUs = 0;
+};
+
+void BenchmarkOperation::Done(bool success)
+{
+    mBenchmark.OperationDone(*this, mStartUs, success);
+}
+
+class ReadOperation : public BenchmarkOperation, public ReadClient::Callback
+{
+public:
+    using BenchmarkOperation::BenchmarkOperation;
+
+    CHIP_ERROR Start() override
+    {
+        mStartUs    = NowMicroseconds();
+        mAttributes = 0;
+        mFailed     = false;
+        mPath       = mBenchmark.ReadPath();
+
+        mClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &mBenchmark.GetExchangeManager(), *this,
+                                               ReadClient::InteractionType::Read);
+        ReadPrepareParams params(mBenchmark.GetSessionBobToAlice());
+        params.mpAttributePathParamsList    = &mPath;
+        params.mAttributePathParamsListSize = 1;
+        return mClient->SendRequest(params);
+    }
+
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        mAttributes++;
+        mFailed = mFailed || !status.IsSuccess() || data == nullptr;
+    }
+
+    void OnError(CHIP_ERROR error) override { mFailed = true; }
+
+    void OnDone(ReadClient *) override
+    {
+        mClient.reset();
+        Done(!mFailed && mAttributes >= mBenchmark.ExpectedAttributeCount());
+    }
+
+private:
+    std::unique_ptr<ReadClient> mClient;
+    AttributePathParams mPath;
+    uint32_t mAttributes = 0;
+    bool mFailed         = false;
+};
+
+class WriteOperation : public BenchmarkOperation, public WriteClient::Callback
+{
+public:
+    using BenchmarkOperation::BenchmarkOperation;
+
+    CHIP_ERROR Start() override
+    {
+        mStartUs   = NowMicroseconds();
+        mResponses = 0;
+        mFailed    = false;
+
+        ConcreteAttributePath target = mBenchmark.TargetAttribute(mBenchmark.NextOperationIndex());
+        mClient                      = std::make_unique<WriteClient>(&mBenchmark.GetExchangeManager(), this, NullOptional);
+        AttributePathParams path(target.mEndpointId, target.mClusterId, target.mAttributeId);
+        ReturnErrorOnFailure(mClient->EncodeAttribute(path, mBenchmark.Payload()));
+        return mClient->SendWriteRequest(mBenchmark.GetSessionBobToAlice());
+    }
+
+    void OnResponse(const WriteClient *, const ConcreteDataAttributePath & path, StatusIB status) override
+    {
+        mResponses++;
+        mFailed = mFailed || !status.IsSuccess();
+    }
+
+    void OnError(const WriteClient *, CHIP_ERROR error) override { mFailed = true; }
+
+    void OnDone(WriteClient *) override
+    {
+        mClient.reset();
+        Done(!mFailed && mResponses == 1);
+    }
+
+private:
+    std::unique_ptr<WriteClient> mClient;
+    uint32_t mResponses = 0;
+    bool mFailed        = false;
+};
+
+class InvokeOperation : public BenchmarkOperation, public CommandSender::ExtendableCallback
+{
+public:
+    using BenchmarkOperation::BenchmarkOperation;
+
+    CHIP_ERROR Start() override
+    {
+        mStartUs   = NowMicroseconds();
+        mResponses = 0;
+        mFailed    = false;
+
+        ConcreteAttributePath target = mBenchmark.TargetAttribute(mBenchmark.NextOperationIndex());
+        CommandPathParams path(target.mEndpointId, 0, target.mClusterId, kEchoCommandId, CommandPathFlags::kEndpointIdValid);
+        CommandSender::AddRequestDataParameters addRequestDataParams;
+
+        mSender = std::make_unique<CommandSender>(this, &mBenchmark.GetExchangeManager());
+        ReturnErrorOnFailure(mSender->AddRequestData(path, EchoPayload(mBenchmark.Payload()), addRequestDataParams));
+        return mSender->SendCommandRequest(mBenchmark.GetSessionBobToAlice());
+    }
+
+    void OnResponse(CommandSender *, const CommandSender::ResponseData & response) override
+    {
+        mResponses++;
+        mFailed = mFailed || response.path.mCommandId != kEchoResponseCommandId || response.data == nullptr;
+    }
+
+    void OnError(const CommandSender *, const CommandSender::ErrorData & error) override { mFailed = true; }
+
+    void OnDone(CommandSender *) override
+    {
+        mSender.reset();
+        Done(!mFailed && mResponses == 1);
+    }
+
+private:
+    std::unique_ptr<CommandSender> mSender;
+    uint32_t mResponses = 0;
+    bool mFailed        = false;
+};
+
+class Subscriber : public ReadClient::Callback
+{
+public:
+    Subscriber(TestInteractionModelBenchmark & benchmark) : mBenchmark(benchmark) {}
+
+    CHIP_ERROR Subscribe()
+    {
+        mPath   = mBenchmark.ReadPath();
+        mClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &mBenchmark.GetExchangeManager(), *this,
+                                               ReadClient::InteractionType::Subscribe);
+
+        ReadPrepareParams params(mBenchmark.GetSessionBobToAlice());
+        params.mpAttributePathParamsList    = &mPath;
+        params.mAttributePathParamsListSize = 1;
+        params.mMinIntervalFloorSeconds     = 0;
+        params.mMaxIntervalCeilingSeconds   = 60;
+        params.mKeepSubscriptions           = true;
+        return mClient->SendRequest(params);
+    }
+
+    bool IsEstablished() const { return mEstablished; }
+    uint32_t Failures() const { return mFailures; }
+
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        mFailures += (status.IsSuccess() && data != nullptr) ? 0 : 1;
+    }
+
+    void OnReportEnd() override { mBenchmark.OnSubscriptionReport(); }
+    void OnSubscriptionEstablished(SubscriptionId subscriptionId) override { mEstablished = true; }
+    void OnError(CHIP_ERROR error) override { mFailures++; }
+    void OnDone(ReadClient *) override { mEstablished = false; }
+
+private:
+    TestInteractionModelBenchmark & mBenchmark;
+    std::unique_ptr<ReadClient> mClient;
+    AttributePathParams mPath;
+    bool mEstablished  = false;
+    uint32_t mFailures = 0;
+};
+
+TEST_F(TestInteractionModelBenchmark, Read)
+{
+    for (const auto & config : kReadScenarios)
+    {
+        StartScenario(config);
+        RunOperations<ReadOperation>();
+        FinishScenario("read");
+    }
+}
+
+TEST_F(TestInteractionModelBenchmark, Write)
+{
+    for (const auto & config : kWriteScenarios)
+    {
+        StartScenario(config);
+        RunOperations<WriteOperation>();
+        FinishScenario("write");
+    }
+}
+
+TEST_F(TestInteractionModelBenchmark, Invoke)
+{
+    for (const auto & config : kInvokeScenarios)
+    {
+        StartScenario(config);
+        RunOperations<InvokeOperation>();
+        FinishScenario("invoke");
+    }
+}
+
+TEST_F(TestInteractionModelBenchmark, Subscribe)
+{
+    for (const auto & config : kSubscribeScenarios)
+    {
+        StartScenario(config);
+        RunSubscriptions<Subscriber>();
+        FinishScenario("subscribe");
+    }
+}
+
+} // namespace
@@ -581,6 +581,7 @@ public:
     void TestSubscribeRoundtripStatusReportTimeout();
     void TestSubscribeSendInvalidStatusReport();
     void TestSubscribeSendUnknownMessage();
+    void TestSubscribeSetDirtyBurst();
     void TestSubscribeSetDirtyFullyOverlap();
     void TestSubscribeUrgentWildcardEvent();
     void TestSubscribeWildcard();
@@ -3434,6 +3435,128 @@ void TestReadInteraction::TestSubscribeSetDirtyFullyOverlap()
     EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
 }
 
+// Subscribe (wildcard, wildcard, wildcard), then set two attributes of every cluster dirty at once. With
+// CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS, the report carries exactly those attributes, instead of every attribute of the
+// endpoints they were merged into once the dirty set pool ran out.
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeSetDirtyBurst)
+TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteractionSync, TestSubscribeSetDirtyBurst)
+void TestReadInteraction::TestSubscribeSetDirtyBurst()
+{
+    // The clusters below are the ones of the DefaultMockConfig in the mock attribute storage.
+    chip::Testing::ResetMockNodeConfig();
+
+    struct
+    {
+        EndpointId mEndpointId;
+        ClusterId mClusterId;
+    } const kClusters[] = {
+        { chip::Testing::kMockEndpoint1, chip::Testing::MockClusterId(1) },
+        { chip::Testing::kMockEndpoint1, chip::Testing::MockClusterId(2) },
+        { chip::Testing::kMockEndpoint2, chip::Testing::MockClusterId(1) },
+        { chip::Testing::kMockEndpoint2, chip::Testing::MockClusterId(2) },
+        { chip::Testing::kMockEndpoint2, chip::Testing::MockClusterId(3) },
+        { chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(1) },
+        { chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(2) },
+        { chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(3) },
+        { chip::Testing::kMockEndpoint3, chip::Testing::MockClusterId(4) },
+    };
+    constexpr int kBurstSize = 2 * static_cast<int>(MATTER_ARRAY_SIZE(kClusters));
+
+    struct : public chip::Testing::LoopbackTransportDelegate
+    {
+        Transport::PeerAddress mClientAddress;
+        size_t mReportBytes = 0;
+        void WillSendMessage(const Transport::PeerAddress & peer, const System::PacketBufferHandle & message) override
+        {
+            // We only care about the reports, not the status responses of the client.
+            if (peer == mClientAddress)
+            {
+                mReportBytes += message->TotalLength();
+            }
+        }
+    } loopbackDelegate;
+    loopbackDelegate.mClientAddress = GetBobAddress();
+
+    Messaging::ReliableMessageMgr * rm = GetExchangeManager().GetReliableMessageMgr();
+    // Shouldn't have anything in the retransmit table when starting the test.
+    EXPECT_EQ(rm->TestGetCountRetransTable(), 0);
+
+    MockInteractionModelApp delegate;
+    auto * engine = chip::app::InteractionModelEngine::GetInstance();
+    EXPECT_EQ(engine->Init(&GetExchangeManager(), &GetFabricTable(), gReportScheduler), CHIP_NO_ERROR);
+
+    ReadPrepareParams readPrepareParams(GetSessionBobToAlice());
+    readPrepareParams.mEventPathParamsListSize = 0;
+
+    readPrepareParams.mAttributePathParamsListSize = 1;
+    auto attributePathParams = std::make_unique<chip::app::AttributePathParams[]>(readPrepareParams.mAttributePathParamsListSize);
+    readPrepareParams.mpAttributePathParamsList = attributePathParams.get();
+
+    readPrepareParams.mMinIntervalFloorSeconds   = 0;
+    readPrepareParams.mMaxIntervalCeilingSeconds = 1;
+
+    auto drainReports = [&]() {
+        int last;
+        do
+        {
+            last = delegate.mNumAttributeResponse;
+            DrainAndServiceIO();
+        } while (last != delegate.mNumAttributeResponse);
+    };
+
+    {
+        app::ReadClient readClient(chip::app::InteractionModelEngine::GetInstance(), &GetExchangeManager(), delegate,
+                                   chip::app::ReadClient::InteractionType::Subscribe);
+
+        attributePathParams.release();
+        EXPECT_EQ(readClient.SendAutoResubscribeRequest(std::move(readPrepareParams)), CHIP_NO_ERROR);
+
+        drainReports();
+        EXPECT_TRUE(delegate.mGotReport);
+        EXPECT_EQ(engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe), 1u);
+
+        GetLoopback().SetLoopbackTransportDelegate(&loopbackDelegate);
+
+        // Set the burst of concrete paths dirty.
+        delegate.Reset();
+        for (const auto & cluster : kClusters)
+        {
+            AttributePathParams dirtyPath(cluster.mEndpointId, cluster.mClusterId, ClusterRevision::Id);
+            EXPECT_EQ(engine->GetReportingEngine().SetDirty(dirtyPath), CHIP_NO_ERROR);
+            dirtyPath.mAttributeId = FeatureMap::Id;
+            EXPECT_EQ(engine->GetReportingEngine().SetDirty(dirtyPath), CHIP_NO_ERROR);
+        }
+        drainReports();
+
+        const int burstAttributes = delegate.mNumAttributeResponse;
+        const size_t burstBytes   = loopbackDelegate.mReportBytes;
+        EXPECT_GE(burstAttributes, kBurstSize);
+#if CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS >= 18 // kBurstSize
+        EXPECT_EQ(burstAttributes, kBurstSize);
+        for (const auto & path : delegate.mReceivedAttributePaths)
+        {
+            EXPECT_TRUE(path.mAttributeId == ClusterRevision::Id || path.mAttributeId == FeatureMap::Id);
+        }
+#endif
+
+        // For comparison, set the whole node dirty.
+        delegate.Reset();
+        loopbackDelegate.mReportBytes = 0;
+        EXPECT_EQ(engine->GetReportingEngine().SetDirty(AttributePathParams()), CHIP_NO_ERROR);
+        drainReports();
+
+        ChipLogProgress(Test, "Burst of %d dirty attributes: %d attributes in %u bytes, whole node: %d attributes in %u bytes",
+                        kBurstSize, burstAttributes, static_cast<unsigned>(burstBytes), delegate.mNumAttributeResponse,
+                        static_cast<unsigned>(loopbackDelegate.mReportBytes));
+
+        GetLoopback().SetLoopbackTransportDelegate(nullptr);
+    }
+
+    EXPECT_EQ(engine->GetNumActiveReadClients(), 0u);
+    engine->Shutdown();
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+}
+
 // Verify that subscription can be shut down just after receiving SUBSCRIBE RESPONSE,
 // before receiving any subsequent REPORT DATA.
 TEST_F_FROM_FIXTURE_NO_BODY(TestReadInteraction, TestSubscribeEarlyShutdown)
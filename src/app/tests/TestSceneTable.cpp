@@ -30,10 +30,13 @@
 #include <crypto/DefaultSessionKeystore.h>
 #include <data-model-providers/codegen/CodegenDataModelProvider.h>
 #include <lib/core/TLV.h>
+#include <lib/support/CountingPersistentStorageDelegate.h>
 #include <lib/support/Span.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <lib/support/odd-sized-integers.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemClock.h>
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
@@ -2251,4 +2254,145 @@ TEST_F(TestSceneTable, TestOTAChanges)
     EXPECT_EQ(1, fabric_capacity);
 }
 
+TEST_F(TestSceneTable, TestCachedSceneTable)
+{
+    CountingPersistentStorageDelegate storage;
+    uint8_t scene_count = 0;
+    SceneTableEntry scene;
+
+    {
+        TestSceneTableImpl cachedTable;
+        cachedTable.SetCacheBudget(4096);
+        ASSERT_EQ(CHIP_NO_ERROR, cachedTable.Init(storage, app::CodegenDataModelProvider::Instance()));
+        cachedTable.SetEndpoint(kTestEndpoint1);
+
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.SetSceneTableEntry(kFabric1, scene1));
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.SetSceneTableEntry(kFabric1, scene2));
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.SetSceneTableEntry(kFabric1, scene5));
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.SetSceneTableEntry(kFabric2, scene3));
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.SetSceneTableEntry(kFabric2, scene4));
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.SetSceneTableEntry(kFabric1, scene10)); // Overwrites scene1
+
+        // Everything is read from the cache
+        size_t reads = storage.mReads;
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.GetSceneTableEntry(kFabric1, sceneId1, scene));
+        EXPECT_EQ(scene, scene10);
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.GetFabricSceneCount(kFabric1, scene_count));
+        EXPECT_EQ(3, scene_count);
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.GetEndpointSceneCount(scene_count));
+        EXPECT_EQ(5, scene_count);
+        EXPECT_EQ(storage.mReads, reads);
+
+        // Removing all the scenes of a group writes the fabric entry map and the endpoint count once
+        size_t writes = storage.GetNumMutations();
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.DeleteAllScenesInGroup(kFabric2, kGroup1));
+        EXPECT_EQ(storage.GetNumMutations(), writes + 4);
+
+        EXPECT_EQ(CHIP_NO_ERROR, cachedTable.RemoveSceneTableEntry(kFabric1, sceneId2));
+        EXPECT_EQ(CHIP_ERROR_NOT_FOUND, cachedTable.GetSceneTableEntry(kFabric1, sceneId2, scene));
+        cachedTable.Finish();
+    }
+
+    // The storage holds the changes made through the cache
+    TestSceneTableImpl table;
+    table.SetCacheBudget(0);
+    ASSERT_EQ(CHIP_NO_ERROR, table.Init(storage, app::CodegenDataModelProvider::Instance()));
+    table.SetEndpoint(kTestEndpoint1);
+
+    EXPECT_EQ(CHIP_NO_ERROR, table.GetSceneTableEntry(kFabric1, sceneId1, scene));
+    EXPECT_EQ(scene, scene10);
+    EXPECT_EQ(CHIP_NO_ERROR, table.GetSceneTableEntry(kFabric1, sceneId5, scene));
+    EXPECT_EQ(scene, scene5);
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table.GetSceneTableEntry(kFabric1, sceneId2, scene));
+    EXPECT_EQ(CHIP_ERROR_NOT_FOUND, table.GetSceneTableEntry(kFabric2, sceneId3, scene));
+    EXPECT_EQ(CHIP_NO_ERROR, table.GetFabricSceneCount(kFabric1, scene_count));
+    EXPECT_EQ(2, scene_count);
+    EXPECT_EQ(CHIP_NO_ERROR, table.GetFabricSceneCount(kFabric2, scene_count));
+    EXPECT_EQ(0, scene_count);
+    EXPECT_EQ(CHIP_NO_ERROR, table.GetEndpointSceneCount(scene_count));
+    EXPECT_EQ(2, scene_count);
+    table.Finish();
+}
+
+// Benchmark: scene recalls (loading the scene as RecallScene does, on every endpoint of a group), scene stores over an existing
+// scene (as StoreScene does), and removals of the scenes of a group, with and without the cache.
+TEST_F(TestSceneTable, BenchmarkSceneTableCache)
+{
+    constexpr size_t kRecalls               = 3000;
+    constexpr size_t kStores                = 1000;
+    const EndpointId kEndpoints[]           = { kTestEndpoint1, kTestEndpoint2, kTestEndpoint3 };
+    const SceneTableEntry * const kScenes[] = { &scene1, &scene2, &scene3, &scene4, &scene5, &scene6, &scene7 };
+    constexpr size_t kGroup1Scenes          = 4;
+    constexpr size_t kCacheBudget           = 8192;
+
+    auto run = [&](size_t cacheBudget, const char * name) {
+        CountingPersistentStorageDelegate storage;
+        TestSceneTableImpl table;
+        table.SetCacheBudget(cacheBudget);
+        ASSERT_EQ(CHIP_NO_ERROR, table.Init(storage, app::CodegenDataModelProvider::Instance()));
+
+        for (EndpointId endpoint : kEndpoints)
+        {
+            table.SetEndpoint(endpoint);
+            for (const SceneTableEntry * scene : kScenes)
+            {
+                EXPECT_EQ(CHIP_NO_ERROR, table.SetSceneTableEntry(kFabric1, *scene));
+            }
+        }
+
+        SceneTableEntry scene;
+        size_t reads     = storage.mReads;
+        uint64_t startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kRecalls; i++)
+        {
+            const SceneTableEntry & recalled = *kScenes[i % MATTER_ARRAY_SIZE(kScenes)];
+            for (EndpointId endpoint : kEndpoints)
+            {
+                table.SetEndpoint(endpoint);
+                EXPECT_EQ(CHIP_NO_ERROR, table.GetSceneTableEntry(kFabric1, recalled.mStorageId, scene));
+            }
+        }
+        uint64_t recallUs  = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+        size_t recallReads = storage.mReads - reads;
+        size_t recallLoads = kRecalls * MATTER_ARRAY_SIZE(kEndpoints);
+
+        table.SetEndpoint(kTestEndpoint1);
+        reads         = storage.mReads;
+        size_t writes = storage.GetNumMutations();
+        startUs       = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kStores; i++)
+        {
+            // Store changed attribute values, so that every store writes the scene
+            scene                                     = *kScenes[i % MATTER_ARRAY_SIZE(kScenes)];
+            scene.mStorageData.mSceneTransitionTimeMs = static_cast<uint32_t>(i + 1);
+            EXPECT_EQ(CHIP_NO_ERROR, table.SetSceneTableEntry(kFabric1, scene));
+        }
+        uint64_t storeUs   = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+        size_t storeReads  = storage.mReads - reads;
+        size_t storeWrites = storage.GetNumMutations() - writes;
+
+        writes = storage.GetNumMutations();
+        for (EndpointId endpoint : kEndpoints)
+        {
+            table.SetEndpoint(endpoint);
+            EXPECT_EQ(CHIP_NO_ERROR, table.DeleteAllScenesInGroup(kFabric1, kGroup1));
+        }
+        size_t removeWrites = storage.GetNumMutations() - writes;
+        size_t removed      = kGroup1Scenes * MATTER_ARRAY_SIZE(kEndpoints);
+
+        ChipLogProgress(Test,
+                        "%s: recall %u us/scene (%u.%02u storage reads), store %u us/scene (%u.%02u reads, %u.%02u writes), "
+                        "group removal %u.%02u writes/scene",
+                        name, static_cast<unsigned>(recallUs / recallLoads), static_cast<unsigned>(recallReads / recallLoads),
+                        static_cast<unsigned>(recallReads * 100 / recallLoads % 100), static_cast<unsigned>(storeUs / kStores),
+                        static_cast<unsigned>(storeReads / kStores), static_cast<unsigned>(storeReads * 100 / kStores % 100),
+                        static_cast<unsigned>(storeWrites / kStores), static_cast<unsigned>(storeWrites * 100 / kStores % 100),
+                        static_cast<unsigned>(removeWrites / removed), static_cast<unsigned>(removeWrites * 100 / removed % 100));
+        table.Finish();
+    };
+
+    run(0, "Uncached scene table");
+    run(kCacheBudget, "Cached scene table");
+}
+
 } // namespace TestScenes
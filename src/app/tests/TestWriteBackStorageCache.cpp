@@ -0,0 +1,277 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <app/storage/WriteBackStorageCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CountingPersistentStorageDelegate.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+
+#include <cstdio>
+#include <cstring>
+
+using namespace chip;
+using chip::app::Storage::WriteBackStorageCache;
+
+namespace {
+
+const uint8_t kValue1[] = { 1, 2, 3, 4 };
+const uint8_t kValue2[] = { 5, 6, 7, 8, 9 };
+
+void ExpectValue(PersistentStorageDelegate & storage, const char * key, const uint8_t * expected, uint16_t expectedSize)
+{
+    uint8_t buffer[16];
+    uint16_t size = sizeof(buffer);
+    EXPECT_SUCCESS(storage.SyncGetKeyValue(key, buffer, size));
+    EXPECT_EQ(size, expectedSize);
+    EXPECT_EQ(memcmp(buffer, expected, expectedSize), 0);
+}
+
+void ExpectMissing(PersistentStorageDelegate & storage, const char * key)
+{
+    uint8_t buffer[16];
+    uint16_t size = sizeof(buffer);
+    EXPECT_EQ(storage.SyncGetKeyValue(key, buffer, size), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+}
+
+class TestWriteBackStorageCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestWriteBackStorageCache, TestReadsAreCached)
+{
+    CountingPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(storage.SyncSetKeyValue("a", kValue1, sizeof(kValue1)));
+
+    WriteBackStorageCache cache;
+    cache.Init(storage, 1024);
+
+    ExpectValue(cache, "a", kValue1, sizeof(kValue1));
+    ExpectValue(cache, "a", kValue1, sizeof(kValue1));
+    ExpectMissing(cache, "b");
+    ExpectMissing(cache, "b");
+    EXPECT_EQ(storage.mReads, 2u);
+
+    EXPECT_TRUE(cache.SyncDoesKeyExist("a"));
+    EXPECT_FALSE(cache.SyncDoesKeyExist("b"));
+    EXPECT_EQ(storage.mReads, 2u);
+
+    // A cached value too large for the buffer is truncated, as by the storage
+    uint8_t buffer[2];
+    uint16_t size = sizeof(buffer);
+    EXPECT_EQ(cache.SyncGetKeyValue("a", buffer, size), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(size, sizeof(buffer));
+    EXPECT_EQ(memcmp(buffer, kValue1, sizeof(buffer)), 0);
+}
+
+TEST_F(TestWriteBackStorageCache, TestWritesGoThrough)
+{
+    CountingPersistentStorageDelegate storage;
+    WriteBackStorageCache cache;
+    cache.Init(storage, 1024);
+
+    EXPECT_SUCCESS(cache.SyncSetKeyValue("a", kValue1, sizeof(kValue1)));
+    EXPECT_EQ(storage.mWrites, 1u);
+    ExpectValue(storage, "a", kValue1, sizeof(kValue1));
+
+    // Writing the stored value again does not write
+    EXPECT_SUCCESS(cache.SyncSetKeyValue("a", kValue1, sizeof(kValue1)));
+    EXPECT_EQ(storage.mWrites, 1u);
+
+    EXPECT_SUCCESS(cache.SyncSetKeyValue("a", kValue2, sizeof(kValue2)));
+    EXPECT_EQ(storage.mWrites, 2u);
+    ExpectValue(storage, "a", kValue2, sizeof(kValue2));
+
+    size_t reads = storage.mReads;
+    ExpectValue(cache, "a", kValue2, sizeof(kValue2));
+    EXPECT_EQ(storage.mReads, reads);
+
+    EXPECT_SUCCESS(cache.SyncDeleteKeyValue("a"));
+    EXPECT_FALSE(storage.HasKey("a"));
+    EXPECT_EQ(cache.SyncDeleteKeyValue("a"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+    EXPECT_EQ(storage.mDeletes, 1u);
+    ExpectMissing(cache, "a");
+}
+
+TEST_F(TestWriteBackStorageCache, TestCoalesceWrites)
+{
+    CountingPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(storage.SyncSetKeyValue("b", kValue1, sizeof(kValue1)));
+    storage.mWrites = 0;
+
+    WriteBackStorageCache cache;
+    cache.Init(storage, 1024);
+
+    // Deleting a key that is not cached goes through, to know whether it exists
+    ExpectValue(cache, "b", kValue1, sizeof(kValue1));
+
+    EXPECT_SUCCESS(cache.CoalesceWrites([&]() -> CHIP_ERROR {
+        for (uint8_t i = 0; i < 5; i++)
+        {
+            uint8_t value[] = { i };
+            ReturnErrorOnFailure(cache.SyncSetKeyValue("a", value, sizeof(value)));
+        }
+        ReturnErrorOnFailure(cache.SyncDeleteKeyValue("b"));
+        ReturnErrorOnFailure(cache.SyncSetKeyValue("c", kValue2, sizeof(kValue2)));
+        ReturnErrorOnFailure(cache.SyncDeleteKeyValue("c"));
+
+        // Nested calls write when the outermost one returns
+        ReturnErrorOnFailure(cache.CoalesceWrites(
+            [&]() -> CHIP_ERROR { return cache.SyncSetKeyValue("d", kValue2, sizeof(kValue2)); }));
+
+        // The writes are visible through the cache, but not made yet
+        const uint8_t expected[] = { 4 };
+        ExpectValue(cache, "a", expected, sizeof(expected));
+        ExpectMissing(cache, "b");
+        ExpectMissing(cache, "c");
+        EXPECT_EQ(cache.SyncDeleteKeyValue("c"), CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+        ExpectValue(cache, "d", kValue2, sizeof(kValue2));
+        EXPECT_EQ(storage.mWrites, 0u);
+        EXPECT_EQ(storage.mDeletes, 0u);
+        EXPECT_TRUE(storage.HasKey("b"));
+        return CHIP_NO_ERROR;
+    }));
+
+    EXPECT_EQ(storage.mWrites, 2u);
+    const uint8_t expected[] = { 4 };
+    ExpectValue(storage, "a", expected, sizeof(expected));
+    ExpectValue(storage, "d", kValue2, sizeof(kValue2));
+    EXPECT_FALSE(storage.HasKey("b"));
+    EXPECT_FALSE(storage.HasKey("c"));
+}
+
+TEST_F(TestWriteBackStorageCache, TestBudget)
+{
+    CountingPersistentStorageDelegate storage;
+    WriteBackStorageCache cache;
+    constexpr size_t kBudget = 256;
+    cache.Init(storage, kBudget);
+
+    char key[8];
+    EXPECT_SUCCESS(cache.CoalesceWrites([&]() -> CHIP_ERROR {
+        for (uint8_t i = 0; i < 20; i++)
+        {
+            snprintf(key, sizeof(key), "k%u", i);
+            ReturnErrorOnFailure(cache.SyncSetKeyValue(key, kValue2, sizeof(kValue2)));
+            EXPECT_LE(cache.GetUsedBytes(), kBudget);
+        }
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(storage.GetNumKeys(), 20u);
+
+    // Values that do not fit the budget go through
+    uint8_t large[kBudget] = { 1 };
+    EXPECT_SUCCESS(cache.CoalesceWrites([&]() -> CHIP_ERROR {
+        ReturnErrorOnFailure(cache.SyncSetKeyValue("large", large, sizeof(large)));
+        EXPECT_TRUE(storage.HasKey("large"));
+        return CHIP_NO_ERROR;
+    }));
+
+    size_t reads  = storage.mReads;
+    uint16_t size = sizeof(large);
+    EXPECT_SUCCESS(cache.SyncGetKeyValue("large", large, size));
+    EXPECT_SUCCESS(cache.SyncGetKeyValue("large", large, size));
+    EXPECT_EQ(storage.mReads, reads + 2);
+    EXPECT_LE(cache.GetUsedBytes(), kBudget);
+}
+
+TEST_F(TestWriteBackStorageCache, TestFailedWrites)
+{
+    CountingPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(storage.SyncSetKeyValue("a", kValue1, sizeof(kValue1)));
+
+    WriteBackStorageCache cache;
+    cache.Init(storage, 1024);
+    ExpectValue(cache, "a", kValue1, sizeof(kValue1));
+
+    // A value that could not be written through is dropped, and read from the storage again
+    storage.SetRejectWrites(true);
+    EXPECT_EQ(cache.SyncSetKeyValue("a", kValue2, sizeof(kValue2)), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(cache.GetUsedBytes(), 0u);
+    ExpectValue(cache, "a", kValue1, sizeof(kValue1));
+
+    // A dirty value that could not be written stays dirty, and is written by the next flush
+    EXPECT_EQ(cache.CoalesceWrites([&]() { return cache.SyncSetKeyValue("a", kValue2, sizeof(kValue2)); }),
+              CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    ExpectValue(cache, "a", kValue2, sizeof(kValue2));
+    ExpectValue(storage, "a", kValue1, sizeof(kValue1));
+
+    storage.SetRejectWrites(false);
+    EXPECT_SUCCESS(cache.Flush());
+    ExpectValue(storage, "a", kValue2, sizeof(kValue2));
+}
+
+TEST_F(TestWriteBackStorageCache, TestFlushOrder)
+{
+    CountingPersistentStorageDelegate storage;
+    EXPECT_SUCCESS(storage.SyncSetKeyValue("entry", kValue1, sizeof(kValue1)));
+
+    WriteBackStorageCache cache;
+    cache.Init(storage, 1024);
+    ExpectValue(cache, "entry", kValue1, sizeof(kValue1));
+
+    // Writes "count", "map" and "entry" in that order, though "entry" is the most recently used and "count" was written last
+    storage.AddPoisonKey("map", -1, 0);
+    CHIP_ERROR err = cache.CoalesceWrites([&]() -> CHIP_ERROR {
+        ReturnErrorOnFailure(cache.SyncSetKeyValue("count", kValue1, sizeof(kValue1)));
+        ReturnErrorOnFailure(cache.SyncSetKeyValue("map", kValue1, sizeof(kValue1)));
+        ReturnErrorOnFailure(cache.SyncDeleteKeyValue("entry"));
+        return cache.SyncSetKeyValue("count", kValue2, sizeof(kValue2));
+    });
+    EXPECT_EQ(err, CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+
+    // The writes stop at the one that failed
+    ExpectValue(storage, "count", kValue2, sizeof(kValue2));
+    EXPECT_FALSE(storage.HasKey("map"));
+    EXPECT_TRUE(storage.HasKey("entry"));
+    EXPECT_EQ(storage.mWrites, 3u);
+    EXPECT_EQ(storage.mDeletes, 0u);
+
+    // The values not written are still visible through the cache, and written by the next flush
+    ExpectValue(cache, "map", kValue1, sizeof(kValue1));
+    ExpectMissing(cache, "entry");
+
+    storage.ClearPoisonKeys();
+    EXPECT_SUCCESS(cache.Flush());
+    ExpectValue(storage, "map", kValue1, sizeof(kValue1));
+    EXPECT_FALSE(storage.HasKey("entry"));
+    EXPECT_EQ(storage.mWrites, 4u);
+    EXPECT_EQ(storage.mDeletes, 1u);
+}
+
+TEST_F(TestWriteBackStorageCache, TestShutdownWritesDirtyValues)
+{
+    CountingPersistentStorageDelegate storage;
+    WriteBackStorageCache cache;
+    cache.Init(storage, 1024);
+
+    EXPECT_SUCCESS(cache.CoalesceWrites([&]() -> CHIP_ERROR {
+        ReturnErrorOnFailure(cache.SyncSetKeyValue("a", kValue1, sizeof(kValue1)));
+        cache.Shutdown();
+        return CHIP_NO_ERROR;
+    }));
+    ExpectValue(storage, "a", kValue1, sizeof(kValue1));
+    EXPECT_FALSE(cache.IsInitialized());
+    EXPECT_EQ(cache.GetUsedBytes(), 0u);
+}
+
+} // namespace
@@ -34,6 +34,7 @@
 #include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/HashIndex.h>
 #include <lib/support/Span.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <platform/LockTracker.h>
@@ -94,6 +95,12 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+#if CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+/// Index of emAfEndpoints by endpoint ID. Every change of an EmberAfDefinedEndpoint::endpoint
+/// goes through setEndpointIdAtIndex so that the index stays in sync with the table.
+HashIndex<EmberAfDefinedEndpoint, MAX_ENDPOINT_COUNT> emberEndpointIndex;
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -147,15 +154,48 @@ bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
 }
 
-uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
+void setEndpointIdAtIndex(uint16_t index, EndpointId endpoint)
+{
+#if CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+    if (emAfEndpoints[index].endpoint != kInvalidEndpointId)
+    {
+        emberEndpointIndex.Remove(emAfEndpoints[index].endpoint, &emAfEndpoints[index]);
+    }
+    if (endpoint != kInvalidEndpointId)
+    {
+        // The index has room for every entry of emAfEndpoints, as long as it is kept in sync with them.
+        VerifyOrDie(emberEndpointIndex.Insert(endpoint, &emAfEndpoints[index]));
+    }
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+    emAfEndpoints[index].endpoint = endpoint;
+}
+
+// Returns the lowest index in [begin, end) of an endpoint with the given id, or
+// kEmberInvalidEndpointIndex if there is none.
+uint16_t findIndexFromEndpointInRange(EndpointId endpoint, uint16_t begin, uint16_t end, bool ignoreDisabledEndpoints)
 {
     if (endpoint == kInvalidEndpointId)
     {
         return kEmberInvalidEndpointIndex;
     }
 
+#if CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+    // Endpoint IDs are normally unique, but dynamic endpoints are only checked against each
+    // other, so keep the linear scan's "first match wins" behavior.
+    uint16_t found = kEmberInvalidEndpointIndex;
+    emberEndpointIndex.ForEach(endpoint, [&](EmberAfDefinedEndpoint * definedEndpoint) {
+        auto epi = static_cast<uint16_t>(definedEndpoint - emAfEndpoints);
+        if (definedEndpoint->endpoint == endpoint && epi >= begin && epi < end && epi < found &&
+            (!ignoreDisabledEndpoints || definedEndpoint->bitmask.Has(EmberAfEndpointOptions::isEnabled)))
+        {
+            found = epi;
+        }
+        return Loop::Continue;
+    });
+    return found;
+#else
     uint16_t epi;
-    for (epi = 0; epi < emberAfEndpointCount(); epi++)
+    for (epi = begin; epi < end; epi++)
     {
         if (emAfEndpoints[epi].endpoint == endpoint &&
             (!ignoreDisabledEndpoints || emAfEndpoints[epi].bitmask.Has(EmberAfEndpointOptions::isEnabled)))
@@ -164,6 +204,12 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         }
     }
     return kEmberInvalidEndpointIndex;
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+}
+
+uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
+{
+    return findIndexFromEndpointInRange(endpoint, 0, emberAfEndpointCount(), ignoreDisabledEndpoints);
 }
 
 // Returns the index of a given endpoint.  Considers disabled endpoints.
@@ -199,6 +245,10 @@ void emberAfEndpointConfigure()
 
     emberEndpointCount = FIXED_ENDPOINT_COUNT;
 
+#if CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+    emberEndpointIndex.Clear();
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+
 #if FIXED_ENDPOINT_COUNT > 0
 
     static_assert(FIXED_ENDPOINT_COUNT <= std::numeric_limits<decltype(ep)>::max(),
@@ -226,7 +276,7 @@ void emberAfEndpointConfigure()
     DataVersion * currentDataVersions = fixedEndpointDataVersions;
     for (ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
     {
-        emAfEndpoints[ep].endpoint = fixedEndpoints[ep];
+        setEndpointIdAtIndex(ep, fixedEndpoints[ep]);
         emAfEndpoints[ep].deviceTypeList =
             Span<const EmberAfDeviceType>(&fixedDeviceTypeList[fixedDeviceTypeListOffsets[ep]], fixedDeviceTypeListLengths[ep]);
         emAfEndpoints[ep].endpointType     = &generatedEmberAfEndpointTypes[fixedEmberAfEndpointTypes[ep]];
@@ -266,6 +316,7 @@ void emberAfEndpointConfigure()
         //
         for (ep = FIXED_ENDPOINT_COUNT; ep < MAX_ENDPOINT_COUNT; ep++)
         {
+            setEndpointIdAtIndex(ep, kInvalidEndpointId);
             emAfEndpoints[ep] = EmberAfDefinedEndpoint();
         }
     }
@@ -279,20 +330,13 @@ void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
 {
-    if (id == kInvalidEndpointId)
+    uint16_t index =
+        findIndexFromEndpointInRange(id, FIXED_ENDPOINT_COUNT, MAX_ENDPOINT_COUNT, false /* ignoreDisabledEndpoints */);
+    if (index == kEmberInvalidEndpointIndex)
     {
         return kEmberInvalidEndpointIndex;
     }
-
-    uint16_t index;
-    for (index = FIXED_ENDPOINT_COUNT; index < MAX_ENDPOINT_COUNT; index++)
-    {
-        if (emAfEndpoints[index].endpoint == id)
-        {
-            return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
-        }
-    }
-    return kEmberInvalidEndpointIndex;
+    return static_cast<uint16_t>(index - FIXED_ENDPOINT_COUNT);
 }
 
 CHIP_ERROR emberAfSetDynamicEndpoint(uint16_t index, EndpointId id, const EmberAfEndpointType * ep,
@@ -325,12 +369,9 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
     }
 
     index = static_cast<uint16_t>(realIndex);
-    for (uint16_t i = FIXED_ENDPOINT_COUNT; i < MAX_ENDPOINT_COUNT; i++)
+    if (emberAfGetDynamicIndexFromEndpoint(id) != kEmberInvalidEndpointIndex)
     {
-        if (emAfEndpoints[i].endpoint == id)
-        {
-            return CHIP_ERROR_ENDPOINT_EXISTS;
-        }
+        return CHIP_ERROR_ENDPOINT_EXISTS;
     }
 
     const size_t bufferSize = Compatibility::Internal::gEmberAttributeIOBufferSpan.size();
@@ -357,7 +398,7 @@ CHIP_ERROR emberAfSetDynamicEndpointWithEpUniqueId(uint16_t index, EndpointId id
             }
         }
     }
-    emAfEndpoints[index].endpoint       = id;
+    setEndpointIdAtIndex(index, id);
     emAfEndpoints[index].deviceTypeList = deviceTypeList;
     emAfEndpoints[index].endpointType   = ep;
     emAfEndpoints[index].dataVersions   = dataVersionStorage.data();
@@ -409,7 +450,7 @@ EndpointId emberAfClearDynamicEndpoint(uint16_t index, MatterClusterShutdownType
     {
         ep = emAfEndpoints[index].endpoint;
         emberAfEndpointEnableDisable(ep, false, shutdownType);
-        emAfEndpoints[index].endpoint = kInvalidEndpointId;
+        setEndpointIdAtIndex(index, kInvalidEndpointId);
     }
 
     emberMetadataStructureGeneration++;
@@ -657,116 +698,144 @@ bool emAfMatchAttribute(const EmberAfCluster * cluster, const EmberAfAttributeMe
 // type.  For strings, the function will copy as many bytes as will fit in the
 // attribute.  This means the resulting string may be truncated.  The length
 // byte(s) in the resulting string will reflect any truncated.
-Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeMetadata ** metadata,
-                                uint8_t * buffer, uint16_t readLength, bool write)
+static Status emAfReadOrWriteAttributeOnEndpoint(uint16_t ep, uint16_t attributeOffsetIndex,
+                                                const EmberAfAttributeSearchRecord * attRecord,
+                                                const EmberAfAttributeMetadata ** metadata, uint8_t * buffer, uint16_t readLength,
+                                                bool write)
 {
-    assertChipStackLockedByCurrentThread();
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
 
-    uint16_t attributeOffsetIndex = 0;
-
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+    uint8_t clusterIndex;
+    for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
-
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
             {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
-            {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    // If passed metadata location is not null, populate
+                    if (metadata != nullptr)
                     {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
-
-                            uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
-                            uint8_t *src, *dst;
-                            if (write)
-                            {
-                                src = buffer;
-                                dst = attributeLocation;
-                                if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                         am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
-                            else
-                            {
-                                if (buffer == nullptr)
-                                {
-                                    return Status::Success;
-                                }
-
-                                src = attributeLocation;
-                                dst = buffer;
-                                if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
+                        *metadata = am;
+                    }
 
-                            // Is the attribute externally stored?
-                            if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                            {
-                                if (write)
-                                {
-                                    return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                 buffer);
-                                }
-
-                                if (readLength < emberAfAttributeSize(am))
-                                {
-                                    // Prevent a potential buffer overflow
-                                    return Status::ResourceExhausted;
-                                }
-
-                                return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
-                                                                            emberAfAttributeSize(am));
-                            }
+                    uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
+                    uint8_t *src, *dst;
+                    if (write)
+                    {
+                        src = buffer;
+                        dst = attributeLocation;
+                        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                        {
+                            return Status::UnsupportedAccess;
+                        }
+                    }
+                    else
+                    {
+                        if (buffer == nullptr)
+                        {
+                            return Status::Success;
+                        }
 
-                            // Internal storage is only supported for fixed endpoints
-                            if (!isDynamicEndpoint)
-                            {
-                                return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                            }
+                        src = attributeLocation;
+                        dst = buffer;
+                        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                        {
+                            return Status::UnsupportedAccess;
+                        }
+                    }
 
-                            return Status::Failure;
+                    // Is the attribute externally stored?
+                    if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+                    {
+                        if (write)
+                        {
+                            return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
                         }
 
-                        // Not the attribute we are looking for
-                        // Increase the index if attribute is not externally stored
-                        if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                        if (readLength < emberAfAttributeSize(am))
                         {
-                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                            // Prevent a potential buffer overflow
+                            return Status::ResourceExhausted;
                         }
+
+                        return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                                    emberAfAttributeSize(am));
                     }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
+                    // Internal storage is only supported for fixed endpoints
+                    if (!isDynamicEndpoint)
+                    {
+                        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+                    }
+
+                    return Status::Failure;
                 }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                // Not the attribute we are looking for
+                // Increase the index if attribute is not externally stored
+                if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                {
+                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                }
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+            // Attribute is not in the cluster.
+            return Status::UnsupportedAttribute;
+        }
+
+        // Not the cluster we are looking for
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+    }
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
+}
+
+Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord, const EmberAfAttributeMetadata ** metadata,
+                                uint8_t * buffer, uint16_t readLength, bool write)
+{
+    assertChipStackLockedByCurrentThread();
+
+    uint16_t attributeOffsetIndex = 0;
+
+#if CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+    uint16_t ep = emberAfIndexFromEndpoint(attRecord->endpoint);
+    if (ep == kEmberInvalidEndpointIndex)
+    {
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
+
+    // Only fixed endpoints have internal attribute storage, laid out in endpoint order. Endpoints
+    // before ep with the same id are disabled ones, which the search below skips as well.
+    for (uint16_t i = 0; ep < emberAfFixedEndpointCount() && i < ep; i++)
+    {
+        if (emAfEndpoints[i].endpoint != attRecord->endpoint)
+        {
+            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
+        }
+    }
+
+    return emAfReadOrWriteAttributeOnEndpoint(ep, attributeOffsetIndex, attRecord, metadata, buffer, readLength, write);
+#else
+    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    {
+        // Is this a dynamic endpoint?
+        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+
+        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
+        {
+            if (!emberAfEndpointIndexIsEnabled(ep))
+            {
+                continue;
+            }
+            return emAfReadOrWriteAttributeOnEndpoint(ep, attributeOffsetIndex, attRecord, metadata, buffer, readLength, write);
         }
 
         // Not the endpoint we are looking for
@@ -777,6 +846,7 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
         }
     }
     return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
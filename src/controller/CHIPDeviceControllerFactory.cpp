@@ -28,6 +28,7 @@
 #include <app/OperationalSessionSetup.h>
 #include <app/reporting/ReportSchedulerImpl.h>
 #include <app/util/DataModelHandler.h>
+#include <lib/address_resolve/AddressResolve.h>
 #include <lib/core/ErrorStr.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 
@@ -177,6 +178,7 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     ReturnErrorOnFailure(stateParams.transportMgr->Init(Transport::UdpListenParameters(stateParams.udpEndPointManager)
                                                             .SetAddressType(Inet::IPAddressType::kIPv6)
                                                             .SetListenPort(params.listenPort)
+                                                            .SetQueueSends(true)
 #if INET_CONFIG_ENABLE_IPV4
                                                             ,
                                                         //
@@ -186,6 +188,7 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
                                                         Transport::UdpListenParameters(stateParams.udpEndPointManager)
                                                             .SetAddressType(Inet::IPAddressType::kIPv4)
                                                             .SetListenPort(params.listenPort)
+                                                            .SetQueueSends(true)
 #endif
 #if CONFIG_NETWORK_LAYER_BLE
                                                             ,
@@ -350,6 +353,9 @@ CHIP_ERROR DeviceControllerFactory::InitSystemState(FactoryInitParams params)
     stateParams.caseSessionManager = Platform::New<CASESessionManager>();
     ReturnErrorOnFailure(stateParams.caseSessionManager->Init(stateParams.systemLayer, sessionManagerConfig));
 
+    // Let a restarted controller reach nodes whose addresses it resolved recently without waiting for DNS-SD.
+    AddressResolve::Resolver::Instance().SetCacheStorage(params.fabricIndependentStorage);
+
     ReturnErrorOnFailure(interactionModelEngine->Init(stateParams.exchangeMgr, stateParams.fabricTable, stateParams.reportScheduler,
                                                       stateParams.caseSessionManager));
 
@@ -409,4 +409,25 @@ TEST_F(TestServerCommandDispatch, TestDataResponseHandlerOverride2)
     TestDataResponseHelper(&testEndpoint3, true);
 }
 
+TEST_F(TestServerCommandDispatch, TestDynamicEndpointAfterReconfigure)
+{
+    DataVersion dataVersionStorage[MATTER_ARRAY_SIZE(testEndpointClusters1)];
+
+    // Configuring the data model again drops the dynamic endpoints, which can then be added again, more times than there are
+    // endpoint slots.
+    for (uint16_t i = 0; i <= MAX_ENDPOINT_COUNT; i++)
+    {
+        emberAfEndpointConfigure();
+        EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+        EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+
+        EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint1, Span<DataVersion>(dataVersionStorage)));
+        EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId), 0u);
+        EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId), emberAfFixedEndpointCount());
+    }
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId), kEmberInvalidEndpointIndex);
+}
+
 } // namespace
@@ -246,6 +246,21 @@ public:
     CHIP_ERROR FindValidCert(const ChipDN & subjectDN, const CertificateKeyId & subjectKeyId, ValidationContext & context,
                              const ChipCertificateData ** certData);
 
+    /**
+     * @brief Check the validity period of a CHIP certificate against the effective time of the validation
+     *        context, and apply the validity policy of the context (or the default policy) to the result.
+     *
+     *        This is the part of the certificate validation that depends on time.
+     *
+     * @param cert     Pointer to the CHIP certificate to be checked.
+     * @param context  Certificate validation context.
+     * @param depth    Depth of the certificate in the certificate validation chain, where the leaf is at depth 0.
+     *
+     * @return Returns CHIP_NO_ERROR if the policy accepts the certificate, the error of the policy otherwise
+     **/
+    static CHIP_ERROR ValidateCertValidityPeriod(const ChipCertificateData * cert, const ValidationContext & context,
+                                                 uint8_t depth);
+
     // Deprecated, use the equivalent free function VerifyCertSignature()
     static CHIP_ERROR VerifySignature(const ChipCertificateData * cert, const ChipCertificateData * caCert);
 
@@ -394,10 +394,101 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
-    return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
+    return VerifyCredentials(GetVerifiedCertChainCache(), noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId,
+                             outNodeId, outNocPubkey, outRootPublicKey);
+}
+
+namespace {
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+// Checks the validity periods of the certificates of a chain that was verified before, as verifying it does (from
+// the NOC to the RCAC), against the effective time and validity policy of `context`.
+CHIP_ERROR ValidateVerifiedChainValidityPeriods(ByteSpan noc, ByteSpan icac, ByteSpan rcac, const ValidationContext & context)
+{
+    constexpr uint8_t kMaxNumCertsInOpCreds = 3;
+
+    ChipCertificateSet certificates;
+    ReturnErrorOnFailure(certificates.Init(kMaxNumCertsInOpCreds));
+
+    ReturnErrorOnFailure(certificates.LoadCert(rcac, BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor)));
+    if (!icac.empty())
+    {
+        ReturnErrorOnFailure(certificates.LoadCert(icac, BitFlags<CertDecodeFlags>()));
+    }
+    ReturnErrorOnFailure(certificates.LoadCert(noc, BitFlags<CertDecodeFlags>()));
+
+    for (uint8_t depth = 0; depth < certificates.GetCertCount(); depth++)
+    {
+        const ChipCertificateData * cert = &certificates.GetCertSet()[certificates.GetCertCount() - 1 - depth];
+        CHIP_ERROR err                   = ChipCertificateSet::ValidateCertValidityPeriod(cert, context, depth);
+        if (err != CHIP_NO_ERROR)
+        {
+            // Same error as when an issuer is rejected during a full verification.
+            VerifyOrReturnError(depth > 0, err);
+            ChipLogError(SecureChannel, "Failed to find valid cert during chain traversal: %" CHIP_ERROR_FORMAT, err.Format());
+            return CHIP_ERROR_CA_CERT_NOT_FOUND;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+} // namespace
+
+CHIP_ERROR FabricTable::VerifyCredentials(VerifiedCertChainCache * cache, ByteSpan noc, ByteSpan icac, ByteSpan rcac,
+                                          ValidationContext & context, CompressedFabricId & outCompressedFabricId,
+                                          FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
+                                          Crypto::P256PublicKey * outRootPublicKey)
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    VerifiedCertChainCache::Key key;
+    if (cache != nullptr && VerifiedCertChainCache::ComputeKey(noc, icac, rcac, context, key) == CHIP_NO_ERROR)
+    {
+        VerifiedCertChainCache::VerifiedChain chain;
+        if (cache->Find(key, chain))
+        {
+            ReturnErrorOnFailure(ValidateVerifiedChainValidityPeriods(noc, icac, rcac, context));
+        }
+        else
+        {
+            ReturnErrorOnFailure(VerifyCredentials(noc, icac, rcac, context, chain.mCompressedFabricId, chain.mFabricId,
+                                                   chain.mNodeId, chain.mNocPublicKey, &chain.mRootPublicKey));
+            cache->Add(key, chain);
+        }
+
+        outCompressedFabricId = chain.mCompressedFabricId;
+        outFabricId           = chain.mFabricId;
+        outNodeId             = chain.mNodeId;
+        outNocPubkey          = chain.mNocPublicKey;
+        if (outRootPublicKey != nullptr)
+        {
+            *outRootPublicKey = chain.mRootPublicKey;
+        }
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+    return VerifyCredentials(noc, icac, rcac, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
                              outRootPublicKey);
 }
 
+VerifiedCertChainCache * FabricTable::GetVerifiedCertChainCache() const
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    return &mVerifiedCertChainCache;
+#else
+    return nullptr;
+#endif
+}
+
+void FabricTable::ClearVerifiedCertChainCache()
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    mVerifiedCertChainCache.Clear();
+#endif
+}
+
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
                                           CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                           Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey)
@@ -970,6 +1061,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
         }
     }
 
+    ClearVerifiedCertChainCache();
+
     FabricInfo * fabricInfo = GetMutableFabricByIndex(fabricIndex);
     if (fabricInfo == &mPendingFabric)
     {
@@ -1858,6 +1951,8 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
 {
     VerifyOrReturnError((mStorage != nullptr) && (mOpCertStore != nullptr), CHIP_ERROR_INCORRECT_STATE);
 
+    ClearVerifiedCertChainCache();
+
     bool haveNewTrustedRoot      = mStateFlags.Has(StateFlags::kIsTrustedRootPending);
     bool isAdding                = mStateFlags.Has(StateFlags::kIsAddPending);
     bool isUpdating              = mStateFlags.Has(StateFlags::kIsUpdatePending);
@@ -2084,6 +2179,8 @@ CHIP_ERROR FabricTable::CommitPendingFabricData()
 void FabricTable::RevertPendingFabricData()
 {
     MATTER_TRACE_SCOPE("RevertPendingFabricData", "Fabric");
+    ClearVerifiedCertChainCache();
+
     // Will clear pending UpdateNoc/AddNOC
     RevertPendingOpCertsExceptRoot();
 
@@ -2107,6 +2204,7 @@ void FabricTable::RevertPendingFabricData()
 void FabricTable::RevertPendingOpCertsExceptRoot()
 {
     MATTER_TRACE_SCOPE("RevertPendingOpCertsExceptRoot", "Fabric");
+    ClearVerifiedCertChainCache();
     mPendingFabric.Reset();
 
     if (mStateFlags.Has(StateFlags::kIsPendingFabricDataPresent))
@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedCertChainCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -1016,6 +1017,28 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    // Verifies credentials, using the provided root certificate. If `cache` is not null, chains it remembers only have their
+    // validity periods checked, and chains verified successfully are added to it.
+    static CHIP_ERROR VerifyCredentials(Credentials::VerifiedCertChainCache * cache, ByteSpan noc, ByteSpan icac, ByteSpan rcac,
+                                        Credentials::ValidationContext & context, CompressedFabricId & outCompressedFabricId,
+                                        FabricId & outFabricId, NodeId & outNodeId, Crypto::P256PublicKey & outNocPubkey,
+                                        Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    /**
+     * @brief Returns the cache of verified certificate chains used by VerifyCredentials, or nullptr if it is disabled
+     *        (CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE is 0).
+     *
+     * The cache may be used from any thread.
+     */
+    Credentials::VerifiedCertChainCache * GetVerifiedCertChainCache() const;
+
+    /**
+     * @brief Forgets the verified certificate chains, so that they are fully verified again.
+     *
+     * This is done whenever fabrics or trusted roots change.
+     */
+    void ClearVerifiedCertChainCache();
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1298,6 +1321,11 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+    // Not part of the state of the table: verifying credentials updates it.
+    mutable Credentials::VerifiedCertChainCache mVerifiedCertChainCache;
+#endif
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
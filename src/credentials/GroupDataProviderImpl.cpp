@@ -25,6 +25,8 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <stdlib.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Credentials {
 
@@ -855,6 +857,7 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+    InvalidateGroupSessionIndex();
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
@@ -1431,6 +1434,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 CHIP_ERROR GroupDataProviderImpl::SetGroupKey(FabricIndex fabric_index, GroupId group_id, KeysetId keyset_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     ReturnErrorOnFailure(fabric.Load(mStorage));
@@ -1461,6 +1465,7 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupKey(FabricIndex fabric_index, GroupId
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map(fabric_index);
@@ -1552,6 +1557,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeyMapData map;
@@ -1585,6 +1591,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_INVALID_FABRIC_INDEX);
@@ -1662,6 +1669,7 @@ CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, cons
                                             const KeySet & in_keyset)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
     VerifyOrReturnError(in_keyset.num_keys_used >= 1 && in_keyset.num_keys_used <= KeySet::kEpochKeysMax,
                         CHIP_ERROR_INVALID_ARGUMENT);
     if (in_keyset.policy != SecurityPolicy::kTrustFirst)
@@ -1737,6 +1745,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
+    InvalidateGroupSessionIndex();
 
     FabricData fabric(fabric_index);
     KeySetData keyset;
@@ -1838,6 +1847,8 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    InvalidateGroupSessionIndex();
+
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1985,12 +1996,135 @@ CHIP_ERROR GroupDataProviderImpl::GroupKeyContext::PrivacyDecrypt(const ByteSpan
 GroupDataProviderImpl::GroupSessionIterator * GroupDataProviderImpl::IterateGroupSessions(uint16_t session_id)
 {
     VerifyOrReturnError(IsInitialized(), nullptr);
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    // Live iterators may point into the index, so it is only rebuilt when there are none
+    if (mGroupSessionIndexState == GroupSessionIndexState::kStale && mGroupSessionsIterator.Allocated() == 0)
+    {
+        BuildGroupSessionIndex();
+    }
+#endif
     return mGroupSessionsIterator.CreateObject(*this, session_id);
 }
 
+void GroupDataProviderImpl::InvalidateGroupSessionIndex()
+{
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    mGroupSessionIndexState = GroupSessionIndexState::kStale;
+    if (mGroupSessionsIterator.Allocated() == 0)
+    {
+        // Do not keep the keys of removed keysets around until the next rebuild
+        ClearGroupSessionIndex();
+    }
+#endif
+}
+
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
+void GroupDataProviderImpl::ClearGroupSessionIndex()
+{
+    Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(mGroupSessionIndex), sizeof(mGroupSessionIndex));
+    mGroupSessionIndexCount = 0;
+}
+
+CHIP_ERROR GroupDataProviderImpl::AddToGroupSessionIndex(FabricIndex fabric_index, GroupId group_id, SecurityPolicy policy,
+                                                         const Crypto::GroupOperationalCredentials & creds)
+{
+    VerifyOrReturnError(mGroupSessionIndexCount < MATTER_ARRAY_SIZE(mGroupSessionIndex), CHIP_ERROR_NO_MEMORY);
+
+    // Keep the entries ordered by session id, and in storage order within a session id,
+    // which is the order the storage iteration yields them in.
+    size_t pos = mGroupSessionIndexCount;
+    while (pos > 0 && mGroupSessionIndex[pos - 1].session_id > creds.hash)
+    {
+        mGroupSessionIndex[pos] = mGroupSessionIndex[pos - 1];
+        pos--;
+    }
+
+    GroupSessionIndexEntry & entry = mGroupSessionIndex[pos];
+    entry.session_id               = creds.hash;
+    entry.fabric_index             = fabric_index;
+    entry.security_policy          = policy;
+    entry.group_id                 = group_id;
+    memcpy(entry.encryption_key, creds.encryption_key, sizeof(entry.encryption_key));
+    memcpy(entry.privacy_key, creds.privacy_key, sizeof(entry.privacy_key));
+    mGroupSessionIndexCount++;
+    return CHIP_NO_ERROR;
+}
+
+void GroupDataProviderImpl::BuildGroupSessionIndex()
+{
+    ClearGroupSessionIndex();
+    mGroupSessionIndexState = GroupSessionIndexState::kStale;
+
+    FabricList fabric_list;
+    CHIP_ERROR err = fabric_list.Load(mStorage);
+    if (CHIP_ERROR_NOT_FOUND == err)
+    {
+        // No fabric, no group sessions
+        mGroupSessionIndexState = GroupSessionIndexState::kValid;
+        return;
+    }
+    VerifyOrReturn(CHIP_NO_ERROR == err);
+
+    FabricData fabric(fabric_list.first_entry);
+    for (size_t i = 0; i < fabric_list.entry_count; i++, fabric.fabric_index = fabric.next)
+    {
+        // On storage errors, leave the index stale: sessions are matched from storage, and the
+        // index is rebuilt for the next message.
+        VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(mStorage), ClearGroupSessionIndex());
+
+        KeyMapData mapping(fabric.fabric_index, fabric.first_map);
+        for (uint16_t j = 0; j < fabric.map_count; ++j, mapping.id = mapping.next)
+        {
+            VerifyOrReturn(CHIP_NO_ERROR == mapping.Load(mStorage), ClearGroupSessionIndex());
+
+            KeySetData keyset;
+            if (!keyset.Find(mStorage, fabric, mapping.keyset_id))
+            {
+                // The storage iteration ends at a mapping to a missing keyset; so does the index
+                mGroupSessionIndexState = GroupSessionIndexState::kValid;
+                return;
+            }
+
+            for (uint16_t k = 0; k < keyset.keys_count && k < KeySet::kEpochKeysMax; ++k)
+            {
+                err = AddToGroupSessionIndex(fabric.fabric_index, mapping.group_id, keyset.policy, keyset.operational_keys[k]);
+                if (CHIP_NO_ERROR != err)
+                {
+                    ChipLogProgress(Crypto, "Too many group session keys to index, matching group messages from storage");
+                    ClearGroupSessionIndex();
+                    mGroupSessionIndexState = GroupSessionIndexState::kOverflow;
+                    return;
+                }
+            }
+        }
+    }
+    mGroupSessionIndexState = GroupSessionIndexState::kValid;
+}
+
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
 GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupDataProviderImpl & provider, uint16_t session_id) :
     mProvider(provider), mSessionId(session_id), mGroupKeyContext(provider)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (provider.mGroupSessionIndexState == GroupSessionIndexState::kValid)
+    {
+        const GroupSessionIndexEntry * begin = provider.mGroupSessionIndex;
+        const GroupSessionIndexEntry * end   = begin + provider.mGroupSessionIndexCount;
+
+        mIndexed    = true;
+        mIndexEntry = std::lower_bound(begin, end, session_id,
+                                       [](const GroupSessionIndexEntry & entry, uint16_t id) { return entry.session_id < id; });
+        mIndexEnd   = mIndexEntry;
+        while (mIndexEnd != end && mIndexEnd->session_id == session_id)
+        {
+            ++mIndexEnd;
+        }
+        return;
+    }
+#endif
+
     FabricList fabric_list;
     ReturnOnFailure(fabric_list.Load(provider.mStorage));
     mFirstFabric = fabric_list.first_entry;
@@ -2003,6 +2137,13 @@ GroupDataProviderImpl::GroupSessionIteratorImpl::GroupSessionIteratorImpl(GroupD
 
 size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        return static_cast<size_t>(mIndexEnd - mIndexEntry);
+    }
+#endif
+
     FabricData fabric(mFirstFabric);
     size_t count = 0;
 
@@ -2044,6 +2185,20 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
 
 bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output)
 {
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    if (mIndexed)
+    {
+        VerifyOrReturnValue(mIndexEntry != mIndexEnd, false);
+        const GroupSessionIndexEntry & entry = *mIndexEntry++;
+        TEMPORARY_RETURN_IGNORED mGroupKeyContext.Initialize(entry.encryption_key, mSessionId, entry.privacy_key);
+        output.fabric_index    = entry.fabric_index;
+        output.group_id        = entry.group_id;
+        output.security_policy = entry.security_policy;
+        output.keyContext      = &mGroupKeyContext;
+        return true;
+    }
+#endif
+
     while (mFabricCount < mFabricTotal)
     {
         FabricData fabric(mFabric);
@@ -251,6 +251,26 @@ protected:
         size_t mTotal       = 0;
     };
 
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    // A group session candidate: an operational key of a keyset mapped to a group.
+    struct GroupSessionIndexEntry
+    {
+        uint16_t session_id;
+        FabricIndex fabric_index;
+        SecurityPolicy security_policy;
+        GroupId group_id;
+        Crypto::Symmetric128BitsKeyByteArray encryption_key;
+        Crypto::Symmetric128BitsKeyByteArray privacy_key;
+    };
+
+    enum class GroupSessionIndexState : uint8_t
+    {
+        kStale,    // Rebuilt from storage by the next IterateGroupSessions()
+        kValid,    // Holds every candidate, ordered by session id
+        kOverflow, // Too many candidates: sessions are matched from storage until the keys change
+    };
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+
     class GroupSessionIteratorImpl : public GroupSessionIterator
     {
     public:
@@ -272,8 +292,23 @@ protected:
         uint16_t mKeyCount       = 0;
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+        // Candidates left in the provider's index, if it was valid when the iterator was created
+        bool mIndexed                              = false;
+        const GroupSessionIndexEntry * mIndexEntry = nullptr;
+        const GroupSessionIndexEntry * mIndexEnd   = nullptr;
+#endif
     };
 
+    // Called before any change to the group key map, the keysets, or the fabric list
+    void InvalidateGroupSessionIndex();
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    void BuildGroupSessionIndex();
+    CHIP_ERROR AddToGroupSessionIndex(FabricIndex fabric_index, GroupId group_id, SecurityPolicy policy,
+                                      const Crypto::GroupOperationalCredentials & creds);
+    void ClearGroupSessionIndex();
+#endif
+
     PersistentStorageDelegate * mStorage       = nullptr;
     Crypto::SessionKeystore * mSessionKeystore = nullptr;
     ObjectPool<GroupInfoIteratorImpl, kIteratorsMax> mGroupInfoIterators;
@@ -283,6 +318,11 @@ protected:
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
     bool mAuxAclNotificationNeeded = false;
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    GroupSessionIndexEntry mGroupSessionIndex[CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE];
+    size_t mGroupSessionIndexCount                 = 0;
+    GroupSessionIndexState mGroupSessionIndexState = GroupSessionIndexState::kStale;
+#endif
 };
 
 } // namespace Credentials
@@ -0,0 +1,159 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedCertChainCache.h>
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+
+#include <cstring>
+#include <mutex>
+
+namespace chip {
+namespace Credentials {
+
+namespace {
+
+CHIP_ERROR AddCert(Crypto::Hash_SHA256_stream & hash, ByteSpan cert)
+{
+    // Length-prefixed, so that certificates cannot be shifted from one to the next.
+    uint8_t length[sizeof(uint32_t)];
+    Encoding::LittleEndian::Put32(length, static_cast<uint32_t>(cert.size()));
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(length)));
+    return hash.AddData(cert);
+}
+
+} // namespace
+
+bool VerifiedCertChainCache::Key::operator==(const Key & other) const
+{
+    return memcmp(mHash, other.mHash, sizeof(mHash)) == 0;
+}
+
+VerifiedCertChainCache::VerifiedCertChainCache()
+{
+    VerifyOrDie(System::Mutex::Init(mLock) == CHIP_NO_ERROR);
+}
+
+CHIP_ERROR VerifiedCertChainCache::ComputeKey(ByteSpan noc, ByteSpan icac, ByteSpan rcac, const ValidationContext & context,
+                                              Key & outKey)
+{
+    Crypto::Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+
+    uint8_t requirements[sizeof(uint16_t) + 2 * sizeof(uint8_t)];
+    Encoding::LittleEndian::Put16(requirements, context.mRequiredKeyUsages.Raw());
+    requirements[2] = context.mRequiredKeyPurposes.Raw();
+    requirements[3] = to_underlying(context.mRequiredCertType);
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(requirements)));
+
+    ReturnErrorOnFailure(AddCert(hash, noc));
+    ReturnErrorOnFailure(AddCert(hash, icac));
+    ReturnErrorOnFailure(AddCert(hash, rcac));
+
+    MutableByteSpan hashSpan(outKey.mHash);
+    return hash.Finish(hashSpan);
+}
+
+bool VerifiedCertChainCache::Find(const Key & key, VerifiedChain & outChain)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.mLastUsed != 0 && entry.mKey == key)
+        {
+            entry.mLastUsed = NextUse();
+            outChain        = entry.mChain;
+            return true;
+        }
+    }
+    return false;
+}
+
+void VerifiedCertChainCache::Add(const Key & key, const VerifiedChain & chain)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    uint32_t use = NextUse();
+
+    // Replace the same chain if it is there (e.g. added by two concurrent verifications), else a free entry, else the least
+    // recently used one.
+    Entry * target = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if (entry.mLastUsed != 0 && entry.mKey == key)
+        {
+            target = &entry;
+            break;
+        }
+        if (entry.mLastUsed < target->mLastUsed)
+        {
+            target = &entry;
+        }
+    }
+
+    target->mKey      = key;
+    target->mChain    = chain;
+    target->mLastUsed = use;
+}
+
+void VerifiedCertChainCache::Clear()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & entry : mEntries)
+    {
+        entry.mLastUsed = 0;
+    }
+    mUseCount = 0;
+}
+
+uint32_t VerifiedCertChainCache::NextUse()
+{
+    if (mUseCount == UINT32_MAX)
+    {
+        // Forget all chains rather than let the use counts wrap around, which only happens after billions of uses.
+        for (auto & entry : mEntries)
+        {
+            entry.mLastUsed = 0;
+        }
+        mUseCount = 0;
+    }
+    return ++mUseCount;
+}
+
+size_t VerifiedCertChainCache::Count()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        count += (entry.mLastUsed != 0) ? 1 : 0;
+    }
+    return count;
+}
+
+} // namespace Credentials
+} // namespace chip
+
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
@@ -0,0 +1,119 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @brief Defines a cache of the operational certificate chains that were verified.
+ */
+
+#pragma once
+
+#include <credentials/CHIPCertificateSet.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/NodeId.h>
+#include <lib/support/Span.h>
+#include <system/SystemMutex.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Credentials {
+
+class VerifiedCertChainCache;
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+/**
+ * Remembers the operational certificate chains (NOC, optional ICAC and RCAC) that were verified, along with the
+ * identity they carry, so that verifying the same chain again (e.g. when a peer reconnects over CASE) does not take
+ * checking certificate signatures or deriving the compressed fabric id again.
+ *
+ * Only what does not depend on time is remembered: the validity periods of a remembered chain are still checked, with
+ * the validity policy, every time it is verified.
+ *
+ * Chains are identified by a SHA-256 hash of their certificates and of the key usages, key purposes and certificate
+ * type required by the validation context. When the cache is full, the least recently used chain is forgotten.
+ *
+ * THREAD SAFETY:
+ *    All methods may be called from any thread (CASE verifies Sigma3 in a background task).
+ */
+class VerifiedCertChainCache
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE;
+
+    /// Identifies a certificate chain, and the requirements it was verified against.
+    struct Key
+    {
+        uint8_t mHash[Crypto::kSHA256_Hash_Length];
+
+        bool operator==(const Key & other) const;
+    };
+
+    /// The results of the verification of a chain.
+    struct VerifiedChain
+    {
+        CompressedFabricId mCompressedFabricId;
+        FabricId mFabricId;
+        NodeId mNodeId;
+        Crypto::P256PublicKey mNocPublicKey;
+        Crypto::P256PublicKey mRootPublicKey;
+    };
+
+    VerifiedCertChainCache();
+
+    VerifiedCertChainCache(const VerifiedCertChainCache &)             = delete;
+    VerifiedCertChainCache & operator=(const VerifiedCertChainCache &) = delete;
+
+    static CHIP_ERROR ComputeKey(ByteSpan noc, ByteSpan icac, ByteSpan rcac, const ValidationContext & context, Key & outKey);
+
+    /// Returns true, and the results of its verification in `outChain`, if the chain identified by `key` was verified.
+    bool Find(const Key & key, VerifiedChain & outChain);
+
+    /// Remembers the chain identified by `key` as verified.
+    void Add(const Key & key, const VerifiedChain & chain);
+
+    /// Forgets all chains.
+    void Clear();
+
+    /// Returns the number of chains remembered.
+    size_t Count();
+
+private:
+    struct Entry
+    {
+        Key mKey;
+        VerifiedChain mChain;
+        uint32_t mLastUsed = 0; // 0 if the entry is free
+    };
+
+    // Returns the use count of an entry used now. Must be called with mLock held.
+    uint32_t NextUse();
+
+    System::Mutex mLock;
+    Entry mEntries[kCapacity];
+    uint32_t mUseCount = 0;
+};
+
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+} // namespace Credentials
+} // namespace chip
@@ -22,6 +22,7 @@
  */
 
 #include <errno.h>
+#include <memory>
 #include <stdarg.h>
 
 #include <pw_unit_test/framework.h>
@@ -43,6 +44,7 @@
 #include <lib/support/tests/ExtraPwTestMacros.h>
 
 #include <platform/ConfigurationManager.h>
+#include <system/SystemClock.h>
 
 #include <lib/support/BytesToHex.h>
 
@@ -3253,6 +3255,224 @@ TEST_F(TestFabricTable, DeleteFabricCallsDelegate)
     fabricTable.RemoveFabricDelegate(&fabricDelegate);
 }
 
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+class CountingValidityPolicy : public CertificateValidityPolicy
+{
+public:
+    CHIP_ERROR ApplyCertificateValidityPolicy(const ChipCertificateData * cert, uint8_t depth,
+                                              CertificateValidityResult result) override
+    {
+        mCallCount++;
+        return CertificateValidityPolicy::ApplyDefaultPolicy(cert, depth, result);
+    }
+
+    size_t mCallCount = 0;
+};
+
+TEST_F(TestFabricTable, TestVerifiedCertChainCache)
+{
+    chip::TestPersistentStorageDelegate storage;
+    ScopedFabricTable fabricTableHolder;
+    EXPECT_EQ(fabricTableHolder.Init(&storage), CHIP_NO_ERROR);
+    FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+    EXPECT_EQ(LoadTestFabric_Node01_01(fabricTable, /* doCommit = */ true), CHIP_NO_ERROR);
+
+    VerifiedCertChainCache * cache = fabricTable.GetVerifiedCertChainCache();
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->Count(), 0u);
+
+    ByteSpan rcacSpan(TestCerts::sTestCert_Root01_Chip);
+    ByteSpan icacSpan(TestCerts::sTestCert_ICA01_Chip);
+    ByteSpan nocSpan(TestCerts::sTestCert_Node01_01_Chip);
+
+    ChipCertificateData nocData;
+    EXPECT_EQ(DecodeChipCert(nocSpan, nocData), CHIP_NO_ERROR);
+
+    CountingValidityPolicy policy;
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    context.mValidityPolicy = &policy;
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(nocData.mNotBeforeTime + 1));
+
+    CompressedFabricId expectedCompressedFabricId;
+    FabricId expectedFabricId;
+    NodeId expectedNodeId;
+    Crypto::P256PublicKey expectedNocPubKey;
+    Crypto::P256PublicKey expectedRootPubKey;
+    EXPECT_EQ(FabricTable::VerifyCredentials(nocSpan, icacSpan, rcacSpan, context, expectedCompressedFabricId, expectedFabricId,
+                                             expectedNodeId, expectedNocPubKey, &expectedRootPubKey),
+              CHIP_NO_ERROR);
+
+    // The first verification goes through the whole chain and remembers it, the second one is found in the cache. Both
+    // give the same results as the uncached verification, and both apply the validity policy to every certificate.
+    for (int i = 0; i < 2; i++)
+    {
+        CompressedFabricId compressedFabricId = kUndefinedCompressedFabricId;
+        FabricId fabricId                     = kUndefinedFabricId;
+        NodeId nodeId                         = kUndefinedNodeId;
+        Crypto::P256PublicKey nocPubKey;
+        Crypto::P256PublicKey rootPubKey;
+
+        policy.mCallCount = 0;
+        EXPECT_EQ(FabricTable::VerifyCredentials(cache, nocSpan, icacSpan, rcacSpan, context, compressedFabricId, fabricId,
+                                                 nodeId, nocPubKey, &rootPubKey),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(cache->Count(), 1u);
+        EXPECT_EQ(policy.mCallCount, 3u);
+
+        EXPECT_EQ(compressedFabricId, expectedCompressedFabricId);
+        EXPECT_EQ(fabricId, expectedFabricId);
+        EXPECT_EQ(nodeId, expectedNodeId);
+        EXPECT_TRUE(nocPubKey.Matches(expectedNocPubKey));
+        EXPECT_TRUE(rootPubKey.Matches(expectedRootPubKey));
+    }
+
+    // A remembered chain is still rejected once it has expired.
+    {
+        ValidationContext expiredContext = context;
+        expiredContext.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(nocData.mNotAfterTime + 1));
+
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubKey;
+        EXPECT_EQ(FabricTable::VerifyCredentials(cache, nocSpan, icacSpan, rcacSpan, expiredContext, compressedFabricId, fabricId,
+                                                 nodeId, nocPubKey),
+                  CHIP_ERROR_CERT_EXPIRED);
+        EXPECT_EQ(cache->Count(), 1u);
+    }
+
+    // The chain is verified again against other requirements.
+    {
+        ValidationContext clientContext = context;
+        clientContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kClientAuth);
+
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubKey;
+        EXPECT_EQ(FabricTable::VerifyCredentials(cache, nocSpan, icacSpan, rcacSpan, clientContext, compressedFabricId, fabricId,
+                                                 nodeId, nocPubKey),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(cache->Count(), 2u);
+    }
+
+    // A chain that does not verify is not remembered.
+    {
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubKey;
+        EXPECT_NE(FabricTable::VerifyCredentials(cache, ByteSpan(TestCerts::sTestCert_Node02_01_Chip), icacSpan, rcacSpan, context,
+                                                 compressedFabricId, fabricId, nodeId, nocPubKey),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(cache->Count(), 2u);
+    }
+
+    // Removing a fabric forgets all chains.
+    EXPECT_EQ(fabricTable.Delete(fabricTable.cbegin()->GetFabricIndex()), CHIP_NO_ERROR);
+    EXPECT_EQ(cache->Count(), 0u);
+}
+
+TEST_F(TestFabricTable, TestVerifiedCertChainCacheEviction)
+{
+    std::unique_ptr<VerifiedCertChainCache> cache = std::make_unique<VerifiedCertChainCache>();
+
+    auto makeKey = [](size_t index) {
+        VerifiedCertChainCache::Key key;
+        memset(key.mHash, 0, sizeof(key.mHash));
+        key.mHash[0] = static_cast<uint8_t>(index);
+        key.mHash[1] = static_cast<uint8_t>(index >> 8);
+        return key;
+    };
+    auto makeChain = [](size_t index) {
+        VerifiedCertChainCache::VerifiedChain chain;
+        chain.mCompressedFabricId = index;
+        chain.mFabricId           = index;
+        chain.mNodeId             = index;
+        return chain;
+    };
+
+    for (size_t i = 0; i < VerifiedCertChainCache::kCapacity; i++)
+    {
+        cache->Add(makeKey(i), makeChain(i));
+    }
+    EXPECT_EQ(cache->Count(), VerifiedCertChainCache::kCapacity);
+
+    // Using the oldest chain makes the second oldest one the least recently used, and the one forgotten.
+    VerifiedCertChainCache::VerifiedChain chain;
+    EXPECT_TRUE(cache->Find(makeKey(0), chain));
+    EXPECT_EQ(chain.mNodeId, 0u);
+
+    cache->Add(makeKey(VerifiedCertChainCache::kCapacity), makeChain(VerifiedCertChainCache::kCapacity));
+    EXPECT_EQ(cache->Count(), VerifiedCertChainCache::kCapacity);
+    EXPECT_TRUE(cache->Find(makeKey(0), chain));
+    EXPECT_TRUE(cache->Find(makeKey(VerifiedCertChainCache::kCapacity), chain));
+    EXPECT_EQ(chain.mNodeId, static_cast<NodeId>(VerifiedCertChainCache::kCapacity));
+    if (VerifiedCertChainCache::kCapacity > 1)
+    {
+        EXPECT_FALSE(cache->Find(makeKey(1), chain));
+    }
+
+    // Adding a chain that is already there replaces it.
+    cache->Add(makeKey(0), makeChain(1000));
+    EXPECT_EQ(cache->Count(), VerifiedCertChainCache::kCapacity);
+    EXPECT_TRUE(cache->Find(makeKey(0), chain));
+    EXPECT_EQ(chain.mNodeId, 1000u);
+
+    cache->Clear();
+    EXPECT_EQ(cache->Count(), 0u);
+    EXPECT_FALSE(cache->Find(makeKey(0), chain));
+}
+
+TEST_F(TestFabricTable, BenchmarkVerifiedCertChainCache)
+{
+    constexpr unsigned kIterations = 200;
+
+    ByteSpan rcacSpan(TestCerts::sTestCert_Root01_Chip);
+    ByteSpan icacSpan(TestCerts::sTestCert_ICA01_Chip);
+    ByteSpan nocSpan(TestCerts::sTestCert_Node01_01_Chip);
+
+    ChipCertificateData nocData;
+    EXPECT_EQ(DecodeChipCert(nocSpan, nocData), CHIP_NO_ERROR);
+
+    ValidationContext context;
+    context.Reset();
+    context.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    context.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    context.SetEffectiveTime<CurrentChipEpochTime>(System::Clock::Seconds32(nocData.mNotBeforeTime + 1));
+
+    std::unique_ptr<VerifiedCertChainCache> cache = std::make_unique<VerifiedCertChainCache>();
+
+    CompressedFabricId compressedFabricId;
+    FabricId fabricId;
+    NodeId nodeId;
+    Crypto::P256PublicKey nocPubKey;
+
+    auto timeVerification = [&](VerifiedCertChainCache * cacheToUse) {
+        uint64_t startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (unsigned i = 0; i < kIterations; i++)
+        {
+            EXPECT_EQ(FabricTable::VerifyCredentials(cacheToUse, nocSpan, icacSpan, rcacSpan, context, compressedFabricId, fabricId,
+                                                     nodeId, nocPubKey),
+                      CHIP_NO_ERROR);
+        }
+        return (System::SystemClock().GetMonotonicMicroseconds64().count() - startUs) / kIterations;
+    };
+
+    uint64_t uncachedUs = timeVerification(nullptr);
+    uint64_t cachedUs   = timeVerification(cache.get());
+
+    ChipLogProgress(Test, "Certificate chain verification: %u us uncached, %u us cached", static_cast<unsigned>(uncachedUs),
+                    static_cast<unsigned>(cachedUs));
+}
+
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
 TEST_F(TestFabricTable, VidVerificationSigningWorksWithoutVvs)
 {
     chip::TestPersistentStorageDelegate storage;
@@ -32,6 +32,7 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <platform/KeyValueStoreManager.h>
+#include <system/SystemClock.h>
 
 using namespace chip::Credentials;
 using GroupInfo      = GroupDataProvider::GroupInfo;
@@ -1293,6 +1294,151 @@ TEST_F(TestGroupDataProvider, TestGroupDecryption)
     it->Release();
 }
 
+using GroupSessionSet = std::set<std::pair<FabricIndex, GroupId>>;
+
+// Returns the (fabric, group) pairs of the group sessions matching `session_id`.
+GroupSessionSet FindGroupSessions(GroupDataProvider * provider, uint16_t session_id)
+{
+    GroupSessionSet found;
+    GroupSession session;
+
+    auto it = provider->IterateGroupSessions(session_id);
+    VerifyOrReturnValue(it != nullptr, found);
+    size_t count = it->Count();
+    while (it->Next(session))
+    {
+        found.emplace(session.fabric_index, session.group_id);
+    }
+    it->Release();
+
+    EXPECT_EQ(count, found.size());
+    return found;
+}
+
+TEST_F(TestGroupDataProvider, TestGroupSessionIndex)
+{
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 0, kGroup1Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric1, 1, kGroup2Keyset1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKeyAt(kFabric2, 0, kGroup3Keyset2), CHIP_NO_ERROR);
+
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric1, kGroup1);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    key_context = provider->GetKeyContext(kFabric2, kGroup3);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t other_session_id = key_context->GetKeyHash();
+    key_context->Release();
+
+    EXPECT_EQ(FindGroupSessions(provider, session_id), GroupSessionSet({ { kFabric1, kGroup1 }, { kFabric1, kGroup2 } }));
+    EXPECT_EQ(FindGroupSessions(provider, other_session_id), GroupSessionSet({ { kFabric2, kGroup3 } }));
+
+#if CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE > 0
+    // Once indexed, group sessions are found without reading the storage
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::GroupFabricList().KeyName());
+    sDelegate.AddPoisonKey(DefaultStorageKeyAllocator::FabricKeyset(kFabric1, kKeysetId1).KeyName());
+    EXPECT_EQ(FindGroupSessions(provider, session_id), GroupSessionSet({ { kFabric1, kGroup1 }, { kFabric1, kGroup2 } }));
+    sDelegate.ClearPoisonKeys();
+#endif
+
+    // Changes to the key map and the keysets are seen by the next lookup
+    EXPECT_EQ(provider->RemoveGroupKeyAt(kFabric1, 1), CHIP_NO_ERROR);
+    EXPECT_EQ(FindGroupSessions(provider, session_id), GroupSessionSet({ { kFabric1, kGroup1 } }));
+
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup1, kKeysetId3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet3), CHIP_NO_ERROR);
+    EXPECT_TRUE(FindGroupSessions(provider, session_id).empty());
+
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup1, kKeysetId1), CHIP_NO_ERROR);
+    EXPECT_EQ(FindGroupSessions(provider, session_id), GroupSessionSet({ { kFabric1, kGroup1 } }));
+
+    EXPECT_EQ(provider->RemoveFabric(kFabric1), CHIP_NO_ERROR);
+    EXPECT_TRUE(FindGroupSessions(provider, session_id).empty());
+    EXPECT_EQ(FindGroupSessions(provider, other_session_id), GroupSessionSet({ { kFabric2, kGroup3 } }));
+}
+
+TEST_F(TestGroupDataProvider, TestGroupDecryptionBenchmark)
+{
+    constexpr uint32_t kIterations = 5000;
+
+    GroupDataProvider * provider = GetGroupDataProvider();
+    EXPECT_TRUE(provider);
+
+    // Reset test
+    ResetProvider(provider);
+
+    // Two fabrics with all their groups mapped to keysets, as in a lighting installation
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric1, kCompressedFabricId1, kKeySet2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetKeySet(kFabric2, kCompressedFabricId2, kKeySet3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup1, kKeysetId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup2, kKeysetId2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup3, kKeysetId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup4, kKeysetId2), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric1, kGroup5, kKeysetId0), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric2, kGroup1, kKeysetId1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric2, kGroup2, kKeysetId3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric2, kGroup3, kKeysetId3), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric2, kGroup4, kKeysetId1), CHIP_NO_ERROR);
+    EXPECT_EQ(provider->SetGroupKey(kFabric2, kGroup5, kKeysetId3), CHIP_NO_ERROR);
+
+    const uint8_t kMessage[] = { 0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf };
+    const uint8_t kNonce[13] = { 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x18, 0x1a, 0x1b, 0x1c };
+    const uint8_t kAad[8]    = { 0x0a, 0x1a, 0x2a, 0x3a, 0x4a, 0x5a, 0x6a, 0x7a };
+    uint8_t mic[16]          = { 0 };
+    uint8_t ciphertext_buffer[sizeof(kMessage)];
+    uint8_t plaintext_buffer[sizeof(kMessage)];
+    MutableByteSpan ciphertext(ciphertext_buffer);
+    MutableByteSpan tag(mic);
+
+    // A scene command to one of the groups, as a device of fabric 2 receives it
+    Crypto::SymmetricKeyContext * key_context = provider->GetKeyContext(kFabric2, kGroup2);
+    ASSERT_NE(nullptr, key_context);
+    uint16_t session_id = key_context->GetKeyHash();
+    EXPECT_EQ(key_context->MessageEncrypt(ByteSpan(kMessage), ByteSpan(kAad), ByteSpan(kNonce), tag, ciphertext), CHIP_NO_ERROR);
+    key_context->Release();
+
+    // Decrypt it the way SessionManager does: try every group session matching the session id
+    uint32_t decrypted  = 0;
+    uint32_t candidates = 0;
+    uint64_t startUs    = System::SystemClock().GetMonotonicMicroseconds64().count();
+    for (uint32_t i = 0; i < kIterations; i++)
+    {
+        GroupSession session;
+        auto it = provider->IterateGroupSessions(session_id);
+        ASSERT_NE(nullptr, it);
+        while (it->Next(session))
+        {
+            candidates++;
+            MutableByteSpan plaintext(plaintext_buffer);
+            if (session.keyContext->MessageDecrypt(ciphertext, ByteSpan(kAad), ByteSpan(kNonce), tag, plaintext) == CHIP_NO_ERROR)
+            {
+                decrypted++;
+                break;
+            }
+        }
+        it->Release();
+    }
+    uint64_t elapsedUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+
+    EXPECT_EQ(decrypted, kIterations);
+    EXPECT_EQ(memcmp(plaintext_buffer, kMessage, sizeof(kMessage)), 0);
+
+    ChipLogProgress(Test, "Group decryption benchmark: %u messages/s, %u ns/message (%u candidates per message)",
+                    static_cast<unsigned>(kIterations * 1000000ull / (elapsedUs > 0 ? elapsedUs : 1)),
+                    static_cast<unsigned>(elapsedUs * 1000 / kIterations), static_cast<unsigned>(candidates / kIterations));
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
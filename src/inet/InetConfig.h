@@ -272,6 +272,40 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+ *
+ *  @brief
+ *    The maximum number of datagrams that the socket-based implementation
+ *    of UDP endpoints receives with one recvmmsg() call, and sends with one
+ *    sendmmsg() call.
+ *
+ *  @details
+ *    When this is greater than 1, the platform must provide recvmmsg() and
+ *    sendmmsg(). Each listening endpoint then holds this many receive
+ *    buffers of PacketBuffer::kMaxSizeWithoutReserve bytes, and messages
+ *    sent with UDPEndPoint::QueueMsg() are held until the end of the current
+ *    event loop iteration and sent together.
+ */
+#ifndef INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+#define INET_CONFIG_UDP_SOCKET_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE
+
+/**
+ *  @def INET_CONFIG_TCP_SOCKET_SEND_VECTORS
+ *
+ *  @brief
+ *    The maximum number of queued buffers that the socket-based
+ *    implementation of TCP endpoints sends with one sendmsg() call.
+ *
+ *  @details
+ *    Messages queued while the socket cannot take more data are then sent
+ *    together once it can, instead of with one system call each.
+ */
+#ifndef INET_CONFIG_TCP_SOCKET_SEND_VECTORS
+#define INET_CONFIG_TCP_SOCKET_SEND_VECTORS 1
+#endif // INET_CONFIG_TCP_SOCKET_SEND_VECTORS
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
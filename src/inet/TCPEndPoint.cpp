@@ -163,7 +163,8 @@ void TCPEndPoint::Shutdown()
 void TCPEndPoint::Close()
 {
     // Clear the receive queue.
-    mRcvQueue = nullptr;
+    mRcvQueue               = nullptr;
+    mRcvQueueCompleteLength = 0;
 
     // Suppress closing callbacks, since the application explicitly called Close().
     OnConnectionClosed = nullptr;
@@ -326,6 +327,17 @@ CHIP_ERROR TCPEndPoint::DriveSending()
 
 void TCPEndPoint::DriveReceiving(const TCPEndPointHandle & handle)
 {
+    // Hold back a receive queue set up by ReceiveInto() until the message in it is complete, as long as more
+    // data can arrive.
+    if (!mRcvQueue.IsNull() && mRcvQueueCompleteLength > 0)
+    {
+        if ((mState == State::kConnected || mState == State::kSendShutdown) && mRcvQueue->DataLength() < mRcvQueueCompleteLength)
+        {
+            return;
+        }
+        mRcvQueueCompleteLength = 0;
+    }
+
     // If there's data in the receive queue and the app is ready to receive it then call the app's callback
     // with the entire receive queue.
     if (!mRcvQueue.IsNull() && mReceiveEnabled && OnDataReceived != nullptr)
@@ -420,8 +432,9 @@ void TCPEndPoint::DoClose(CHIP_ERROR err, bool suppressCallback)
     if (mState == State::kClosed)
     {
         // Clear clear the send and receive queues.
-        mSendQueue = nullptr;
-        mRcvQueue  = nullptr;
+        mSendQueue              = nullptr;
+        mRcvQueue               = nullptr;
+        mRcvQueueCompleteLength = 0;
 
         // Call the appropriate app callback if allowed.
         if (!suppressCallback)
@@ -275,6 +275,29 @@ public:
      */
     virtual CHIP_ERROR AckReceive(size_t len) = 0;
 
+    /**
+     * @brief   Receive the rest of a message directly after the part of it already received.
+     *
+     * @param[in]   data    Received data, the beginning of a message of \c length bytes.
+     * @param[in]   length  Length of the whole message.
+     *
+     * @retval  CHIP_NO_ERROR                   success: \c data is taken over by the endpoint.
+     * @retval  CHIP_ERROR_NOT_IMPLEMENTED      the endpoint cannot receive into a buffer of the application.
+     * @retval  CHIP_ERROR_INCORRECT_STATE      no more data can be received, or the receive queue is not empty.
+     * @retval  CHIP_ERROR_INVALID_ARGUMENT     \c data is already complete, or \c length is too large.
+     * @retval  CHIP_ERROR_NO_MEMORY            no buffer of \c length bytes is available.
+     *
+     * @details
+     *  This method may only be called by data reception event handlers, to hand back the start
+     *  of a message that is longer than what was received so far. The endpoint then receives
+     *  into a single buffer of \c length bytes, and delivers it to OnDataReceived only once it
+     *  is complete (or once the peer closes the connection). Large messages are then neither
+     *  split across many buffers nor copied again to be reassembled.
+     *
+     *  On failure, \c data is left to the caller.
+     */
+    virtual CHIP_ERROR ReceiveInto(System::PacketBufferHandle && data, size_t length) { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
     /**
      * @brief   Set the receive queue, for testing.
      *
@@ -567,6 +590,9 @@ protected:
 
     chip::System::PacketBufferHandle mRcvQueue;
     chip::System::PacketBufferHandle mSendQueue;
+
+    /** Length at which the receive queue, set up by ReceiveInto(), is delivered; zero if not set up. */
+    size_t mRcvQueueCompleteLength = 0;
 #if INET_TCP_IDLE_CHECK_INTERVAL > 0
     static void HandleIdleTimer(System::Layer * aSystemLayer, void * aAppState);
     static bool IsIdleTimerRunning(EndPointManager<TCPEndPoint> & endPointManager);
@@ -30,6 +30,7 @@
 #include <lib/support/logging/CHIPLogging.h>
 #include <system/SystemFaultInjection.h>
 
+#include <algorithm>
 #include <stdio.h>
 #include <string.h>
 #include <utility>
@@ -449,6 +450,27 @@ CHIP_ERROR TCPEndPointImplSockets::AckReceive(size_t len)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TCPEndPointImplSockets::ReceiveInto(System::PacketBufferHandle && data, size_t length)
+{
+    VerifyOrReturnError(mState == State::kConnected || mState == State::kSendShutdown, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mRcvQueue.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!data.IsNull() && data->TotalLength() < length, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(length <= kMaxReceiveMessageSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(length, 0);
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    // ReceiveData() receives the rest of the message after this, in the same buffer.
+    size_t dataLength = data->TotalLength();
+    ReturnErrorOnFailure(data->Read(buffer->Start(), dataLength));
+    buffer->SetDataLength(dataLength);
+    data = nullptr;
+
+    mRcvQueue               = std::move(buffer);
+    mRcvQueueCompleteLength = length;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TCPEndPointImplSockets::SetUserTimeoutImpl(uint32_t userTimeoutMillis)
 {
 #if defined(TCP_USER_TIMEOUT)
@@ -484,9 +506,25 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
     TCPEndPointHandle handle(this);
     while (!mSendQueue.IsNull())
     {
-        size_t bufLen = mSendQueue->DataLength();
+        // Gather the first buffers of the send queue into one call, rather than one call per buffer.
+        struct iovec vectors[INET_CONFIG_TCP_SOCKET_SEND_VECTORS];
+        size_t vectorCount = 0;
+        size_t bufLen      = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && vectorCount < MATTER_ARRAY_SIZE(vectors);
+             buf.Advance())
+        {
+            vectors[vectorCount].iov_base = buf->Start();
+            vectors[vectorCount].iov_len  = buf->DataLength();
+            bufLen += buf->DataLength();
+            vectorCount++;
+        }
+
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = vectors;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(vectorCount);
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -508,21 +546,24 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were sent entirely, and consume what was sent of the next one.
+        size_t lenLeft = lenSent;
+        for (size_t i = 0; i < vectorCount && lenLeft >= mSendQueue->DataLength(); i++)
         {
-            mSendQueue->ConsumeHead(lenSent);
+            lenLeft -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
         }
-        else
+        if (lenLeft > 0)
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            mSendQueue->ConsumeHead(lenLeft);
+        }
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
@@ -879,8 +920,15 @@ void TCPEndPointImplSockets::ReceiveData()
         return;
     }
 
+    // Do not receive past the end of a message awaited by ReceiveInto().
+    size_t rcvSpace = rcvBuf->AvailableDataLength();
+    if (!isNewBuf && mRcvQueueCompleteLength > 0)
+    {
+        rcvSpace = std::min(rcvSpace, mRcvQueueCompleteLength - rcvBuf->DataLength());
+    }
+
     // Attempt to receive data from the socket.
-    ssize_t rcvLen = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvBuf->AvailableDataLength(), 0);
+    ssize_t rcvLen = recv(mSocket, rcvBuf->Start() + rcvBuf->DataLength(), rcvSpace, 0);
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
     CHIP_ERROR err;
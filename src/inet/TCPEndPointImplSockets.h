@@ -47,6 +47,7 @@ public:
     CHIP_ERROR EnableKeepAlive(uint16_t interval, uint16_t timeoutCount) override;
     CHIP_ERROR DisableKeepAlive() override;
     CHIP_ERROR AckReceive(size_t len) override;
+    CHIP_ERROR ReceiveInto(System::PacketBufferHandle && data, size_t length) override;
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
     void TCPUserTimeoutHandler() override;
 #endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
@@ -121,6 +121,23 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::QueueMsg(const IPPacketInfo * pktInfo, System::PacketBufferHandle && msg)
+{
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, return INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, return CHIP_ERROR_NO_MEMORY;);
+
+    ReturnErrorOnFailure(QueueMsgImpl(pktInfo, std::move(msg)));
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPoint::FlushQueuedMsgs()
+{
+    return FlushQueuedMsgsImpl();
+}
+
 void UDPEndPoint::Free()
 {
     Close();
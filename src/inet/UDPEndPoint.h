@@ -37,6 +37,8 @@
 #include <inet/InetLayer.h>
 #include <system/SystemPacketBuffer.h>
 
+#include <utility>
+
 struct otInstance;
 
 namespace chip {
@@ -230,6 +232,30 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Queue a UDP message for sending to a specified destination.
+     *
+     *  Like \c SendMsg, but the implementation may hold the message back and send it together with other queued messages,
+     *  no later than the end of the current event loop iteration, or when \c FlushQueuedMsgs or \c Close is called. Errors
+     *  detected only when the message is eventually sent are logged rather than returned. Implementations that do not
+     *  support batched sends send the message immediately.
+     *
+     * @param[in]   pktInfo     Source and destination information for the UDP message.
+     * @param[in]   msg         Packet buffer containing the UDP message.
+     *
+     * @retval  CHIP_NO_ERROR   Success: \c msg is queued for transmit.
+     * @retval  other           See \c SendMsg.
+     */
+    CHIP_ERROR QueueMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
+
+    /**
+     * Send all the messages queued by \c QueueMsg now.
+     *
+     * @retval  CHIP_NO_ERROR   Success: all queued messages were handed to the system.
+     * @retval  other           The error of one of the messages that could not be sent. The other messages are still sent.
+     */
+    CHIP_ERROR FlushQueuedMsgs();
+
     /**
      * Close the endpoint.
      *
@@ -296,6 +322,12 @@ protected:
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
 
+    virtual CHIP_ERROR QueueMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)
+    {
+        return SendMsgImpl(pktInfo, std::move(msg));
+    }
+    virtual CHIP_ERROR FlushQueuedMsgsImpl() { return CHIP_NO_ERROR; }
+
     /**
      * Close the endpoint and recycle its memory.
      *
@@ -277,7 +277,17 @@ CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
     return layer->RequestCallbackOnPendingRead(mWatch);
 }
 
-CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+struct UDPEndPointImplSockets::OutgoingMsgHeader
+{
+    struct msghdr mMsgHeader;
+    struct iovec mMsgIOV;
+    SockAddr mPeerSockAddr;
+#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+    uint8_t mControlData[256];
+#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
+};
+
+CHIP_ERROR UDPEndPointImplSockets::CheckSendable(const IPPacketInfo * aPktInfo, const System::PacketBufferHandle & msg)
 {
     // Ensure packet buffer is not null
     VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
@@ -292,22 +302,28 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // For now the entire message must fit within a single buffer.
     VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
 
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::PrepareMsgHeader(const IPPacketInfo * aPktInfo, const System::PacketBufferHandle & msg,
+                                                    OutgoingMsgHeader & aHeader)
+{
+    struct iovec & msgIOV = aHeader.mMsgIOV;
+    msgIOV.iov_base       = msg->Start();
+    msgIOV.iov_len        = msg->DataLength();
 
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
+    uint8_t * controlData = aHeader.mControlData;
+    memset(controlData, 0, sizeof(aHeader.mControlData));
 #endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
 
-    struct msghdr msgHeader;
+    struct msghdr & msgHeader = aHeader.mMsgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
     msgHeader.msg_iov    = &msgIOV;
     msgHeader.msg_iovlen = 1;
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
+    SockAddr & peerSockAddr = aHeader.mPeerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
     if (mAddrType == IPAddressType::kIPv6)
@@ -351,7 +367,7 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
         msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_controllen = sizeof(aHeader.mControlData);
 
         struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
         InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
@@ -409,9 +425,19 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     }
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    ReturnErrorOnFailure(CheckSendable(aPktInfo, msg));
+
+    OutgoingMsgHeader header;
+    ReturnErrorOnFailure(PrepareMsgHeader(aPktInfo, msg, header));
+
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const ssize_t lenSent = sendmsg(mSocket, &header.mMsgHeader, 0);
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
@@ -426,8 +452,126 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     return CHIP_NO_ERROR;
 }
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+CHIP_ERROR UDPEndPointImplSockets::QueueMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    // Check what can be checked now, so that the caller still gets those errors.
+    ReturnErrorOnFailure(CheckSendable(aPktInfo, msg));
+
+    if (mSendQueueLength == MATTER_ARRAY_SIZE(mSendQueue))
+    {
+        CHIP_ERROR err = FlushQueuedMsgsImpl();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send queued UDP messages: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
+    if (!mSendQueueFlushPending)
+    {
+        ReturnErrorOnFailure(GetSystemLayer().ScheduleWork(HandleQueuedMsgsFlush, this));
+        mSendQueueFlushPending = true;
+    }
+
+    mSendQueue[mSendQueueLength].mPktInfo = *aPktInfo;
+    mSendQueue[mSendQueueLength].mMsg     = std::move(msg);
+    mSendQueueLength++;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::FlushQueuedMsgsImpl()
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    OutgoingMsgHeader headers[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    struct mmsghdr msgs[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    size_t msgLengths[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    size_t count = 0;
+
+    for (size_t i = 0; i < mSendQueueLength; i++)
+    {
+        CHIP_ERROR prepareErr = PrepareMsgHeader(&mSendQueue[i].mPktInfo, mSendQueue[i].mMsg, headers[count]);
+        if (prepareErr != CHIP_NO_ERROR)
+        {
+            err = prepareErr;
+            continue;
+        }
+
+        memset(&msgs[count], 0, sizeof(msgs[count]));
+        msgs[count].msg_hdr = headers[count].mMsgHeader;
+        msgLengths[count]   = mSendQueue[i].mMsg->DataLength();
+        count++;
+    }
+
+    size_t sent = 0;
+    while (sent < count)
+    {
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): QueueMsgImpl ensures mSocket is valid
+        const int numSent = sendmmsg(mSocket, &msgs[sent], static_cast<unsigned int>(count - sent), 0);
+        if (numSent <= 0)
+        {
+            // The first message could not be sent: drop it, and carry on with the others.
+            err = CHIP_ERROR_POSIX(errno);
+            sent++;
+            continue;
+        }
+
+        for (size_t i = sent; i < sent + static_cast<size_t>(numSent); i++)
+        {
+            if (msgs[i].msg_len != msgLengths[i])
+            {
+                err = CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+            }
+        }
+        sent += static_cast<size_t>(numSent);
+    }
+
+    for (size_t i = 0; i < mSendQueueLength; i++)
+    {
+        mSendQueue[i].mMsg = nullptr;
+    }
+    mSendQueueLength = 0;
+
+    return err;
+}
+
+// static
+void UDPEndPointImplSockets::HandleQueuedMsgsFlush(System::Layer * aLayer, void * aAppState)
+{
+    auto * endPoint = static_cast<UDPEndPointImplSockets *>(aAppState);
+    VerifyOrReturn(endPoint != nullptr);
+
+    endPoint->mSendQueueFlushPending = false;
+
+    CHIP_ERROR err = endPoint->FlushQueuedMsgsImpl();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to send queued UDP messages: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
 void UDPEndPointImplSockets::CloseImpl()
 {
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    // Messages queued before Close() are still sent.
+    if (mSendQueueFlushPending)
+    {
+        GetSystemLayer().CancelTimer(HandleQueuedMsgsFlush, this);
+        mSendQueueFlushPending = false;
+    }
+    CHIP_ERROR err = FlushQueuedMsgsImpl();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to send queued UDP messages: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+
+    for (auto & buffer : mReceiveBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
     if (mSocket != kInvalidSocketFd)
     {
         TEMPORARY_RETURN_IGNORED static_cast<System::LayerSockets *>(&GetSystemLayer())->StopWatchingSocket(&mWatch);
@@ -567,6 +711,62 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events, intptr
     endPoint->HandlePendingIO(events);
 }
 
+CHIP_ERROR UDPEndPointImplSockets::DecodeReceivedMsg(struct msghdr & msgHeader, size_t rcvLen, System::PacketBufferHandle & buffer,
+                                                     IPPacketInfo & pktInfo)
+{
+    VerifyOrReturnError(buffer->AvailableDataLength() >= rcvLen, CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG);
+
+    buffer->SetDataLength(static_cast<uint16_t>(rcvLen));
+
+    const SockAddr & peerSockAddr = *static_cast<const SockAddr *>(msgHeader.msg_name);
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            pktInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            VerifyOrReturnError(CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex), CHIP_ERROR_INCORRECT_STATE);
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            pktInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 {
     if (mState != State::kListening || OnMessageReceived == nullptr || !events.Has(System::SocketEventFlags::kRead))
@@ -576,6 +776,10 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
 
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    ReceiveBatch();
+#else
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
     IPPacketInfo lPacketInfo;
     System::PacketBufferHandle lBuffer;
@@ -613,69 +817,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         {
             lStatus = CHIP_ERROR_POSIX(errno);
         }
-        else if (lBuffer->AvailableDataLength() < static_cast<size_t>(rcvLen))
-        {
-            lStatus = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
-        }
         else
         {
-            lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = DecodeReceivedMsg(msgHeader, static_cast<size_t>(rcvLen), lBuffer, lPacketInfo);
         }
     }
     else
@@ -695,7 +839,93 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
             OnReceiveError(this, lStatus, nullptr);
         }
     }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+void UDPEndPointImplSockets::ReceiveBatch()
+{
+    constexpr size_t kBatchSize = INET_CONFIG_UDP_SOCKET_BATCH_SIZE;
+
+    struct mmsghdr msgs[kBatchSize];
+    struct iovec msgIOVs[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][256];
+
+    size_t count = 0;
+    for (; count < kBatchSize; count++)
+    {
+        System::PacketBufferHandle & buffer = mReceiveBuffers[count];
+        if (buffer.IsNull())
+        {
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
+            {
+                // Make do with the buffers we have.
+                break;
+            }
+        }
+
+        msgIOVs[count].iov_base = buffer->Start();
+        msgIOVs[count].iov_len  = buffer->AvailableDataLength();
+
+        memset(&peerSockAddrs[count], 0, sizeof(peerSockAddrs[count]));
+        memset(controlData[count], 0, sizeof(controlData[count]));
+        memset(&msgs[count], 0, sizeof(msgs[count]));
+
+        struct msghdr & msgHeader = msgs[count].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[count];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[count]);
+        msgHeader.msg_iov         = &msgIOVs[count];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[count];
+        msgHeader.msg_controllen  = sizeof(controlData[count]);
+    }
+
+    if (count == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int rcvCount = recvmmsg(mSocket, msgs, static_cast<unsigned int>(count), MSG_DONTWAIT, nullptr);
+    if (rcvCount == -1)
+    {
+        CHIP_ERROR status = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < static_cast<size_t>(rcvCount); i++)
+    {
+        // The callbacks may close the endpoint, which drops the remaining messages.
+        VerifyOrReturn(mState == State::kListening && OnMessageReceived != nullptr);
+
+        IPPacketInfo packetInfo;
+        packetInfo.Clear();
+        packetInfo.DestPort  = mBoundPort;
+        packetInfo.Interface = mBoundIntfId;
+
+        System::PacketBufferHandle buffer = std::move(mReceiveBuffers[i]);
+        CHIP_ERROR status                 = DecodeReceivedMsg(msgs[i].msg_hdr, msgs[i].msg_len, buffer, packetInfo);
+        if (status == CHIP_NO_ERROR)
+        {
+            buffer.RightSize();
+            OnMessageReceived(this, std::move(buffer), &packetInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+    }
 }
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
 
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
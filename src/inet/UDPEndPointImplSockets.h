@@ -26,6 +26,10 @@
 #include <inet/EndPointStateSockets.h>
 #include <inet/UDPEndPoint.h>
 
+#include <cstddef>
+
+struct msghdr;
+
 namespace chip {
 namespace Inet {
 
@@ -51,15 +55,43 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addressType, InterfaceId interfaceId) override;
     CHIP_ERROR ListenImpl() override;
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    CHIP_ERROR QueueMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+    CHIP_ERROR FlushQueuedMsgsImpl() override;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
     void CloseImpl() override;
 
+    // Storage for the header of an outgoing message, which must outlive the send call.
+    struct OutgoingMsgHeader;
+
     CHIP_ERROR GetSocket(IPAddressType addressType);
+    CHIP_ERROR CheckSendable(const IPPacketInfo * pktInfo, const System::PacketBufferHandle & msg);
+    CHIP_ERROR PrepareMsgHeader(const IPPacketInfo * pktInfo, const System::PacketBufferHandle & msg, OutgoingMsgHeader & header);
+    CHIP_ERROR DecodeReceivedMsg(struct msghdr & msgHeader, size_t rcvLen, System::PacketBufferHandle & buffer,
+                                 IPPacketInfo & pktInfo);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+    void ReceiveBatch();
+    static void HandleQueuedMsgsFlush(System::Layer * layer, void * appState);
+
+    struct QueuedMsg
+    {
+        IPPacketInfo mPktInfo;
+        System::PacketBufferHandle mMsg;
+    };
+
+    // Receive buffers are kept across reads, so that only the ones handed to OnMessageReceived need to be replaced.
+    System::PacketBufferHandle mReceiveBuffers[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    QueuedMsg mSendQueue[INET_CONFIG_UDP_SOCKET_BATCH_SIZE];
+    size_t mSendQueueLength     = 0;
+    bool mSendQueueFlushPending = false;
+#endif // INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
@@ -378,6 +378,88 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if INET_CONFIG_ENABLE_UDP_ENDPOINT
+struct UDPLoopbackCounters
+{
+    size_t mNumReceived = 0;
+    size_t mNumBytes    = 0;
+
+    static void OnMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+    {
+        auto * counters = static_cast<UDPLoopbackCounters *>(endPoint->mAppState);
+        counters->mNumReceived++;
+        counters->mNumBytes += msg->DataLength();
+    }
+};
+
+// Loopback UDP throughput, with SendMsg and with QueueMsg. With INET_CONFIG_UDP_SOCKET_BATCH_SIZE > 1, queued messages are
+// sent with sendmmsg() and both are received with recvmmsg().
+TEST_F(TestInetEndPoint, TestUDPLoopbackThroughput)
+{
+    constexpr size_t kNumBursts   = 100;
+    constexpr size_t kBurstSize   = 32;
+    constexpr size_t kMessageSize = 100;
+
+    UDPEndPointHandle receiver;
+    UDPEndPointHandle sender;
+    ASSERT_EQ(gUDP.NewEndPoint(receiver), CHIP_NO_ERROR);
+    ASSERT_EQ(gUDP.NewEndPoint(sender), CHIP_NO_ERROR);
+
+    IPAddress loopback;
+    ASSERT_TRUE(IPAddress::FromString("::1", loopback));
+    if (receiver->Bind(IPAddressType::kIPv6, loopback, 0) != CHIP_NO_ERROR)
+    {
+        GTEST_SKIP() << "Skipping test: IPv6 loopback is not available.";
+    }
+
+    UDPLoopbackCounters counters;
+    ASSERT_EQ(receiver->Listen(UDPLoopbackCounters::OnMessageReceived, nullptr, &counters), CHIP_NO_ERROR);
+
+    IPPacketInfo pktInfo;
+    pktInfo.Clear();
+    pktInfo.DestAddress = loopback;
+    pktInfo.DestPort    = receiver->GetBoundPort();
+
+    for (bool queued : { false, true })
+    {
+        counters = UDPLoopbackCounters();
+
+        const auto start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t burst = 0; burst < kNumBursts; burst++)
+        {
+            for (size_t i = 0; i < kBurstSize; i++)
+            {
+                PacketBufferHandle msg = PacketBufferHandle::New(kMessageSize);
+                ASSERT_FALSE(msg.IsNull());
+                memset(msg->Start(), static_cast<int>(i), kMessageSize);
+                msg->SetDataLength(kMessageSize);
+
+                EXPECT_EQ(queued ? sender->QueueMsg(&pktInfo, std::move(msg)) : sender->SendMsg(&pktInfo, std::move(msg)),
+                          CHIP_NO_ERROR);
+            }
+            EXPECT_EQ(sender->FlushQueuedMsgs(), CHIP_NO_ERROR);
+
+            // Drain each burst before sending the next one, so that the socket receive buffer does not overflow.
+            const size_t expected = (burst + 1) * kBurstSize;
+            for (int attempt = 0; attempt < 100 && counters.mNumReceived < expected; attempt++)
+            {
+                ServiceEvents(10);
+            }
+        }
+        const auto elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        EXPECT_EQ(counters.mNumReceived, kNumBursts * kBurstSize);
+        EXPECT_EQ(counters.mNumBytes, kNumBursts * kBurstSize * kMessageSize);
+        printf("    %s: %u datagrams of %u bytes in %" PRIu64 " us\n", queued ? "QueueMsg" : "SendMsg",
+               static_cast<unsigned>(counters.mNumReceived), static_cast<unsigned>(kMessageSize),
+               static_cast<uint64_t>(elapsed.count()));
+    }
+
+    receiver.Release();
+    sender.Release();
+}
+#endif // INET_CONFIG_ENABLE_UDP_ENDPOINT
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
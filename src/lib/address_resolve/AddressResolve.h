@@ -24,6 +24,9 @@
 #include <transport/raw/PeerAddress.h>
 
 namespace chip {
+
+class PersistentStorageDelegate;
+
 namespace AddressResolve {
 
 /// Contains resolve information received from nodes. Contains all information
@@ -247,6 +250,19 @@ public:
     /// a clear decision if the callback should or should not be invoked.
     virtual CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) = 0;
 
+    /// Inform the resolver that the address it provided for the given peer
+    /// did not work (e.g. establishing a session with it timed out), so
+    /// that it is not reused from a cache by subsequent lookups.
+    ///
+    /// Implementations that do not cache addresses may ignore this.
+    virtual void InvalidateCachedAddress(const PeerId & peerId) {}
+
+    /// Provide storage in which addresses may be cached across restarts.
+    ///
+    /// Expected to be called after Init. A null storage keeps any cache in
+    /// RAM only. Implementations that do not cache addresses may ignore this.
+    virtual void SetCacheStorage(PersistentStorageDelegate * storage) {}
+
     /// Shut down any active resolves
     ///
     /// Will immediately fail any scheduled resolve calls and will refuse to register
@@ -19,6 +19,7 @@
 
 #include <lib/address_resolve/TracingStructs.h>
 #include <tracing/macros.h>
+#include <tracing/metric_event.h>
 #include <transport/raw/PeerAddress.h>
 
 namespace chip {
@@ -28,6 +29,42 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+// Delay before persisting the address cache after a change.
+static constexpr System::Clock::Timeout kCacheSaveDelay = System::Clock::Seconds16(5);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+/// Returns a result for the given node data, with everything but the IP address filled in.
+ResolveResult ResultWithoutIpAddress(const Dnssd::ResolvedNodeData & nodeData)
+{
+    ResolveResult result;
+
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    return result;
+}
+
+bool IsUsableIpAddress(const Inet::IPAddress & address)
+{
+#if !INET_CONFIG_ENABLE_IPV4
+    if (!address.IsIPv6())
+    {
+        ChipLogError(Discovery, "Skipping IPv4 address during operational resolve.");
+        return false;
+    }
+#endif
+    return true;
+}
+
 } // namespace
 
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
@@ -35,6 +72,7 @@ void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLo
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mHasCachedResult  = false;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -62,10 +100,22 @@ void NodeLookupHandle::LookupResult(const ResolveResult & result)
 #endif
 }
 
+void NodeLookupHandle::CachedLookupResult(const ResolveResult & result)
+{
+    LookupResult(result);
+    mHasCachedResult = true;
+}
+
 System::Clock::Timeout NodeLookupHandle::NextEventTimeout(System::Clock::Timestamp now)
 {
     const System::Clock::Timestamp elapsed = now - mRequestStartTime;
 
+    if (mHasCachedResult && HasLookupResult())
+    {
+        // Cached results are returned right away.
+        return System::Clock::Timeout::zero();
+    }
+
     if (elapsed < mRequest.GetMinLookupTime())
     {
         return mRequest.GetMinLookupTime() - elapsed;
@@ -104,6 +154,13 @@ NodeLookupAction NodeLookupHandle::NextAction(System::Clock::Timestamp now)
     ChipLogProgress(Discovery, "Checking node lookup status for " ChipLogFormatPeerId " after %lu ms",
                     ChipLogValuePeerId(mRequest.GetPeerId()), static_cast<unsigned long>(elapsed.count()));
 
+    // A cached result does not need to wait for DNSSD, which only refreshes it.
+    if (mHasCachedResult && HasLookupResult())
+    {
+        ChipLogProgress(Discovery, "Using cached address");
+        return NodeLookupAction::Success(TakeLookupResult());
+    }
+
     // We are still within the minimal search time. Wait for more results.
     if (elapsed < mRequest.GetMinLookupTime())
     {
@@ -204,9 +261,25 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    handle.ResetForLookup(now, request);
     auto & peerId = request.GetPeerId();
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    // DNSSD is queried even for cached nodes, so that their cache entry gets refreshed.
+    ResolveResult cachedResult;
+    if (mAddressCache.Lookup(peerId, now, cachedResult))
+    {
+        MATTER_LOG_METRIC(Tracing::kMetricAddressResolveCacheHit);
+        handle.CachedLookupResult(cachedResult);
+    }
+    else
+    {
+        MATTER_LOG_METRIC(Tracing::kMetricAddressResolveCacheMiss);
+    }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
     ChipLogProgress(Discovery, "Lookup started for " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
@@ -289,6 +362,18 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    mAddressCache.FinishAllRefreshes(mTimeSource.GetMonotonicTimestamp(), [](const PeerId & peerId) {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    });
+    if (mCacheSavePending)
+    {
+        mSystemLayer->CancelTimer(&OnCacheSaveTimer, static_cast<void *>(this));
+        SaveCache();
+    }
+    mAddressCache.Shutdown();
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
@@ -305,28 +390,14 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
             continue;
         }
 
-        ResolveResult result;
-
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
-
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
-        {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
-        }
+        ResolveResult result = ResultWithoutIpAddress(nodeData);
 
         for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
         {
-#if !INET_CONFIG_ENABLE_IPV4
-            if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
+            if (!IsUsableIpAddress(nodeData.resolutionData.ipAddress[i]))
             {
-                ChipLogError(Discovery, "Skipping IPv4 address during operational resolve.");
                 continue;
             }
-#endif
             result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
             current->LookupResult(result);
         }
@@ -334,12 +405,19 @@ void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeDat
         HandleAction(current);
     }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    // Done after handling lookups, so that lookups answered from the cache
+    // above see their refresh completed as well.
+    UpdateCache(nodeData);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     ReArmTimer();
 }
 
 void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
 {
-    const NodeLookupAction action = current->NextAction(mTimeSource.GetMonotonicTimestamp());
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    const NodeLookupAction action      = current->NextAction(now);
 
     if (action.Type() == NodeLookupResult::kKeepSearching)
     {
@@ -348,11 +426,19 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     }
 
     // final result, handle either success or failure
-    const PeerId peerId     = current->GetRequest().GetPeerId();
-    NodeListener * listener = current->GetListener();
+    const PeerId peerId                                       = current->GetRequest().GetPeerId();
+    NodeListener * listener                                   = current->GetListener();
+    [[maybe_unused]] const bool hasCachedResult               = current->HasCachedResult();
+    [[maybe_unused]] const System::Clock::Timestamp startTime = current->GetRequestStartTime();
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    // Lookups answered from the cache leave DNSSD running to refresh the cache entry.
+    if (!(hasCachedResult && action.Type() == NodeLookupResult::kLookupSuccess && mAddressCache.StartRefresh(peerId, now)))
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    {
+        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    }
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -363,10 +449,13 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, action.ErrorResult());
         listener->OnNodeAddressResolutionFailed(peerId, action.ErrorResult());
         break;
-    case NodeLookupResult::kLookupSuccess:
+    case NodeLookupResult::kLookupSuccess: {
         MATTER_LOG_NODE_DISCOVERED(Tracing::DiscoveryInfoType::kResolutionDone, &peerId, &action.ResolveResult());
+        const auto timeToFirstAddress = std::chrono::duration_cast<System::Clock::Milliseconds32>(now - startTime);
+        MATTER_LOG_METRIC(Tracing::kMetricAddressResolveTimeToFirstAddress, static_cast<uint32_t>(timeToFirstAddress.count()));
         listener->OnNodeAddressResolved(peerId, action.ResolveResult());
         break;
+    }
     default:
         ChipLogError(Discovery, "Unexpected lookup state (not success or fail).");
         break;
@@ -409,9 +498,106 @@ void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERR
         // contain the active lookup data as a member (intrusive lists members)
         listener->OnNodeAddressResolutionFailed(peerId, error);
     }
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    FinishCacheRefresh(peerId);
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     ReArmTimer();
 }
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+void Resolver::InvalidateCachedAddress(const PeerId & peerId)
+{
+    if (mAddressCache.Invalidate(peerId))
+    {
+        ChipLogProgress(Discovery, "Dropped cached address of " ChipLogFormatPeerId, ChipLogValuePeerId(peerId));
+        ScheduleCacheSave();
+    }
+}
+
+void Resolver::SetCacheStorage(PersistentStorageDelegate * storage)
+{
+    LogErrorOnFailure(mAddressCache.Init(storage, mTimeSource.GetMonotonicTimestamp()));
+}
+
+void Resolver::UpdateCache(const Dnssd::ResolvedNodeData & nodeData)
+{
+    const PeerId & peerId = nodeData.operationalData.peerId;
+
+    if (nodeData.operationalData.hasZeroTTL)
+    {
+        // The node is withdrawing its records
+        InvalidateCachedAddress(peerId);
+    }
+    else
+    {
+        NodeLookupResults results;
+        ResolveResult result = ResultWithoutIpAddress(nodeData);
+
+        for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+        {
+            const Inet::IPAddress & ipAddress = nodeData.resolutionData.ipAddress[i];
+            if (!IsUsableIpAddress(ipAddress))
+            {
+                continue;
+            }
+            result.address.SetIPAddress(ipAddress);
+            results.UpdateResults(result, Dnssd::IPAddressSorter::ScoreIpAddress(ipAddress, result.address.GetInterface()));
+        }
+
+        const System::Clock::Seconds32 ttl =
+            nodeData.operationalData.ttl.value_or(System::Clock::Seconds32(CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SECONDS));
+        if (results.HasValidResult() &&
+            mAddressCache.Update(peerId, results.ConsumeResult(), ttl, mTimeSource.GetMonotonicTimestamp()))
+        {
+            ScheduleCacheSave();
+        }
+    }
+
+    FinishCacheRefresh(peerId);
+}
+
+void Resolver::FinishCacheRefresh(const PeerId & peerId)
+{
+    VerifyOrReturn(mAddressCache.FinishRefresh(peerId, mTimeSource.GetMonotonicTimestamp()));
+
+    // Active lookups for the same node still need DNSSD to keep going.
+    for (auto & activeLookup : mActiveLookups)
+    {
+        VerifyOrReturn(activeLookup.GetRequest().GetPeerId() != peerId);
+    }
+
+    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+}
+
+void Resolver::ScheduleCacheSave()
+{
+    VerifyOrReturn(!mCacheSavePending && mSystemLayer != nullptr);
+
+    CHIP_ERROR err = mSystemLayer->StartTimer(kCacheSaveDelay, &OnCacheSaveTimer, static_cast<void *>(this));
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to schedule address cache save: %" CHIP_ERROR_FORMAT, err.Format());
+        return;
+    }
+    mCacheSavePending = true;
+}
+
+void Resolver::SaveCache()
+{
+    mCacheSavePending = false;
+
+    CHIP_ERROR err = mAddressCache.Save(mTimeSource.GetMonotonicTimestamp());
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to save address cache: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
 void Resolver::ReArmTimer()
 {
     mSystemLayer->CancelTimer(&OnResolveTimer, static_cast<void *>(this));
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/NodeAddressCache.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
 #include <system/TimeSource.h>
@@ -136,6 +137,16 @@ public:
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
+    /// Mark that an address for the node was found in the address cache.
+    ///
+    /// Lookups with a cached address do not wait for the minimum lookup time.
+    void CachedLookupResult(const ResolveResult & result);
+
+    /// Was the lookup given an address from the address cache?
+    bool HasCachedResult() const { return mHasCachedResult; }
+
+    System::Clock::Timestamp GetRequestStartTime() const { return mRequestStartTime; }
+
     /// Called after timeouts or after a series of IP addresses have been
     /// marked as found.
     ///
@@ -161,6 +172,7 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mHasCachedResult = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -175,6 +187,12 @@ public:
     CHIP_ERROR TryNextResult(Impl::NodeLookupHandle & handle) override;
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
     void Shutdown() override;
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    void InvalidateCachedAddress(const PeerId & peerId) override;
+    void SetCacheStorage(PersistentStorageDelegate * storage) override;
+
+    const NodeAddressCache::Stats & GetCacheStats() const { return mAddressCache.GetStats(); }
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
 
     // Dnssd::OperationalResolveDelegate
 
@@ -200,6 +218,25 @@ private:
     /// be used after calling this method.
     void HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current);
 
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+    static void OnCacheSaveTimer(System::Layer * layer, void * context) { static_cast<Resolver *>(context)->SaveCache(); }
+
+    /// Remembers the best address of a resolved node and releases the query
+    /// of any background refresh for it.
+    void UpdateCache(const Dnssd::ResolvedNodeData & nodeData);
+
+    /// Releases the query of any background refresh for `peerId`.
+    void FinishCacheRefresh(const PeerId & peerId);
+
+    /// Persists the cache after a short delay, so that bursts of resolutions
+    /// result in a single write.
+    void ScheduleCacheSave();
+    void SaveCache();
+
+    NodeAddressCache mAddressCache;
+    bool mCacheSavePending = false;
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
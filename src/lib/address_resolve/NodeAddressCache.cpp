@@ -0,0 +1,370 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/NodeAddressCache.h>
+
+#include <lib/core/TLV.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+namespace chip {
+namespace AddressResolve {
+namespace {
+
+constexpr TLV::Tag kCompressedFabricIdTag = TLV::ContextTag(1);
+constexpr TLV::Tag kNodeIdTag             = TLV::ContextTag(2);
+constexpr TLV::Tag kIpAddressTag          = TLV::ContextTag(3);
+constexpr TLV::Tag kPortTag               = TLV::ContextTag(4);
+constexpr TLV::Tag kExpiryTag             = TLV::ContextTag(5); // Real time, in seconds since the Unix epoch
+constexpr TLV::Tag kMrpIdleIntervalTag    = TLV::ContextTag(6);
+constexpr TLV::Tag kMrpActiveIntervalTag  = TLV::ContextTag(7);
+constexpr TLV::Tag kMrpActiveThresholdTag = TLV::ContextTag(8);
+constexpr TLV::Tag kFlagsTag              = TLV::ContextTag(9);
+
+constexpr size_t kIpAddressSize = 16;
+
+enum class PersistedFlags : uint8_t
+{
+    kSupportsTcpServer   = 0x01,
+    kSupportsTcpClient   = 0x02,
+    kIsICDOperatingAsLIT = 0x04,
+};
+
+constexpr size_t kPersistedEntrySize =
+    TLV::EstimateStructOverhead(sizeof(uint64_t), sizeof(uint64_t), kIpAddressSize, sizeof(uint16_t), sizeof(uint64_t),
+                                sizeof(uint32_t), sizeof(uint32_t), sizeof(uint16_t), sizeof(uint8_t));
+
+// Persisted data must fit in a single storage value, whose size is a uint16_t.
+constexpr size_t kMaxPersistedEntries =
+    std::min(NodeAddressCache::kCapacity, (UINT16_MAX - TLV::EstimateStructOverhead()) / kPersistedEntrySize);
+constexpr size_t kPersistedCacheMaxSize = TLV::EstimateStructOverhead() + kMaxPersistedEntries * kPersistedEntrySize;
+
+/// Entries are persisted without their interface, which is not meaningful
+/// across restarts, so only addresses that do not need one can be persisted.
+bool IsPersistable(const ResolveResult & result)
+{
+    return !result.address.GetIPAddress().IsIPv6LinkLocal();
+}
+
+bool IsSamePersistedData(const ResolveResult & a, const ResolveResult & b)
+{
+    return a.address == b.address && a.mrpRemoteConfig == b.mrpRemoteConfig && a.supportsTcpServer == b.supportsTcpServer &&
+        a.supportsTcpClient == b.supportsTcpClient && a.isICDOperatingAsLIT == b.isICDOperatingAsLIT;
+}
+
+} // namespace
+
+CHIP_ERROR NodeAddressCache::Init(PersistentStorageDelegate * storage, System::Clock::Timestamp now)
+{
+    mStorage = storage;
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    CHIP_ERROR err = Load(now);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The cache is only an optimization: keep whatever could be loaded rather than fail.
+        ChipLogError(Discovery, "Failed to load cached node addresses: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+    return CHIP_NO_ERROR;
+}
+
+void NodeAddressCache::Shutdown()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mStorage = nullptr;
+}
+
+NodeAddressCache::Entry * NodeAddressCache::Find(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if ((entry.hasAddress || entry.refreshPending) && entry.peerId == peerId)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+NodeAddressCache::Entry * NodeAddressCache::FindSlotToReuse(System::Clock::Timestamp now)
+{
+    Entry * leastRecentlyUsed = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.IsFree(now) || (entry.hasAddress && entry.expiry <= now && !entry.IsRefreshing(now)))
+        {
+            return &entry;
+        }
+        if (!entry.IsRefreshing(now) && (leastRecentlyUsed == nullptr || entry.lastUsed < leastRecentlyUsed->lastUsed))
+        {
+            leastRecentlyUsed = &entry;
+        }
+    }
+    return leastRecentlyUsed;
+}
+
+bool NodeAddressCache::Lookup(const PeerId & peerId, System::Clock::Timestamp now, ResolveResult & result)
+{
+    Entry * entry = Find(peerId);
+    if (entry != nullptr && entry->hasAddress && entry->expiry <= now)
+    {
+        entry->hasAddress = false;
+    }
+
+    if (entry == nullptr || !entry->hasAddress)
+    {
+        mStats.misses++;
+        return false;
+    }
+
+    mStats.hits++;
+    entry->lastUsed = now;
+    result          = entry->result;
+    return true;
+}
+
+bool NodeAddressCache::Update(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl,
+                              System::Clock::Timestamp now)
+{
+    Entry * entry        = Find(peerId);
+    bool persistedBefore = false;
+    bool changed         = true;
+    if (entry == nullptr)
+    {
+        entry = FindSlotToReuse(now);
+        VerifyOrReturnValue(entry != nullptr, false);
+
+        // Evicting a persisted entry changes the persisted data as well.
+        persistedBefore = entry->hasAddress && IsPersistable(entry->result);
+        *entry          = Entry();
+        entry->peerId   = peerId;
+        entry->lastUsed = now;
+    }
+    else
+    {
+        persistedBefore = entry->hasAddress && IsPersistable(entry->result);
+        changed         = !entry->hasAddress || !IsSamePersistedData(entry->result, result);
+    }
+
+    entry->result     = result;
+    entry->expiry     = now + ttl;
+    entry->hasAddress = true;
+
+    return changed && (persistedBefore || IsPersistable(result));
+}
+
+bool NodeAddressCache::Invalidate(const PeerId & peerId)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr && entry->hasAddress, false);
+
+    entry->hasAddress = false;
+    return true;
+}
+
+bool NodeAddressCache::StartRefresh(const PeerId & peerId, System::Clock::Timestamp now)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr && entry->hasAddress && !entry->IsRefreshing(now), false);
+
+    entry->refreshPending = true;
+    entry->refreshStarted = now;
+    return true;
+}
+
+bool NodeAddressCache::FinishRefresh(const PeerId & peerId, System::Clock::Timestamp now)
+{
+    Entry * entry = Find(peerId);
+    VerifyOrReturnValue(entry != nullptr && entry->IsRefreshing(now), false);
+
+    entry->refreshPending = false;
+    return true;
+}
+
+CHIP_ERROR NodeAddressCache::Save(System::Clock::Timestamp now) const
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_NO_ERROR);
+
+    System::Clock::Milliseconds64 realTime;
+    ReturnErrorOnFailure(System::SystemClock().GetClock_RealTimeMS(realTime));
+
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(kPersistedCacheMaxSize), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(buf.Get(), kPersistedCacheMaxSize);
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+
+    size_t count = 0;
+    for (const auto & entry : mEntries)
+    {
+        if (!entry.hasAddress || entry.expiry <= now || !IsPersistable(entry.result))
+        {
+            continue;
+        }
+        if (count++ == kMaxPersistedEntries)
+        {
+            break;
+        }
+
+        const auto remaining  = std::chrono::duration_cast<System::Clock::Seconds64>(entry.expiry - now);
+        const uint64_t expiry = std::chrono::duration_cast<System::Clock::Seconds64>(realTime).count() + remaining.count();
+
+        uint8_t ipAddress[kIpAddressSize];
+        uint8_t * p = ipAddress;
+        entry.result.address.GetIPAddress().WriteAddress(p);
+
+        BitFlags<PersistedFlags> flags;
+        flags.Set(PersistedFlags::kSupportsTcpServer, entry.result.supportsTcpServer);
+        flags.Set(PersistedFlags::kSupportsTcpClient, entry.result.supportsTcpClient);
+        flags.Set(PersistedFlags::kIsICDOperatingAsLIT, entry.result.isICDOperatingAsLIT);
+
+        const auto & mrpConfig = entry.result.mrpRemoteConfig;
+
+        TLV::TLVType structType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, structType));
+        ReturnErrorOnFailure(writer.Put(kCompressedFabricIdTag, entry.peerId.GetCompressedFabricId()));
+        ReturnErrorOnFailure(writer.Put(kNodeIdTag, entry.peerId.GetNodeId()));
+        ReturnErrorOnFailure(writer.Put(kIpAddressTag, ByteSpan(ipAddress)));
+        ReturnErrorOnFailure(writer.Put(kPortTag, entry.result.address.GetPort()));
+        ReturnErrorOnFailure(writer.Put(kExpiryTag, expiry));
+        ReturnErrorOnFailure(writer.Put(kMrpIdleIntervalTag, mrpConfig.mIdleRetransTimeout.count()));
+        ReturnErrorOnFailure(writer.Put(kMrpActiveIntervalTag, mrpConfig.mActiveRetransTimeout.count()));
+        ReturnErrorOnFailure(writer.Put(kMrpActiveThresholdTag, mrpConfig.mActiveThresholdTime.count()));
+        ReturnErrorOnFailure(writer.Put(kFlagsTag, flags.Raw()));
+        ReturnErrorOnFailure(writer.EndContainer(structType));
+    }
+
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return mStorage->SyncSetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), buf.Get(),
+                                     static_cast<uint16_t>(len));
+}
+
+CHIP_ERROR NodeAddressCache::Load(System::Clock::Timestamp now)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    VerifyOrReturnError(buf.Alloc(kPersistedCacheMaxSize), CHIP_ERROR_NO_MEMORY);
+
+    uint16_t len   = static_cast<uint16_t>(kPersistedCacheMaxSize);
+    CHIP_ERROR err = mStorage->SyncGetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), buf.Get(), len);
+    VerifyOrReturnError(err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    System::Clock::Milliseconds64 realTime;
+    ReturnErrorOnFailure(System::SystemClock().GetClock_RealTimeMS(realTime));
+    const uint64_t realTimeS = std::chrono::duration_cast<System::Clock::Seconds64>(realTime).count();
+
+    TLV::ContiguousBufferTLVReader reader;
+    reader.Init(buf.Get(), len);
+
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        TLV::TLVType structType;
+        ReturnErrorOnFailure(reader.EnterContainer(structType));
+
+        CompressedFabricId compressedFabricId;
+        NodeId nodeId;
+        ByteSpan ipAddress;
+        uint16_t port;
+        uint64_t expiry;
+        uint32_t mrpIdleInterval;
+        uint32_t mrpActiveInterval;
+        uint16_t mrpActiveThreshold;
+        BitFlags<PersistedFlags> flags;
+
+        ReturnErrorOnFailure(reader.Next(kCompressedFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(compressedFabricId));
+        ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(nodeId));
+        ReturnErrorOnFailure(reader.Next(kIpAddressTag));
+        ReturnErrorOnFailure(reader.Get(ipAddress));
+        VerifyOrReturnError(ipAddress.size() == kIpAddressSize, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        ReturnErrorOnFailure(reader.Next(kPortTag));
+        ReturnErrorOnFailure(reader.Get(port));
+        ReturnErrorOnFailure(reader.Next(kExpiryTag));
+        ReturnErrorOnFailure(reader.Get(expiry));
+        ReturnErrorOnFailure(reader.Next(kMrpIdleIntervalTag));
+        ReturnErrorOnFailure(reader.Get(mrpIdleInterval));
+        ReturnErrorOnFailure(reader.Next(kMrpActiveIntervalTag));
+        ReturnErrorOnFailure(reader.Get(mrpActiveInterval));
+        ReturnErrorOnFailure(reader.Next(kMrpActiveThresholdTag));
+        ReturnErrorOnFailure(reader.Get(mrpActiveThreshold));
+        ReturnErrorOnFailure(reader.Next(kFlagsTag));
+        ReturnErrorOnFailure(reader.Get(flags));
+
+        ReturnErrorOnFailure(reader.ExitContainer(structType));
+
+        // Entries whose records have expired while we were not running are of no use, and
+        // addresses already in the cache are more recent than the persisted ones.
+        const PeerId peerId(compressedFabricId, nodeId);
+        if (expiry <= realTimeS || Find(peerId) != nullptr)
+        {
+            continue;
+        }
+
+        Entry * entry = FindSlotToReuse(now);
+        VerifyOrReturnError(entry != nullptr, CHIP_NO_ERROR);
+
+        const uint8_t * p = ipAddress.data();
+        Inet::IPAddress ip;
+        Inet::IPAddress::ReadAddress(p, ip);
+
+        *entry                = Entry();
+        entry->peerId         = peerId;
+        entry->result.address = Transport::PeerAddress::UDP(ip, port);
+        entry->result.mrpRemoteConfig =
+            ReliableMessageProtocolConfig(System::Clock::Milliseconds32(mrpIdleInterval),
+                                          System::Clock::Milliseconds32(mrpActiveInterval),
+                                          System::Clock::Milliseconds16(mrpActiveThreshold));
+        entry->result.supportsTcpServer   = flags.Has(PersistedFlags::kSupportsTcpServer);
+        entry->result.supportsTcpClient   = flags.Has(PersistedFlags::kSupportsTcpClient);
+        entry->result.isICDOperatingAsLIT = flags.Has(PersistedFlags::kIsICDOperatingAsLIT);
+        entry->expiry = now + System::Clock::Seconds32(static_cast<uint32_t>(std::min<uint64_t>(expiry - realTimeS, UINT32_MAX)));
+        entry->lastUsed   = now;
+        entry->hasAddress = true;
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    ReturnErrorOnFailure(reader.ExitContainer(arrayType));
+    return reader.VerifyEndOfContainer();
+}
+
+} // namespace AddressResolve
+} // namespace chip
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/PeerId.h>
+#include <system/SystemClock.h>
+
+#include <cstddef>
+#include <cstdint>
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+namespace chip {
+namespace AddressResolve {
+
+/// Remembers the last resolved address of operational nodes, keyed by PeerId.
+///
+/// Entries expire according to the DNS-SD TTL of the records they were
+/// resolved from. When a storage delegate is provided, routable (i.e. not
+/// link-local) entries are also persisted with a wall-clock expiry, so that a
+/// restarted controller can reach nodes whose records are still valid without
+/// waiting for DNS-SD.
+///
+/// The cache also tracks which nodes have a DNS-SD query running in the
+/// background to refresh their entry, so that the resolver can release those
+/// queries once they complete.
+class NodeAddressCache
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE;
+
+    struct Stats
+    {
+        uint32_t hits   = 0;
+        uint32_t misses = 0;
+    };
+
+    /// Loads any entries previously saved to `storage` that have not expired
+    /// yet, without overriding addresses already in the cache. `storage` may
+    /// be null, in which case the cache only lives in RAM.
+    CHIP_ERROR Init(PersistentStorageDelegate * storage, System::Clock::Timestamp now);
+
+    /// Drops all entries and forgets the storage delegate. Does not touch
+    /// persisted data.
+    void Shutdown();
+
+    /// Fetches the unexpired address cached for `peerId`, counting a hit or
+    /// a miss in the statistics.
+    bool Lookup(const PeerId & peerId, System::Clock::Timestamp now, ResolveResult & result);
+
+    /// Remembers `result` as the address of `peerId` for the next `ttl`.
+    ///
+    /// Returns true if anything but the expiry of the entry changed, i.e. if
+    /// the persisted data is now out of date.
+    bool Update(const PeerId & peerId, const ResolveResult & result, System::Clock::Seconds32 ttl, System::Clock::Timestamp now);
+
+    /// Forgets the address of `peerId`. Returns true if one was cached.
+    bool Invalidate(const PeerId & peerId);
+
+    /// Records that a DNS-SD query for `peerId` keeps running in the background
+    /// to refresh its entry. Returns false if there is no entry to refresh or
+    /// if a refresh is already running, in which case the caller should
+    /// release its query instead.
+    bool StartRefresh(const PeerId & peerId, System::Clock::Timestamp now);
+
+    /// Marks the background refresh of `peerId` as complete. Returns true if
+    /// one was running, in which case the caller owns releasing its query.
+    bool FinishRefresh(const PeerId & peerId, System::Clock::Timestamp now);
+
+    /// Marks all running background refreshes as complete, calling
+    /// `onFinished(peerId)` for each of them.
+    template <typename Function>
+    void FinishAllRefreshes(System::Clock::Timestamp now, Function && onFinished)
+    {
+        for (auto & entry : mEntries)
+        {
+            if (entry.IsRefreshing(now))
+            {
+                entry.refreshPending = false;
+                onFinished(entry.peerId);
+            }
+        }
+    }
+
+    /// Writes all routable unexpired entries to the storage delegate given to
+    /// Init(). Does nothing if there is none.
+    CHIP_ERROR Save(System::Clock::Timestamp now) const;
+
+    const Stats & GetStats() const { return mStats; }
+
+private:
+    struct Entry
+    {
+        PeerId peerId;
+        ResolveResult result;
+        System::Clock::Timestamp expiry;
+        System::Clock::Timestamp lastUsed;
+        System::Clock::Timestamp refreshStarted;
+        bool hasAddress     = false;
+        bool refreshPending = false;
+
+        /// Refreshes that never reported back (e.g. DNS-SD gave up silently)
+        /// stop counting once a full lookup would have timed out.
+        bool IsRefreshing(System::Clock::Timestamp now) const
+        {
+            return refreshPending &&
+                (now - refreshStarted) < System::Clock::Milliseconds32(CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS);
+        }
+
+        bool IsFree(System::Clock::Timestamp now) const { return !hasAddress && !IsRefreshing(now); }
+    };
+
+    Entry * Find(const PeerId & peerId);
+
+    /// Returns the entry to reuse for a new node: a free one if possible, else
+    /// the least recently used one that is not being refreshed.
+    Entry * FindSlotToReuse(System::Clock::Timestamp now);
+
+    CHIP_ERROR Load(System::Clock::Timestamp now);
+
+    Entry mEntries[kCapacity];
+    PersistentStorageDelegate * mStorage = nullptr;
+    Stats mStats;
+};
+
+} // namespace AddressResolve
+} // namespace chip
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
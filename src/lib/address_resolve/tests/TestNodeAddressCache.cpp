@@ -0,0 +1,243 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/address_resolve/AddressResolve.h>
+#include <lib/address_resolve/NodeAddressCache.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <system/RAIIMockClock.h>
+
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
+
+using namespace chip;
+using namespace chip::AddressResolve;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr System::Clock::Seconds32 kTtl(120);
+
+class TestNodeAddressCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override { ASSERT_EQ(mClock.SetClock_RealTime(System::Clock::Seconds64(1'700'000'000)), CHIP_NO_ERROR); }
+
+    System::Clock::Timestamp Now() { return System::SystemClock().GetMonotonicTimestamp(); }
+
+    System::Clock::Internal::RAIIMockClock mClock;
+};
+
+ResolveResult MakeResult(const char * ip, uint16_t port = CHIP_PORT)
+{
+    Inet::IPAddress ipAddress;
+    EXPECT_TRUE(Inet::IPAddress::FromString(ip, ipAddress));
+
+    ResolveResult result;
+    result.address           = Transport::PeerAddress::UDP(ipAddress, port);
+    result.supportsTcpServer = true;
+    result.mrpRemoteConfig   = ReliableMessageProtocolConfig(1234_ms32, 567_ms32, 89_ms16);
+    return result;
+}
+
+TEST_F(TestNodeAddressCache, ServesEntriesUntilTheirTtlExpires)
+{
+    NodeAddressCache cache;
+    ASSERT_EQ(cache.Init(nullptr, Now()), CHIP_NO_ERROR);
+
+    const PeerId peer(1, 2);
+    ResolveResult result;
+    EXPECT_FALSE(cache.Lookup(peer, Now(), result));
+
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::1"), kTtl, Now()));
+    EXPECT_TRUE(cache.Lookup(peer, Now(), result));
+    EXPECT_EQ(result.address, MakeResult("2001::1").address);
+    EXPECT_TRUE(result.supportsTcpServer);
+
+    // Other nodes are not affected
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 3), Now(), result));
+    EXPECT_FALSE(cache.Lookup(PeerId(2, 2), Now(), result));
+
+    mClock.AdvanceMonotonic(119_s);
+    EXPECT_TRUE(cache.Lookup(peer, Now(), result));
+    mClock.AdvanceMonotonic(1_s);
+    EXPECT_FALSE(cache.Lookup(peer, Now(), result));
+
+    EXPECT_EQ(cache.GetStats().hits, 2u);
+    EXPECT_EQ(cache.GetStats().misses, 4u);
+}
+
+TEST_F(TestNodeAddressCache, UpdateReportsPersistedDataChanges)
+{
+    NodeAddressCache cache;
+    ASSERT_EQ(cache.Init(nullptr, Now()), CHIP_NO_ERROR);
+
+    const PeerId peer(1, 2);
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::1"), kTtl, Now()));
+
+    // Refreshing the same data only extends the entry
+    mClock.AdvanceMonotonic(100_s);
+    EXPECT_FALSE(cache.Update(peer, MakeResult("2001::1"), kTtl, Now()));
+    mClock.AdvanceMonotonic(100_s);
+    ResolveResult result;
+    EXPECT_TRUE(cache.Lookup(peer, Now(), result));
+
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::2"), kTtl, Now()));
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::2", 1234), kTtl, Now()));
+
+    // Link-local addresses are not persisted, but replacing a persisted address with one is a change
+    EXPECT_TRUE(cache.Update(peer, MakeResult("fe80::1"), kTtl, Now()));
+    EXPECT_FALSE(cache.Update(peer, MakeResult("fe80::2"), kTtl, Now()));
+    EXPECT_FALSE(cache.Update(PeerId(1, 3), MakeResult("fe80::3"), kTtl, Now()));
+}
+
+TEST_F(TestNodeAddressCache, InvalidateDropsEntry)
+{
+    NodeAddressCache cache;
+    ASSERT_EQ(cache.Init(nullptr, Now()), CHIP_NO_ERROR);
+
+    const PeerId peer(1, 2);
+    EXPECT_FALSE(cache.Invalidate(peer));
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::1"), kTtl, Now()));
+    EXPECT_TRUE(cache.Invalidate(peer));
+    EXPECT_FALSE(cache.Invalidate(peer));
+
+    ResolveResult result;
+    EXPECT_FALSE(cache.Lookup(peer, Now(), result));
+}
+
+TEST_F(TestNodeAddressCache, EvictsLeastRecentlyUsedEntryWhenFull)
+{
+    NodeAddressCache cache;
+    ASSERT_EQ(cache.Init(nullptr, Now()), CHIP_NO_ERROR);
+
+    for (NodeId node = 0; node < NodeAddressCache::kCapacity; node++)
+    {
+        EXPECT_TRUE(cache.Update(PeerId(1, node), MakeResult("2001::1"), kTtl, Now()));
+        mClock.AdvanceMonotonic(1_ms64);
+    }
+
+    // Use the oldest entry, so that the second oldest one is evicted
+    ResolveResult result;
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 0), Now(), result));
+
+    EXPECT_TRUE(cache.Update(PeerId(2, 0), MakeResult("2001::2"), kTtl, Now()));
+    EXPECT_TRUE(cache.Lookup(PeerId(2, 0), Now(), result));
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 0), Now(), result));
+#if CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 1
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 1), Now(), result));
+#endif
+}
+
+TEST_F(TestNodeAddressCache, TracksBackgroundRefreshes)
+{
+    NodeAddressCache cache;
+    ASSERT_EQ(cache.Init(nullptr, Now()), CHIP_NO_ERROR);
+
+    const PeerId peer(1, 2);
+
+    // Nothing to refresh yet
+    EXPECT_FALSE(cache.StartRefresh(peer, Now()));
+
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::1"), kTtl, Now()));
+    EXPECT_TRUE(cache.StartRefresh(peer, Now()));
+    EXPECT_FALSE(cache.StartRefresh(peer, Now()));
+    EXPECT_TRUE(cache.FinishRefresh(peer, Now()));
+    EXPECT_FALSE(cache.FinishRefresh(peer, Now()));
+
+    // Refreshes are still tracked once their entry is invalidated
+    EXPECT_TRUE(cache.StartRefresh(peer, Now()));
+    EXPECT_TRUE(cache.Invalidate(peer));
+    EXPECT_TRUE(cache.FinishRefresh(peer, Now()));
+
+    // Refreshes that never complete stop counting after the maximum lookup time
+    EXPECT_TRUE(cache.Update(peer, MakeResult("2001::1"), kTtl, Now()));
+    EXPECT_TRUE(cache.StartRefresh(peer, Now()));
+    mClock.AdvanceMonotonic(System::Clock::Milliseconds64(CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS));
+    EXPECT_FALSE(cache.FinishRefresh(peer, Now()));
+
+    EXPECT_TRUE(cache.StartRefresh(peer, Now()));
+    size_t finished = 0;
+    cache.FinishAllRefreshes(Now(), [&](const PeerId & refreshedPeer) {
+        EXPECT_EQ(refreshedPeer, peer);
+        finished++;
+    });
+    EXPECT_EQ(finished, 1u);
+    EXPECT_FALSE(cache.FinishRefresh(peer, Now()));
+}
+
+TEST_F(TestNodeAddressCache, PersistsRoutableEntriesWithWallClockExpiry)
+{
+    TestPersistentStorageDelegate storage;
+
+    {
+        NodeAddressCache cache;
+        ASSERT_EQ(cache.Init(&storage, Now()), CHIP_NO_ERROR);
+        EXPECT_TRUE(cache.Update(PeerId(1, 2), MakeResult("2001::1", 1234), kTtl, Now()));
+        EXPECT_TRUE(cache.Update(PeerId(1, 3), MakeResult("2001::2"), System::Clock::Seconds32(10), Now()));
+        EXPECT_FALSE(cache.Update(PeerId(1, 4), MakeResult("fe80::1"), kTtl, Now()));
+        EXPECT_EQ(cache.Save(Now()), CHIP_NO_ERROR);
+    }
+
+    // Restart: monotonic time starts over, wall-clock time goes on
+    mClock.SetMonotonic(0_ms64);
+    mClock.AdvanceRealTime(60_s);
+
+    NodeAddressCache cache;
+    ASSERT_EQ(cache.Init(&storage, Now()), CHIP_NO_ERROR);
+
+    ResolveResult result;
+    ASSERT_TRUE(cache.Lookup(PeerId(1, 2), Now(), result));
+    EXPECT_EQ(result.address, MakeResult("2001::1", 1234).address);
+    EXPECT_TRUE(result.supportsTcpServer);
+    EXPECT_FALSE(result.supportsTcpClient);
+    EXPECT_EQ(result.mrpRemoteConfig, MakeResult("2001::1").mrpRemoteConfig);
+
+    // Expired while not running
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 3), Now(), result));
+    // Link-local addresses need an interface, which does not survive restarts
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 4), Now(), result));
+
+    // The remaining TTL carries over
+    mClock.AdvanceMonotonic(59_s);
+    EXPECT_TRUE(cache.Lookup(PeerId(1, 2), Now(), result));
+    mClock.AdvanceMonotonic(1_s);
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 2), Now(), result));
+}
+
+TEST_F(TestNodeAddressCache, IgnoresCorruptPersistedData)
+{
+    TestPersistentStorageDelegate storage;
+    const uint8_t garbage[] = { 0x15, 0x24, 0x01 };
+    ASSERT_EQ(storage.SyncSetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), garbage, sizeof(garbage)),
+              CHIP_NO_ERROR);
+
+    NodeAddressCache cache;
+    EXPECT_EQ(cache.Init(&storage, Now()), CHIP_NO_ERROR);
+
+    ResolveResult result;
+    EXPECT_FALSE(cache.Lookup(PeerId(1, 2), Now(), result));
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE > 0
@@ -799,6 +799,24 @@
 #define CHIP_CONFIG_MAX_FABRICS 16
 #endif // CHIP_CONFIG_MAX_FABRICS
 
+/**
+ * @def CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+ *
+ * @brief Number of CASE handshakes the CASE server drives concurrently as a
+ * responder. Sigma1 messages received while all handshakes are in progress are
+ * answered with a Busy status report.
+ *
+ * Each concurrent handshake keeps one SecureSession reserved for the duration of
+ * the handshake, which is accounted for in CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+ *
+ * GN builds set it with the chip_config_case_server_max_concurrent_handshakes
+ * argument.
+ *
+ */
+#ifndef CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+#define CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES 1
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES
+
 /**
  * @def CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
  *
@@ -808,7 +826,8 @@
  *
  * This is sized by default to cover the sum of the following:
  *  - At least 3 CASE sessions / fabric (Spec Ref: 4.13.2.8)
- *  - 1 reserved slot for CASEServer as a responder.
+ *  - 1 reserved slot for each concurrent CASEServer handshake as a responder
+ *    (CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES).
  *  - 1 reserved slot for PASE.
  *
  *  NOTE: On heap-based platforms, there is no pre-allocation of the pool.
@@ -818,9 +837,98 @@
  *
  */
 #ifndef CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
-#define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
+#define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 1 + CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+ *
+ * @brief Enables hash indexes of the secure session table, keyed by local
+ * session ID and by peer ScopedNodeId. Per-message session lookup, session ID
+ * allocation and per-peer session lookups then no longer scan the whole table.
+ *
+ * The indexes need (2 * CHIP_CONFIG_SECURE_SESSION_POOL_SIZE) rounded up to
+ * the next power of two slots each, of two pointers in size, so they are
+ * worthwhile on devices configured for many concurrent sessions.
+ *
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX 0
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+/**
+ * @def CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+ *
+ * @brief Enables Transport::SessionCryptoWorkerPool, which SessionManager
+ * can use to decrypt incoming secure unicast messages on worker threads.
+ * Messages of a session are still verified against its message counter and
+ * dispatched in order, on the Matter thread.
+ *
+ * Builds opt in with the chip_config_session_crypto_offload GN argument, and
+ * applications at runtime through SessionManager::SetCryptoWorkerPool.
+ * The pool needs threads, a select-based System::Layer and a crypto backend
+ * that can be used from several threads at once.
+ *
+ */
+#ifndef CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+#define CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD 0
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
+/**
+ * @def CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_THREADS
+ *
+ * @brief Maximum number of worker threads of a SessionCryptoWorkerPool.
+ *
+ */
+#ifndef CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_THREADS
+#define CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_THREADS 8
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_THREADS
+
+/**
+ * @def CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES
+ *
+ * @brief Maximum number of incoming messages a SessionManager has queued for
+ * decryption on worker threads. Once reached, further messages are dropped
+ * until queued ones are dispatched; the peer retransmits reliable messages.
+ *
+ */
+#ifndef CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES
+#define CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES 64
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES
+
+/**
+ * @def CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+ *
+ * @brief Enables a sorted index of all paths registered in a
+ * ServerClusterInterfaceRegistry, so that looking up the cluster for a path
+ * is a binary search instead of a walk over every registration.
+ *
+ * The index is heap allocated (one 16-byte entry per registered path on 64-bit
+ * targets), so it is intended for devices with many code-driven clusters, such
+ * as bridges.
+ *
+ */
+#ifndef CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+#define CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX 0
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
+/**
+ * @def CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+ *
+ * @brief Enables a hash index of the ember endpoint table, keyed by endpoint
+ * ID, so that resolving an endpoint ID to its index (done for every attribute
+ * access through ember attribute storage) does not scan every fixed and
+ * dynamic endpoint.
+ *
+ * The index needs (2 * MAX_ENDPOINT_COUNT) rounded up to the next power of two
+ * slots, of two pointers in size, so it is intended for bridges configured with
+ * many dynamic endpoints (CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT).
+ *
+ */
+#ifndef CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+#define CHIP_CONFIG_EMBER_ENDPOINT_INDEX 0
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -906,6 +1014,8 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS
+ *      * #CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -983,6 +1093,34 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS
+ *
+ * @brief Defines the maximum number of concrete attribute paths that are tracked individually as dirty, in addition to the
+ *        dirty set. Concrete paths that do not fit are added to the dirty set, which merges paths into cluster or endpoint
+ *        wildcards when it is full and then reports every attribute under them. The table takes 22 to 43 bytes of RAM per path.
+ *        0 disables the table.
+ */
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS 0
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS
+ *
+ * @brief Defines the maximum number of concrete attribute paths a ReadHandler remembers from the expansion of its attribute
+ *        paths, so that reports do not iterate over the endpoints, clusters and attributes of the data model again until
+ *        its structure changes. The cache is allocated from the heap, taking 12 bytes per path, when a handler first
+ *        reports; handlers whose paths expand to more paths than this iterate over the data model instead. 0 disables the
+ *        cache.
+ *
+ *        Priming reports do not use the cache: filling it costs more than the single expansion they need. GN builds set
+ *        this with the chip_im_server_max_num_cached_expanded_paths argument.
+ */
+#ifndef CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_CACHED_EXPANDED_PATHS 0
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1200,6 +1338,42 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_CONCURRENT_ITERATORS 2
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+ *
+ * @brief The number of group session candidates the group data provider keeps in RAM.
+ *
+ * Each received group message is matched against the operational keys of
+ * every keyset mapped to a group, by session id. With the index, these
+ * (session id, fabric, group, keys) candidates are read from storage once,
+ * when the group key map or the keysets change, instead of for every
+ * message. Each entry takes about 40 bytes and holds key material.
+ *
+ * The index needs an entry per group key mapping and epoch key; while
+ * there are more than that, messages are matched from storage. Set to 0
+ * to disable the index.
+ */
+#ifndef CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+ *
+ * @brief The number of verified operational certificate chains the fabric table remembers.
+ *
+ * CASE verifies the certificate chain of the peer in every handshake. A
+ * chain that was verified before only has the validity periods of its
+ * certificates checked again, instead of their signatures. Each entry takes
+ * about 250 bytes; a controller should have an entry per peer that it
+ * reconnects to.
+ *
+ * Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_NAME_LENGTH
  *
@@ -1209,6 +1383,34 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MAX_GROUP_NAME_LENGTH 16
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+ *
+ * @brief Enables a compiled copy of the access control entries, grouped by
+ * fabric, and a cache of recent AccessControl::Check() results, so that the
+ * many checks of a wildcard read or subscription do not each walk every entry
+ * through the access control delegate.
+ *
+ * The compiled entries are heap allocated and rebuilt on the first check after
+ * any entry changes. Results of checks that depend on device type targets are
+ * not cached, since they depend on the current endpoint composition.
+ *
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+#define CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE 0
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+ *
+ * @brief Number of check results kept by the access control check cache, if
+ * enabled by CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE. Must be a power of two.
+ *
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+#define CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE 64
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_MAX_ENTRIES_PER_FABRIC
  *
@@ -1362,6 +1564,24 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+ *
+ * @brief The number of events each event logging buffer keeps an index entry for.
+ *
+ * The index records the number, path, fabric and location of the events
+ * in a buffer, so that reports can seek to the first event a subscriber
+ * has not received yet and skip events of other paths without decoding
+ * them. Each entry takes 32 bytes per buffer.
+ *
+ * The index should cover as many events as a buffer can hold; while a
+ * buffer holds more events than that, reports fall back to decoding every
+ * event. Set to 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 0
+#endif /* CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1505,6 +1725,29 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of node addresses remembered by the default address resolver.
+ *
+ *        A lookup for a node with an unexpired cached address completes with
+ *        that address right away, while the DNS-SD query keeps running in the
+ *        background to refresh the entry.  Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SECONDS
+ *
+ * @brief Lifetime of a cached node address, in seconds, when the DNS-SD
+ *        backend does not report the TTL of the records it resolved.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SECONDS
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SECONDS 120
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_DEFAULT_TTL_SECONDS
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1674,6 +1917,24 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS 1
 #endif // CHIP_CONFIG_SCENES_USE_DEFAULT_HANDLERS
 
+/**
+ * @def CHIP_CONFIG_FABRIC_TABLE_CACHE_BYTES
+ *
+ * @brief The number of bytes of heap that each table based on app::Storage::FabricTableImpl (e.g. the scene table) may use to
+ * keep the values it read from or wrote to persistent storage in RAM.
+ *
+ * With the cache, getting an entry, counting or iterating entries does not read storage once the values are cached, and the
+ * writes of one operation (e.g. the entry, fabric entry map and endpoint count written when storing a new scene) are coalesced
+ * into one write per key, made before the operation returns. A table with a cache must be the only one accessing its storage
+ * keys. Each cached value takes its size plus about 60 bytes (scenes take up to
+ * CHIP_CONFIG_SCENES_MAX_SERIALIZED_SCENE_SIZE_BYTES).
+ *
+ * Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_FABRIC_TABLE_CACHE_BYTES
+#define CHIP_CONFIG_FABRIC_TABLE_CACHE_BYTES 0
+#endif // CHIP_CONFIG_FABRIC_TABLE_CACHE_BYTES
+
 /**
  * @def CHIP_CONFIG_TIME_ZONE_LIST_MAX_SIZE
  *
@@ -817,18 +817,30 @@ CHIP_ERROR TLVReader::ReadElement()
 
     // 17 = 1 control byte + 8 tag bytes + 8 length/value bytes
     uint8_t stagingBuf[17];
+    const uint8_t * p;
 
-    // Odd workaround: clang-tidy claims garbage value otherwise as it does not
-    // understand that ReadData initializes stagingBuf
-    stagingBuf[1] = 0;
-
-    // If the head of the element goes past the end of the current input buffer,
-    // we need to read it into the staging buffer to parse it.  Just do that unconditionally,
-    // even if the head does not go past end of current buffer, to save codesize.
-    ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+    if (static_cast<size_t>(mBufEnd - mReadPoint) >= elemHeadBytes)
+    {
+        // The head is within the current input buffer (always the case for contiguous
+        // buffers): parse it in place. This is the hot path of every decode.
+        p = mReadPoint;
+        mReadPoint += elemHeadBytes;
+        mLenRead += elemHeadBytes;
+    }
+    else
+    {
+        // Odd workaround: clang-tidy claims garbage value otherwise as it does not
+        // understand that ReadData initializes stagingBuf
+        stagingBuf[1] = 0;
+
+        // The head of the element goes past the end of the current input buffer,
+        // so read it into the staging buffer to parse it.
+        ReturnErrorOnFailure(ReadData(stagingBuf, elemHeadBytes));
+        p = stagingBuf;
+    }
 
     // +1 to skip over the control byte
-    const uint8_t * p = stagingBuf + 1;
+    p++;
 
     // Read the tag field, if present.
     mElemTag      = ReadTag(tagControl, p);
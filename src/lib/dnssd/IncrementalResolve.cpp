@@ -25,6 +25,8 @@
 #include <lib/support/CHIPMemString.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace Dnssd {
 
@@ -192,6 +194,7 @@ CHIP_ERROR IncrementalResolver::InitializeParsing(mdns::Minimal::SerializedQName
                 return err;
             }
             mSpecificResolutionData.Get<OperationalNodeData>().hasZeroTTL = (ttl == 0);
+            UpdateOperationalTtl(ttl);
         }
 
         LogFoundOperationalSrvRecord(mSpecificResolutionData.Get<OperationalNodeData>().peerId, mTargetHostName.Get());
@@ -270,7 +273,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
 #else
 #if CHIP_MINMDNS_HIGH_VERBOSITY
         ChipLogProgress(Discovery, "Ignoring A record: IPv4 not supported");
@@ -292,7 +295,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
     }
     case QType::SRV: // SRV handled on creation, ignored for 'additional data'
     default:
@@ -325,7 +328,7 @@ CHIP_ERROR IncrementalResolver::OnTxtRecord(const ResourceData & data, BytesRang
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr)
+CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttl)
 {
     if (mCommonResolutionData.numIPs >= MATTER_ARRAY_SIZE(mCommonResolutionData.ipAddress))
     {
@@ -344,12 +347,25 @@ CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const I
     }
 
     mCommonResolutionData.ipAddress[mCommonResolutionData.numIPs++] = addr;
+    UpdateOperationalTtl(ttl);
 
     LogFoundIPAddress(mTargetHostName.Get(), addr);
 
     return CHIP_NO_ERROR;
 }
 
+void IncrementalResolver::UpdateOperationalTtl(uint64_t ttl)
+{
+    VerifyOrReturn(IsActiveOperationalParse());
+
+    auto & currentTtl = mSpecificResolutionData.Get<OperationalNodeData>().ttl;
+    const System::Clock::Seconds32 newTtl(static_cast<uint32_t>(std::min<uint64_t>(ttl, UINT32_MAX)));
+    if (!currentTtl.has_value() || newTtl < *currentTtl)
+    {
+        currentTtl = newTtl;
+    }
+}
+
 CHIP_ERROR IncrementalResolver::Take(DiscoveredNodeData & outputData)
 {
     VerifyOrReturnError(IsActiveCommissionParse(), CHIP_ERROR_INCORRECT_STATE);
@@ -186,7 +186,10 @@ private:
     /// addresses.
     ///
     /// Prerequisite: IP address belongs to the right nost name
-    CHIP_ERROR OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr);
+    CHIP_ERROR OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttl);
+
+    /// Lowers the TTL reported for an operational node to `ttl` if it is smaller.
+    void UpdateOperationalTtl(uint64_t ttl);
 
     using ParsedRecordSpecificData = Variant<OperationalNodeData, CommissionNodeData>;
 
@@ -210,8 +210,14 @@ struct CommonResolutionData
 struct OperationalNodeData
 {
     PeerId peerId;
-    bool hasZeroTTL;
-    void Reset() { peerId = PeerId(); }
+    bool hasZeroTTL = false;
+    // Smallest TTL of the records this data was built from, if the backend reports it.
+    std::optional<System::Clock::Seconds32> ttl;
+    void Reset()
+    {
+        peerId = PeerId();
+        ttl.reset();
+    }
 };
 
 struct OperationalNodeBrowseData : public OperationalNodeData
@@ -18,6 +18,12 @@
 #pragma once
 
 namespace chip {
+namespace Tracing {
+namespace Histograms {
+class MetricHistogramBackend;
+} // namespace Histograms
+} // namespace Tracing
+
 namespace Shell {
 
 /**
@@ -86,5 +92,12 @@ void RegisterNFCCommands();
  */
 void RegisterDnsCommands();
 
+/**
+ * This function registers the metric histogram commands, which print the statistics
+ * aggregated by the given backend. The backend must outlive the shell.
+ *
+ */
+void RegisterMetricsCommands(Tracing::Histograms::MetricHistogramBackend & backend);
+
 } // namespace Shell
 } // namespace chip
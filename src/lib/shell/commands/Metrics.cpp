@@ -0,0 +1,71 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/shell/Commands.h>
+#include <lib/shell/Engine.h>
+#include <lib/shell/SubShellCommand.h>
+#include <tracing/histograms/histogram_tracing.h>
+
+using namespace chip;
+using namespace chip::Tracing::Histograms;
+
+namespace chip {
+namespace Shell {
+namespace {
+
+MetricHistogramBackend * sBackend = nullptr;
+
+CHIP_ERROR MetricsShowHandler(int argc, char ** argv)
+{
+    streamer_printf(streamer_get(), "%-40s %8s %8s %10s %10s %10s %10s %10s\r\n", "metric", "count", "errors", "min", "p50", "p90",
+                    "p99", "max");
+
+    sBackend->ForEachSummary([](const MetricSummary & summary) {
+        // Durations are recorded in microseconds.
+        streamer_printf(streamer_get(), "%-40s %8u %8u %10u %10u %10u %10u %10u%s\r\n", summary.key,
+                        static_cast<unsigned>(summary.count), static_cast<unsigned>(summary.errors),
+                        static_cast<unsigned>(summary.min), static_cast<unsigned>(summary.p50),
+                        static_cast<unsigned>(summary.p90), static_cast<unsigned>(summary.p99),
+                        static_cast<unsigned>(summary.max), summary.isDuration ? " us" : "");
+    });
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR MetricsResetHandler(int argc, char ** argv)
+{
+    sBackend->Reset();
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+void RegisterMetricsCommands(MetricHistogramBackend & backend)
+{
+    static constexpr Command subCommands[] = {
+        { &MetricsShowHandler, "show", "Print the count, errors and percentiles of every metric" },
+        { &MetricsResetHandler, "reset", "Clear the metric statistics" },
+    };
+
+    static constexpr Command metricsCommand = { &SubShellCommand<MATTER_ARRAY_SIZE(subCommands), subCommands>, "metrics",
+                                                "Metric histogram commands" };
+
+    sBackend = &backend;
+    Engine::Root().RegisterCommands(&metricsCommand, 1);
+}
+
+} // namespace Shell
+} // namespace chip
@@ -0,0 +1,65 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/TestPersistentStorageDelegate.h>
+
+#include <cstddef>
+
+namespace chip {
+
+/**
+ * TestPersistentStorageDelegate that counts the accesses made to it, for unit tests and benchmarks checking how often a
+ * module reads and writes its storage.
+ *
+ * Accesses to poison keys and rejected writes are counted too.
+ */
+class CountingPersistentStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    size_t mReads   = 0;
+    size_t mWrites  = 0;
+    size_t mDeletes = 0;
+
+    /**
+     * @brief Returns the number of writes and deletions.
+     */
+    size_t GetNumMutations() const { return mWrites + mDeletes; }
+
+protected:
+    CHIP_ERROR SyncGetKeyValueInternal(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReads++;
+        return TestPersistentStorageDelegate::SyncGetKeyValueInternal(key, buffer, size);
+    }
+
+    CHIP_ERROR SyncSetKeyValueInternal(const char * key, const void * value, uint16_t size) override
+    {
+        mWrites++;
+        return TestPersistentStorageDelegate::SyncSetKeyValueInternal(key, value, size);
+    }
+
+    CHIP_ERROR SyncDeleteKeyValueInternal(const char * key) override
+    {
+        mDeletes++;
+        return TestPersistentStorageDelegate::SyncDeleteKeyValueInternal(key);
+    }
+};
+
+} // namespace chip
@@ -128,6 +128,9 @@ public:
         return StorageKeyName::Formatted("g/s/%s", resumptionIdBase64);
     }
 
+    // Operational address resolution
+    static StorageKeyName AddressResolveCache() { return StorageKeyName::FromConst("g/arc"); }
+
     // Access Control
     static StorageKeyName AccessControlAclEntry(FabricIndex fabric, size_t index)
     {
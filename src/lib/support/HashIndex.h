@@ -0,0 +1,243 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A fixed-capacity open-addressing hash index over objects owned elsewhere
+ *      (typically in an ObjectPool), used to replace linear scans on lookup paths.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Iterators.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+
+/**
+ * Maps a 32-bit hash to pointers of objects of type T, which are not owned by the index.
+ *
+ * Several objects may be indexed under the same hash, and different keys may collide on the same
+ * hash, so ForEach() visits every object indexed under the requested hash and the caller is expected
+ * to compare the actual key.
+ *
+ * Collisions are resolved with linear probing. The table has more than twice as many slots as
+ * kMaxItems, so probe sequences stay short. Objects may be removed from within a ForEach()
+ * callback: removal is then deferred to a tombstone, and the table is compacted once the
+ * outermost iteration ends.
+ *
+ * @tparam T        the type of the indexed objects
+ * @tparam kMaxItems the maximum number of objects that can be indexed at once
+ */
+template <typename T, size_t kMaxItems>
+class HashIndex
+{
+public:
+    static_assert(kMaxItems > 0, "HashIndex needs room for at least one item");
+
+    static constexpr unsigned kCapacityBits = [] {
+        unsigned bits = 1;
+        while ((size_t(1) << bits) <= 2 * kMaxItems)
+        {
+            bits++;
+        }
+        return bits;
+    }();
+    static_assert(kCapacityBits < 32, "HashIndex is limited to 32-bit hashes");
+
+    static constexpr size_t kCapacity = size_t(1) << kCapacityBits;
+
+    /**
+     * Index an object under the given hash.
+     *
+     * @return false if kMaxItems objects are already indexed.
+     */
+    bool Insert(uint32_t hash, T * item)
+    {
+        VerifyOrReturnValue(item != nullptr && mSize < kMaxItems, false);
+
+        size_t i = HomeSlot(hash);
+        while (mSlots[i].mItem != nullptr || mSlots[i].mRemoved)
+        {
+            i = (i + 1) & kMask;
+        }
+        mSlots[i].mItem = item;
+        mSlots[i].mHash = hash;
+        mSize++;
+        return true;
+    }
+
+    /**
+     * Remove an object that was indexed under the given hash.
+     *
+     * @return false if the object was not found.
+     */
+    bool Remove(uint32_t hash, T * item)
+    {
+        for (size_t i = HomeSlot(hash); !IsEmpty(i); i = (i + 1) & kMask)
+        {
+            if (mSlots[i].mItem == item)
+            {
+                mSize--;
+                if (mIterationDepth > 0)
+                {
+                    mSlots[i].mItem    = nullptr;
+                    mSlots[i].mRemoved = true;
+                    mHasRemoved        = true;
+                }
+                else
+                {
+                    EraseAt(i);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Call `function(T *)` for every object indexed under the given hash. The function returns
+     * Loop::Continue to continue with the next object, or Loop::Break to stop.
+     *
+     * @return Loop::Break if the iteration was stopped by the function, Loop::Finish otherwise.
+     */
+    template <typename Function>
+    Loop ForEach(uint32_t hash, Function && function)
+    {
+        Loop result = Loop::Finish;
+        mIterationDepth++;
+        for (size_t i = HomeSlot(hash); !IsEmpty(i); i = (i + 1) & kMask)
+        {
+            if (mSlots[i].mItem != nullptr && mSlots[i].mHash == hash && function(mSlots[i].mItem) == Loop::Break)
+            {
+                result = Loop::Break;
+                break;
+            }
+        }
+        mIterationDepth--;
+        if (mIterationDepth == 0 && mHasRemoved)
+        {
+            Compact();
+        }
+        return result;
+    }
+
+    /**
+     * Return the first object indexed under the given hash for which `predicate(const T *)` holds,
+     * or nullptr if there is none.
+     */
+    template <typename Predicate>
+    T * Find(uint32_t hash, Predicate && predicate) const
+    {
+        for (size_t i = HomeSlot(hash); !IsEmpty(i); i = (i + 1) & kMask)
+        {
+            if (mSlots[i].mItem != nullptr && mSlots[i].mHash == hash && predicate(static_cast<const T *>(mSlots[i].mItem)))
+            {
+                return mSlots[i].mItem;
+            }
+        }
+        return nullptr;
+    }
+
+    void Clear()
+    {
+        VerifyOrDie(mIterationDepth == 0);
+        for (auto & slot : mSlots)
+        {
+            slot = Slot();
+        }
+        mSize       = 0;
+        mHasRemoved = false;
+    }
+
+    size_t Size() const { return mSize; }
+
+private:
+    static constexpr size_t kMask = kCapacity - 1;
+
+    struct Slot
+    {
+        T * mItem      = nullptr;
+        uint32_t mHash = 0;
+        // Set for an object removed while iterating; the slot keeps probe sequences intact until Compact().
+        bool mRemoved  = false;
+    };
+
+    static size_t HomeSlot(uint32_t hash)
+    {
+        // Fibonacci hashing: the top bits of the product spread clustered hashes (e.g. sequential session IDs) over the table.
+        return static_cast<size_t>(static_cast<uint32_t>(hash * 2654435769u) >> (32 - kCapacityBits));
+    }
+
+    bool IsEmpty(size_t i) const { return mSlots[i].mItem == nullptr && !mSlots[i].mRemoved; }
+
+    // Backward-shift deletion: empties slot i and moves later entries of the same probe run into the gap, so no tombstone
+    // is left behind.
+    void EraseAt(size_t i)
+    {
+        size_t j = i;
+        while (true)
+        {
+            mSlots[i] = Slot();
+            while (true)
+            {
+                j = (j + 1) & kMask;
+                if (IsEmpty(j))
+                {
+                    return;
+                }
+                size_t k = HomeSlot(mSlots[j].mHash);
+                // Entry j stays if its home slot lies cyclically in (i, j].
+                bool staysInPlace = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+                if (!staysInPlace)
+                {
+                    break;
+                }
+            }
+            mSlots[i] = mSlots[j];
+            i         = j;
+        }
+    }
+
+    void Compact()
+    {
+        mHasRemoved = false;
+        bool found  = true;
+        while (found)
+        {
+            found = false;
+            for (size_t i = 0; i < kCapacity; i++)
+            {
+                if (mSlots[i].mRemoved)
+                {
+                    EraseAt(i);
+                    found = true;
+                }
+            }
+        }
+    }
+
+    Slot mSlots[kCapacity];
+    size_t mSize             = 0;
+    unsigned mIterationDepth = 0;
+    bool mHasRemoved         = false;
+};
+
+} // namespace chip
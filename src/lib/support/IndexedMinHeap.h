@@ -0,0 +1,177 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A fixed-capacity binary min-heap over objects owned elsewhere (typically in
+ *      an ObjectPool), used to find the earliest of many deadlines without a scan.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+
+#include <cstddef>
+
+namespace chip {
+
+/**
+ * Orders pointers to objects of type T so that the least object, according to `Less`, is
+ * available in O(1), and objects are inserted, removed or re-keyed in O(log n).
+ *
+ * Each object records its own position in the heap in the member `kPosition`, which makes
+ * removal and re-keying of an arbitrary object possible without a search. The member must be
+ * initialized to 0, which means "not in the heap"; the heap stores the position plus one.
+ *
+ * The heap does not notice when the key of an object changes: Update() must be called after
+ * every such change.
+ *
+ * @tparam T          the type of the ordered objects
+ * @tparam kMaxItems  the maximum number of objects in the heap at once
+ * @tparam Less       a default-constructible strict weak ordering on `const T &`
+ * @tparam kPosition  the member of T in which the heap records the position of the object
+ */
+template <typename T, size_t kMaxItems, typename Less, size_t T::*kPosition>
+class IndexedMinHeap
+{
+public:
+    static_assert(kMaxItems > 0, "IndexedMinHeap needs room for at least one item");
+
+    /**
+     * Add an object to the heap.
+     *
+     * @return false if the object is already in the heap or kMaxItems objects are already in it.
+     */
+    bool Push(T * item)
+    {
+        VerifyOrReturnValue(item != nullptr && !Contains(item) && mSize < kMaxItems, false);
+        Place(mSize++, item);
+        SiftUp(mSize - 1);
+        return true;
+    }
+
+    /**
+     * Remove an object from the heap. Does nothing if the object is not in the heap.
+     */
+    void Remove(T * item)
+    {
+        VerifyOrReturn(Contains(item));
+        size_t i         = item->*kPosition - 1;
+        item->*kPosition = 0;
+        mSize--;
+        if (i == mSize)
+        {
+            return;
+        }
+        Place(i, mItems[mSize]);
+        Restore(i);
+    }
+
+    /**
+     * Restore the position of an object after its key changed. Does nothing if the object is not
+     * in the heap.
+     */
+    void Update(T * item)
+    {
+        VerifyOrReturn(Contains(item));
+        Restore(item->*kPosition - 1);
+    }
+
+    bool Contains(const T * item) const { return item->*kPosition != 0; }
+
+    /// The least object in the heap, or nullptr if the heap is empty.
+    T * Top() const { return mSize > 0 ? mItems[0] : nullptr; }
+
+    /// Remove every object from the heap.
+    void Clear()
+    {
+        for (size_t i = 0; i < mSize; i++)
+        {
+            mItems[i]->*kPosition = 0;
+        }
+        mSize = 0;
+    }
+
+    size_t Size() const { return mSize; }
+    bool IsEmpty() const { return mSize == 0; }
+
+private:
+    static bool IsLess(const T * a, const T * b) { return Less()(*a, *b); }
+
+    void Place(size_t i, T * item)
+    {
+        mItems[i]        = item;
+        item->*kPosition = i + 1;
+    }
+
+    void Restore(size_t i)
+    {
+        if (i > 0 && IsLess(mItems[i], mItems[(i - 1) / 2]))
+        {
+            SiftUp(i);
+        }
+        else
+        {
+            SiftDown(i);
+        }
+    }
+
+    void SiftUp(size_t i)
+    {
+        T * item = mItems[i];
+        while (i > 0)
+        {
+            size_t parent = (i - 1) / 2;
+            if (!IsLess(item, mItems[parent]))
+            {
+                break;
+            }
+            Place(i, mItems[parent]);
+            i = parent;
+        }
+        Place(i, item);
+    }
+
+    void SiftDown(size_t i)
+    {
+        T * item = mItems[i];
+        while (true)
+        {
+            size_t child = 2 * i + 1;
+            if (child >= mSize)
+            {
+                break;
+            }
+            if (child + 1 < mSize && IsLess(mItems[child + 1], mItems[child]))
+            {
+                child++;
+            }
+            if (!IsLess(mItems[child], item))
+            {
+                break;
+            }
+            Place(i, mItems[child]);
+            i = child;
+        }
+        Place(i, item);
+    }
+
+    T * mItems[kMaxItems];
+    size_t mSize = 0;
+};
+
+} // namespace chip
@@ -20,6 +20,8 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/Pool.h>
 
+#include <algorithm>
+
 namespace chip {
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -225,6 +227,154 @@ void HeapObjectList::CleanupDeferredReleases()
     mHaveDeferredNodeRemovals = false;
 }
 
+namespace {
+
+constexpr size_t RoundUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+SlabAllocator::SlabAllocator(size_t elementSize, size_t elementAlignment, size_t elementsPerSlab) :
+    mInfoOffset(RoundUp(elementSize, alignof(ElementInfo))),
+    mElementStride(RoundUp(mInfoOffset + sizeof(ElementInfo), std::max(elementAlignment, alignof(ElementInfo)))),
+    mElementsPerSlab(elementsPerSlab)
+{}
+
+SlabAllocator::~SlabAllocator()
+{
+    // Objects still allocated are leaked on exit (see HeapObjectPoolExitHandling): keep their memory valid.
+    VerifyOrReturn(mAllocated == 0);
+
+    while (mFirstSlab != nullptr)
+    {
+        Slab * next = mFirstSlab->mNext;
+        Platform::MemoryFree(mFirstSlab);
+        mFirstSlab = next;
+    }
+}
+
+bool SlabAllocator::AddSlab()
+{
+    void * memory = Platform::MemoryAlloc(kSlabHeaderSize + mElementsPerSlab * mElementStride);
+    VerifyOrReturnValue(memory != nullptr, false);
+
+    Slab * slab = new (memory) Slab();
+    if (mLastSlab == nullptr)
+    {
+        mFirstSlab = slab;
+    }
+    else
+    {
+        mLastSlab->mNext = slab;
+    }
+    mLastSlab = slab;
+    mSlabCount++;
+
+    // Link the elements in order, so that they are allocated in order.
+    for (size_t i = mElementsPerSlab; i > 0; i--)
+    {
+        uint8_t * element  = ElementAt(slab, i - 1);
+        ElementInfo * info = new (element + mInfoOffset) ElementInfo();
+        info->mState       = ElementInfo::State::kFree;
+        info->mLink        = mFreeList;
+        mFreeList          = element;
+    }
+    return true;
+}
+
+void * SlabAllocator::Allocate()
+{
+    if (mFreeList == nullptr && !AddSlab())
+    {
+        return nullptr;
+    }
+
+    void * element     = mFreeList;
+    ElementInfo * info = InfoOf(element);
+    mFreeList          = info->mLink;
+    info->mState       = ElementInfo::State::kActive;
+    info->mLink        = this;
+    IncreaseUsage();
+    return element;
+}
+
+void SlabAllocator::Deallocate(void * element)
+{
+    ElementInfo * info = InfoOf(element);
+    // Releasing an object that is not allocated from this pool indicates likely memory
+    // corruption; better to safe-crash than proceed at this point.
+    VerifyOrDie(info->mState == ElementInfo::State::kActive && info->mLink == this);
+
+    // Released elements are only reused once no iteration is active, as for HeapObjectPool.
+    if (mIterationDepth == 0)
+    {
+        info->mState = ElementInfo::State::kFree;
+        info->mLink  = mFreeList;
+        mFreeList    = element;
+    }
+    else
+    {
+        info->mState = ElementInfo::State::kReleased;
+        info->mLink  = mReleased;
+        mReleased    = element;
+    }
+    DecreaseUsage();
+}
+
+void SlabAllocator::CleanupDeferredReleases()
+{
+    if (mIterationDepth != 0)
+    {
+        return;
+    }
+    while (mReleased != nullptr)
+    {
+        void * element     = mReleased;
+        ElementInfo * info = InfoOf(element);
+        mReleased          = info->mLink;
+        info->mState       = ElementInfo::State::kFree;
+        info->mLink        = mFreeList;
+        mFreeList          = element;
+    }
+}
+
+void * SlabAllocator::NextActive(Slab *& slab, size_t & index) const
+{
+    for (; slab != nullptr; slab = slab->mNext, index = 0)
+    {
+        for (; index < mElementsPerSlab; index++)
+        {
+            uint8_t * element = ElementAt(slab, index);
+            if (InfoOf(element)->mState == ElementInfo::State::kActive)
+            {
+                return element;
+            }
+        }
+    }
+    return nullptr;
+}
+
+Loop SlabAllocator::ForEachActiveObjectInner(void * context, Lambda lambda)
+{
+    ++mIterationDepth;
+    Loop result  = Loop::Finish;
+    Slab * slab  = mFirstSlab;
+    size_t index = 0;
+    for (void * element = NextActive(slab, index); element != nullptr; element = NextActive(slab, ++index))
+    {
+        if (lambda(context, element) == Loop::Break)
+        {
+            result = Loop::Break;
+            break;
+        }
+    }
+    --mIterationDepth;
+    CleanupDeferredReleases();
+    return result;
+}
+
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace internal
@@ -29,6 +29,7 @@
 
 #include <lib/support/Iterators.h>
 
+#include <algorithm>
 #include <atomic>
 #include <limits>
 #include <new>
@@ -40,6 +41,9 @@ namespace chip {
 template <class T>
 class BitmapActiveObjectIterator;
 
+template <class T>
+class SlabActiveObjectIterator;
+
 namespace internal {
 
 class Statistics
@@ -183,6 +187,88 @@ struct HeapObjectList : HeapObjectListNode
     bool mHaveDeferredNodeRemovals = false;
 };
 
+/**
+ * Allocates elements of a fixed size from heap-allocated slabs of several elements.
+ *
+ * Free elements are linked in an intrusive free list, so that allocation and release take constant
+ * time. Slabs are only returned to the heap when the allocator is destroyed, so elements never move.
+ *
+ * Elements released while an iteration is active are only reused once all iterations are done.
+ */
+class SlabAllocator : public Statistics
+{
+public:
+    struct Slab
+    {
+        Slab * mNext = nullptr;
+    };
+
+    size_t Slabs() const { return mSlabCount; }
+
+    /// Makes the elements released during iteration available again IFF iteration depth is 0
+    void CleanupDeferredReleases();
+
+protected:
+    SlabAllocator(size_t elementSize, size_t elementAlignment, size_t elementsPerSlab);
+    ~SlabAllocator();
+
+    void * Allocate();
+    void Deallocate(void * element);
+
+    /// Returns the first active element at or after position `index` of `slab`, moving `slab` and
+    /// `index` to it. Returns nullptr, with `slab` set to nullptr, if there is none.
+    void * NextActive(Slab *& slab, size_t & index) const;
+
+    using Lambda = Loop (*)(void * context, void * object);
+    Loop ForEachActiveObjectInner(void * context, Lambda lambda);
+    Loop ForEachActiveObjectInner(void * context, Loop lambda(void * context, const void * object)) const
+    {
+        return const_cast<SlabAllocator *>(this)->ForEachActiveObjectInner(context, reinterpret_cast<Lambda>(lambda));
+    }
+
+    Slab * mFirstSlab      = nullptr;
+    size_t mIterationDepth = 0;
+
+    template <class T>
+    friend class ::chip::SlabActiveObjectIterator;
+
+private:
+    // Bookkeeping of an element, stored after it.
+    struct ElementInfo
+    {
+        enum class State : uint8_t
+        {
+            kFree,
+            kActive,
+            kReleased, // Released during iteration, not reusable yet
+        };
+
+        // The allocator of an active element, or the next element in the free or released list.
+        void * mLink;
+        State mState;
+    };
+
+    ElementInfo * InfoOf(void * element) const
+    {
+        return reinterpret_cast<ElementInfo *>(static_cast<uint8_t *>(element) + mInfoOffset);
+    }
+    uint8_t * ElementAt(Slab * slab, size_t index) const
+    {
+        return reinterpret_cast<uint8_t *>(slab) + kSlabHeaderSize + index * mElementStride;
+    }
+    bool AddSlab();
+
+    static constexpr size_t kSlabHeaderSize = (sizeof(Slab) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    const size_t mInfoOffset;
+    const size_t mElementStride;
+    const size_t mElementsPerSlab;
+    Slab * mLastSlab  = nullptr;
+    size_t mSlabCount = 0;
+    void * mFreeList  = nullptr;
+    void * mReleased  = nullptr;
+};
+
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace internal
@@ -605,6 +691,197 @@ private:
     internal::HeapObjectList mObjects;
 };
 
+/// Provides iteration over active objects in a slab pool.
+///
+/// NOTE: As for HeapObjectPool, objects may be released while an iterator is active, and the
+///       iterator may still be advanced. The memory of released objects is only reused once the
+///       last active iterator is destroyed.
+template <class T>
+class SlabActiveObjectIterator
+{
+public:
+    using value_type = T;
+    using pointer    = T *;
+    using reference  = T &;
+
+    /// An iterator at the first active object of the pool, from the start of `slab`.
+    explicit SlabActiveObjectIterator(internal::SlabAllocator * pool, internal::SlabAllocator::Slab * slab) :
+        mPool(pool), mSlab(slab)
+    {
+        mPool->mIterationDepth++;
+        mCurrent = static_cast<T *>(mPool->NextActive(mSlab, mIndex));
+    }
+    SlabActiveObjectIterator() {}
+    SlabActiveObjectIterator(const SlabActiveObjectIterator & other) :
+        mPool(other.mPool), mSlab(other.mSlab), mIndex(other.mIndex), mCurrent(other.mCurrent)
+    {
+        if (mPool != nullptr)
+        {
+            mPool->mIterationDepth++;
+        }
+    }
+
+    SlabActiveObjectIterator & operator=(const SlabActiveObjectIterator & other)
+    {
+        if (other.mPool != nullptr)
+        {
+            other.mPool->mIterationDepth++;
+        }
+        if (mPool != nullptr)
+        {
+            mPool->mIterationDepth--;
+            mPool->CleanupDeferredReleases();
+        }
+        mPool    = other.mPool;
+        mSlab    = other.mSlab;
+        mIndex   = other.mIndex;
+        mCurrent = other.mCurrent;
+        return *this;
+    }
+
+    ~SlabActiveObjectIterator()
+    {
+        if (mPool != nullptr)
+        {
+            mPool->mIterationDepth--;
+            mPool->CleanupDeferredReleases();
+        }
+    }
+
+    bool operator==(const SlabActiveObjectIterator & other) const { return mCurrent == other.mCurrent; }
+    bool operator!=(const SlabActiveObjectIterator & other) const { return !(*this == other); }
+    SlabActiveObjectIterator & operator++()
+    {
+        mIndex++;
+        mCurrent = static_cast<T *>(mPool->NextActive(mSlab, mIndex));
+        return *this;
+    }
+    T * operator*() const { return mCurrent; }
+
+private:
+    internal::SlabAllocator * mPool       = nullptr;
+    internal::SlabAllocator::Slab * mSlab = nullptr;
+    size_t mIndex                         = 0;
+    T * mCurrent                          = nullptr; // nullptr at the end
+};
+
+/**
+ * A class template used for allocating objects from heap-allocated slabs of several objects.
+ *
+ * Creating and releasing an object takes constant time and, once the pool has grown to its high
+ * water mark, no heap allocation. The slabs are kept until the pool is destroyed.
+ *
+ *  @tparam     T   type to be allocated.
+ *  @tparam     N   the pool size of the static allocation case, which bounds the number of objects per slab.
+ */
+template <class T, size_t N>
+class SlabObjectPool : public internal::SlabAllocator, public HeapObjectPoolExitHandling
+{
+public:
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types cannot be allocated from slabs");
+
+    /// As many objects as fit in CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE bytes, at least one and at most N.
+    static constexpr size_t kObjectsPerSlab =
+        std::max<size_t>(1, std::min<size_t>(N, CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE / sizeof(T)));
+
+    SlabObjectPool() : SlabAllocator(sizeof(T), alignof(T), kObjectsPerSlab) {}
+    ~SlabObjectPool()
+    {
+#if __SANITIZE_ADDRESS__
+        // Release all remaining objects so that ASAN reports their slabs as freed.
+        ReleaseAll();
+#else  // __SANITIZE_ADDRESS__
+        if (!sIgnoringLeaksOnExit)
+        {
+            // Verify that no live objects remain, to prevent potential use-after-free.
+            VerifyOrDieWithObject(Allocated() == 0, this);
+        }
+#endif // __SANITIZE_ADDRESS__
+    }
+
+    using ActiveObjectIterator = SlabActiveObjectIterator<T>;
+
+    ActiveObjectIterator begin() { return ActiveObjectIterator(this, mFirstSlab); }
+    ActiveObjectIterator end() { return ActiveObjectIterator(this, nullptr); }
+
+    template <typename... Args>
+    T * CreateObject(Args &&... args)
+    {
+        void * element = Allocate();
+        if (element != nullptr)
+            return new (element) T(std::forward<Args>(args)...);
+        return nullptr;
+    }
+
+    /*
+     * These methods exist purely to line up with the static allocator version, see HeapObjectPool.
+     */
+    size_t Capacity() const { return SIZE_MAX; }
+    bool Exhausted() const { return false; }
+
+    void ReleaseObject(T * object)
+    {
+        if (object == nullptr)
+            return;
+
+        object->~T();
+        Deallocate(object);
+    }
+
+    void ReleaseAll() { ForEachActiveObjectInner(this, ReleaseObject); }
+
+    /**
+     * @brief
+     *   Run a functor for each active object in the pool
+     *
+     *  @param     function A functor of type `Loop (*)(T*)`.
+     *                      Return Loop::Break to break the iteration.
+     *                      The only modification the functor is allowed to make
+     *                      to the pool before returning is releasing the
+     *                      object that was passed to the functor.  Any other
+     *                      desired changes need to be made after iteration
+     *                      completes.
+     *  @return    Loop     Returns Break if some call to the functor returned
+     *                      Break.  Otherwise returns Finish.
+     */
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function)
+    {
+        static_assert(std::is_same<Loop, decltype(function(std::declval<T *>()))>::value,
+                      "The function must take T* and return Loop");
+        internal::LambdaProxy<T, Function> proxy(std::forward<Function>(function));
+        return ForEachActiveObjectInner(&proxy, &internal::LambdaProxy<T, Function>::Call);
+    }
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function) const
+    {
+        static_assert(std::is_same<Loop, decltype(function(std::declval<const T *>()))>::value,
+                      "The function must take const T* and return Loop");
+        internal::LambdaProxy<const T, Function> proxy(std::forward<Function>(function));
+        return ForEachActiveObjectInner(&proxy, &internal::LambdaProxy<const T, Function>::ConstCall);
+    }
+
+    void DumpToLog() const
+    {
+        ChipLogError(Support, "SlabObjectPool: %lu allocated in %lu slabs", static_cast<unsigned long>(Allocated()),
+                     static_cast<unsigned long>(Slabs()));
+        if constexpr (IsDumpable<T>::value)
+        {
+            ForEachActiveObject([](const T * object) {
+                object->DumpToLog();
+                return Loop::Continue;
+            });
+        }
+    }
+
+private:
+    static Loop ReleaseObject(void * context, void * object)
+    {
+        static_cast<SlabObjectPool *>(context)->ReleaseObject(static_cast<T *>(object));
+        return Loop::Continue;
+    }
+};
+
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 /**
@@ -623,7 +900,17 @@ enum class ObjectPoolMem
      * For this case, the ObjectPool size parameter is ignored.
      */
     kHeap,
+    /**
+     * Allocate objects from heap-allocated slabs of several objects, with only pool management state in the containing scope.
+     *
+     * For this case, the ObjectPool size parameter only bounds the number of objects per slab.
+     */
+    kSlab,
+#if CHIP_SYSTEM_CONFIG_POOL_USE_SLAB && !__SANITIZE_ADDRESS__
+    kDefault = kSlab
+#else  // CHIP_SYSTEM_CONFIG_POOL_USE_SLAB && !__SANITIZE_ADDRESS__
     kDefault = kHeap
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_SLAB && !__SANITIZE_ADDRESS__
 #else  // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
     kDefault = kInline
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
@@ -658,6 +945,17 @@ template <typename T, size_t N>
 class ObjectPool<T, N, ObjectPoolMem::kHeap> : public HeapObjectPool<T>
 {
 };
+
+template <typename T>
+struct ObjectPoolIterator<T, ObjectPoolMem::kSlab>
+{
+    using Type = SlabActiveObjectIterator<T>;
+};
+
+template <typename T, size_t N>
+class ObjectPool<T, N, ObjectPoolMem::kSlab> : public SlabObjectPool<T, N>
+{
+};
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 /// RAII class for pool allocation that guarantees that ReleaseObject() will be called.
@@ -52,9 +52,9 @@ public:
     ScopedMemoryBufferBase(const ScopedMemoryBufferBase &)                   = delete;
     ScopedMemoryBufferBase & operator=(const ScopedMemoryBufferBase & other) = delete;
 
-    ScopedMemoryBufferBase(ScopedMemoryBufferBase && other) { *this = std::move(other); }
+    ScopedMemoryBufferBase(ScopedMemoryBufferBase && other) noexcept { *this = std::move(other); }
 
-    ScopedMemoryBufferBase & operator=(ScopedMemoryBufferBase && other)
+    ScopedMemoryBufferBase & operator=(ScopedMemoryBufferBase && other) noexcept
     {
         if (this != &other)
         {
@@ -209,9 +209,9 @@ class ScopedMemoryBufferWithSize : public ScopedMemoryBuffer<T>
 {
 public:
     ScopedMemoryBufferWithSize() {}
-    ScopedMemoryBufferWithSize(ScopedMemoryBufferWithSize && other) { *this = std::move(other); }
+    ScopedMemoryBufferWithSize(ScopedMemoryBufferWithSize && other) noexcept { *this = std::move(other); }
 
-    ScopedMemoryBufferWithSize & operator=(ScopedMemoryBufferWithSize && other)
+    ScopedMemoryBufferWithSize & operator=(ScopedMemoryBufferWithSize && other) noexcept
     {
         if (this != &other)
         {
@@ -145,6 +145,11 @@ private:
     };
     using Curry = VariantInternal::VariantCurry<0, Ts...>;
 
+    // Moves move-construct the alternative and destroy the moved-from one; assignment also destroys the current one.
+    static constexpr bool kNothrowMove =
+        std::conjunction<std::is_nothrow_move_constructible<Ts>..., std::is_nothrow_move_assignable<Ts>...,
+                         std::is_nothrow_destructible<Ts>...>::value;
+
     std::size_t mTypeId;
     Data mData;
 
@@ -160,7 +165,7 @@ public:
 
     Variant(const Variant<Ts...> & that) : mTypeId(that.mTypeId) { Curry::Copy(that.mTypeId, &that.mData, &mData); }
 
-    Variant(Variant<Ts...> && that) : mTypeId(that.mTypeId)
+    Variant(Variant<Ts...> && that) noexcept(kNothrowMove) : mTypeId(that.mTypeId)
     {
         Curry::Move(that.mTypeId, &that.mData, &mData);
         Curry::Destroy(that.mTypeId, &that.mData);
@@ -175,7 +180,7 @@ public:
         return *this;
     }
 
-    Variant<Ts...> & operator=(Variant<Ts...> && that)
+    Variant<Ts...> & operator=(Variant<Ts...> && that) noexcept(kNothrowMove)
     {
         Curry::Destroy(mTypeId, &mData);
         mTypeId = that.mTypeId;
@@ -0,0 +1,189 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the HashIndex class.
+ */
+
+#include <cstdlib>
+#include <ctime>
+#include <set>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/HashIndex.h>
+
+namespace {
+
+using namespace chip;
+
+struct Item
+{
+    uint32_t key;
+};
+
+template <typename Index>
+std::set<Item *> Collect(Index & index, uint32_t key)
+{
+    std::set<Item *> found;
+    index.ForEach(key, [&](Item * item) {
+        if (item->key == key)
+        {
+            found.insert(item);
+        }
+        return Loop::Continue;
+    });
+    return found;
+}
+
+TEST(TestHashIndex, TestCapacity)
+{
+    EXPECT_EQ((HashIndex<Item, 1>::kCapacity), 4u);
+    EXPECT_EQ((HashIndex<Item, 2>::kCapacity), 8u);
+    EXPECT_EQ((HashIndex<Item, 50>::kCapacity), 128u);
+    EXPECT_EQ((HashIndex<Item, 64>::kCapacity), 256u);
+}
+
+TEST(TestHashIndex, TestInsertFindRemove)
+{
+    HashIndex<Item, 8> index;
+    Item items[8];
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        items[i].key = i * 3;
+        EXPECT_TRUE(index.Insert(items[i].key, &items[i]));
+    }
+    EXPECT_EQ(index.Size(), 8u);
+
+    Item extra{ 100 };
+    EXPECT_FALSE(index.Insert(extra.key, &extra));
+
+    for (auto & item : items)
+    {
+        uint32_t key = item.key;
+        EXPECT_EQ(index.Find(key, [key](const Item * candidate) { return candidate->key == key; }), &item);
+    }
+    EXPECT_EQ(index.Find(1, [](const Item * candidate) { return candidate->key == 1; }), nullptr);
+
+    EXPECT_TRUE(index.Remove(items[3].key, &items[3]));
+    EXPECT_FALSE(index.Remove(items[3].key, &items[3]));
+    EXPECT_EQ(index.Size(), 7u);
+    EXPECT_EQ(index.Find(items[3].key, [](const Item *) { return true; }), nullptr);
+
+    index.Clear();
+    EXPECT_EQ(index.Size(), 0u);
+    EXPECT_EQ(index.Find(items[0].key, [](const Item *) { return true; }), nullptr);
+}
+
+TEST(TestHashIndex, TestSameHash)
+{
+    // Several items under the same hash (as with several sessions to the same peer).
+    HashIndex<Item, 16> index;
+    Item items[6] = { { 7 }, { 7 }, { 7 }, { 9 }, { 9 }, { 11 } };
+    for (auto & item : items)
+    {
+        EXPECT_TRUE(index.Insert(item.key, &item));
+    }
+
+    EXPECT_EQ(Collect(index, 7), (std::set<Item *>{ &items[0], &items[1], &items[2] }));
+    EXPECT_EQ(Collect(index, 9), (std::set<Item *>{ &items[3], &items[4] }));
+
+    EXPECT_TRUE(index.Remove(7, &items[1]));
+    EXPECT_EQ(Collect(index, 7), (std::set<Item *>{ &items[0], &items[2] }));
+
+    size_t visited = 0;
+    EXPECT_EQ(index.ForEach(7,
+                            [&](Item *) {
+                                visited++;
+                                return Loop::Break;
+                            }),
+              Loop::Break);
+    EXPECT_EQ(visited, 1u);
+}
+
+TEST(TestHashIndex, TestRemoveWhileIterating)
+{
+    HashIndex<Item, 16> index;
+    Item items[8];
+    for (auto & item : items)
+    {
+        item.key = 5;
+        EXPECT_TRUE(index.Insert(item.key, &item));
+    }
+    Item other{ 6 };
+    EXPECT_TRUE(index.Insert(other.key, &other));
+
+    // Removing the visited item (and others) from within the callback must neither skip nor repeat items.
+    std::set<Item *> visited;
+    index.ForEach(5, [&](Item * item) {
+        EXPECT_TRUE(visited.insert(item).second);
+        EXPECT_TRUE(index.Remove(5, item));
+        if (item != &items[7])
+        {
+            index.Remove(5, &items[7]);
+        }
+        return Loop::Continue;
+    });
+    EXPECT_LE(visited.size(), 8u);
+    EXPECT_EQ(index.Size(), 1u);
+    EXPECT_TRUE(Collect(index, 5).empty());
+    EXPECT_EQ(Collect(index, 6), (std::set<Item *>{ &other }));
+}
+
+TEST(TestHashIndex, TestRandomOperations)
+{
+    unsigned seed = static_cast<unsigned>(std::time(nullptr));
+    printf("Running " __FILE__ " using seed %d \n", seed);
+    std::srand(seed);
+
+    constexpr size_t kItems = 40;
+    HashIndex<Item, kItems> index;
+    Item items[kItems];
+    bool indexed[kItems] = {};
+
+    for (int op = 0; op < 10000; op++)
+    {
+        size_t i = static_cast<size_t>(std::rand()) % kItems;
+        if (indexed[i])
+        {
+            EXPECT_TRUE(index.Remove(items[i].key, &items[i]));
+            indexed[i] = false;
+        }
+        else
+        {
+            // A small key space forces both shared hashes and long probe runs.
+            items[i].key = static_cast<uint32_t>(std::rand() % 16);
+            EXPECT_TRUE(index.Insert(items[i].key, &items[i]));
+            indexed[i] = true;
+        }
+
+        uint32_t key = static_cast<uint32_t>(std::rand() % 16);
+        std::set<Item *> expected;
+        for (size_t j = 0; j < kItems; j++)
+        {
+            if (indexed[j] && items[j].key == key)
+            {
+                expected.insert(&items[j]);
+            }
+        }
+        ASSERT_EQ(Collect(index, key), expected);
+    }
+}
+
+} // namespace
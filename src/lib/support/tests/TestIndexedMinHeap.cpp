@@ -0,0 +1,227 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the IndexedMinHeap class.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/IndexedMinHeap.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace {
+
+using namespace chip;
+
+struct Item
+{
+    uint32_t deadline = 0;
+    size_t position   = 0;
+};
+
+struct ItemLess
+{
+    bool operator()(const Item & a, const Item & b) const { return a.deadline < b.deadline; }
+};
+
+template <size_t kMaxItems>
+using ItemHeap = IndexedMinHeap<Item, kMaxItems, ItemLess, &Item::position>;
+
+template <size_t kItems>
+Item * LinearMin(Item (&items)[kItems], bool (&present)[kItems])
+{
+    Item * min = nullptr;
+    for (size_t i = 0; i < kItems; i++)
+    {
+        if (present[i] && (min == nullptr || items[i].deadline < min->deadline))
+        {
+            min = &items[i];
+        }
+    }
+    return min;
+}
+
+TEST(TestIndexedMinHeap, TestPushPopOrder)
+{
+    ItemHeap<8> heap;
+    Item items[8];
+    const uint32_t deadlines[8] = { 50, 10, 80, 30, 30, 70, 20, 60 };
+    for (size_t i = 0; i < 8; i++)
+    {
+        items[i].deadline = deadlines[i];
+        EXPECT_TRUE(heap.Push(&items[i]));
+        EXPECT_TRUE(heap.Contains(&items[i]));
+    }
+    EXPECT_EQ(heap.Size(), 8u);
+
+    Item extra;
+    EXPECT_FALSE(heap.Push(&extra));
+    EXPECT_FALSE(heap.Contains(&extra));
+    EXPECT_FALSE(heap.Push(&items[0]));
+
+    uint32_t previous = 0;
+    while (!heap.IsEmpty())
+    {
+        Item * top = heap.Top();
+        EXPECT_GE(top->deadline, previous);
+        previous = top->deadline;
+        heap.Remove(top);
+        EXPECT_FALSE(heap.Contains(top));
+        EXPECT_EQ(top->position, 0u);
+    }
+    EXPECT_EQ(previous, 80u);
+    EXPECT_EQ(heap.Top(), nullptr);
+}
+
+TEST(TestIndexedMinHeap, TestRemoveAndUpdate)
+{
+    ItemHeap<8> heap;
+    Item items[6];
+    for (uint32_t i = 0; i < 6; i++)
+    {
+        items[i].deadline = (i + 1) * 10;
+        EXPECT_TRUE(heap.Push(&items[i]));
+    }
+    EXPECT_EQ(heap.Top(), &items[0]);
+
+    // Removing an object that is not at the top, or not in the heap at all.
+    heap.Remove(&items[3]);
+    heap.Remove(&items[3]);
+    EXPECT_EQ(heap.Size(), 5u);
+
+    // Moving the top down and another object up.
+    items[0].deadline = 100;
+    heap.Update(&items[0]);
+    EXPECT_EQ(heap.Top(), &items[1]);
+    items[5].deadline = 5;
+    heap.Update(&items[5]);
+    EXPECT_EQ(heap.Top(), &items[5]);
+
+    // Updating an object that is not in the heap does nothing.
+    items[3].deadline = 1;
+    heap.Update(&items[3]);
+    EXPECT_EQ(heap.Top(), &items[5]);
+
+    heap.Clear();
+    EXPECT_TRUE(heap.IsEmpty());
+    for (auto & item : items)
+    {
+        EXPECT_FALSE(heap.Contains(&item));
+    }
+}
+
+TEST(TestIndexedMinHeap, TestRandomOperations)
+{
+    unsigned seed = static_cast<unsigned>(std::time(nullptr));
+    printf("Running " __FILE__ " using seed %d \n", seed);
+    std::srand(seed);
+
+    constexpr size_t kItems = 40;
+    ItemHeap<kItems> heap;
+    Item items[kItems];
+    bool present[kItems] = {};
+
+    for (int op = 0; op < 10000; op++)
+    {
+        size_t i = static_cast<size_t>(std::rand()) % kItems;
+        switch (std::rand() % 3)
+        {
+        case 0:
+            heap.Remove(&items[i]);
+            present[i] = false;
+            break;
+        case 1:
+            items[i].deadline = static_cast<uint32_t>(std::rand() % 100);
+            if (present[i])
+            {
+                heap.Update(&items[i]);
+            }
+            else
+            {
+                EXPECT_TRUE(heap.Push(&items[i]));
+                present[i] = true;
+            }
+            break;
+        default:
+            if (Item * top = heap.Top())
+            {
+                heap.Remove(top);
+                present[top - items] = false;
+            }
+            break;
+        }
+
+        Item * expected = LinearMin(items, present);
+        Item * top      = heap.Top();
+        ASSERT_EQ(top == nullptr, expected == nullptr);
+        if (top != nullptr)
+        {
+            // Ties may be broken differently.
+            ASSERT_EQ(top->deadline, expected->deadline);
+        }
+    }
+}
+
+TEST(TestIndexedMinHeap, TestPerformance)
+{
+    // Models a timer with 1000 pending deadlines (such as retransmissions): each tick finds the
+    // earliest deadline and reschedules it, either with the heap or by scanning all items.
+    constexpr size_t kItems = 1000;
+    constexpr int kTicks    = 100000;
+
+    static Item heapItems[kItems];
+    static Item scanItems[kItems];
+    static bool present[kItems];
+    ItemHeap<kItems> heap;
+    for (size_t i = 0; i < kItems; i++)
+    {
+        heapItems[i].deadline = scanItems[i].deadline = static_cast<uint32_t>((i * 7919) % kItems);
+        present[i]                                    = true;
+        EXPECT_TRUE(heap.Push(&heapItems[i]));
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < kTicks; tick++)
+    {
+        Item * top = heap.Top();
+        top->deadline += static_cast<uint32_t>(kItems + (tick % 17));
+        heap.Update(top);
+    }
+    auto heapTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < kTicks; tick++)
+    {
+        Item * top = LinearMin(scanItems, present);
+        top->deadline += static_cast<uint32_t>(kItems + (tick % 17));
+    }
+    auto scanTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    // Both must have followed the same schedule.
+    EXPECT_EQ(heap.Top()->deadline, LinearMin(scanItems, present)->deadline);
+    ChipLogProgress(Test, "Tick with %u deadlines: heap %u ns, scan %u ns", static_cast<unsigned>(kItems),
+                    static_cast<unsigned>(heapTime.count() / kTicks), static_cast<unsigned>(scanTime.count() / kTicks));
+}
+
+} // namespace
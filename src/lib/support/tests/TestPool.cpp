@@ -23,6 +23,8 @@
  *
  */
 
+#include <chrono>
+#include <random>
 #include <set>
 
 #include <pw_unit_test/framework.h>
@@ -77,6 +79,11 @@ TEST_F(TestPool, TestReleaseNullDynamic)
 {
     TestReleaseNull<uint32_t, 10, ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestReleaseNullSlab)
+{
+    TestReleaseNull<uint32_t, 10, ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <typename T, size_t N, ObjectPoolMem P>
@@ -153,6 +160,11 @@ TEST_F(TestPool, TestCreateReleaseObjectDynamic)
 {
     TestCreateReleaseObject<uint32_t, 100, ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestCreateReleaseObjectSlab)
+{
+    TestCreateReleaseObject<uint32_t, 100, ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <ObjectPoolMem P>
@@ -216,6 +228,11 @@ TEST_F(TestPool, TestCreateReleaseStructDynamic)
 {
     TestCreateReleaseStruct<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestCreateReleaseStructSlab)
+{
+    TestCreateReleaseStruct<ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <ObjectPoolMem P>
@@ -481,6 +498,11 @@ TEST_F(TestPool, TestForEachActiveObjectDynamic)
 {
     TestForEachActiveObject<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestForEachActiveObjectSlab)
+{
+    TestForEachActiveObject<ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <ObjectPoolMem P>
@@ -544,6 +566,11 @@ TEST_F(TestPool, TestPoolInterfaceDynamic)
 {
     TestPoolInterface<ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestPoolInterfaceSlab)
+{
+    TestPoolInterface<ObjectPoolMem::kSlab>();
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 template <typename T, size_t N, ObjectPoolMem P>
@@ -587,6 +614,118 @@ TEST_F(TestPool, TestPoolAutoReleaseDynamic)
 {
     TestPoolAutoRelease<uint32_t, 100, ObjectPoolMem::kHeap>();
 }
+
+TEST_F(TestPool, TestPoolAutoReleaseSlab)
+{
+    TestPoolAutoRelease<uint32_t, 100, ObjectPoolMem::kSlab>();
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+TEST_F(TestPool, TestSlabReuse)
+{
+    constexpr size_t kSize    = 8;
+    constexpr size_t kObjects = 20;
+    using PoolType            = ObjectPool<uint64_t, kSize, ObjectPoolMem::kSlab>;
+    static_assert(PoolType::kObjectsPerSlab == kSize, "Slabs should hold the pool size");
+
+    PoolType pool;
+    uint64_t * objs[kObjects];
+    for (size_t i = 0; i < kObjects; ++i)
+    {
+        objs[i] = pool.CreateObject(i);
+        ASSERT_NE(objs[i], nullptr);
+    }
+    EXPECT_EQ(pool.Slabs(), (kObjects + kSize - 1) / kSize);
+    EXPECT_EQ(std::set<uint64_t *>(objs, objs + kObjects).size(), kObjects);
+
+    // Objects do not move as the pool grows.
+    for (size_t i = 0; i < kObjects; ++i)
+    {
+        EXPECT_EQ(*objs[i], i);
+    }
+
+    // Released memory is reused right away...
+    uint64_t * released = objs[5];
+    pool.ReleaseObject(released);
+    objs[5] = pool.CreateObject(5u);
+    EXPECT_EQ(objs[5], released);
+
+    // ... but not while iterating.
+    uint64_t * created = nullptr;
+    pool.ForEachActiveObject([&](uint64_t * object) {
+        if (object == objs[7])
+        {
+            pool.ReleaseObject(object);
+            created = pool.CreateObject(7u);
+        }
+        return Loop::Continue;
+    });
+    ASSERT_NE(created, nullptr);
+    EXPECT_NE(created, objs[7]);
+    EXPECT_EQ(pool.CreateObject(0u), objs[7]);
+    objs[7] = created;
+    EXPECT_EQ(GetNumObjectsInUse(pool), kObjects + 1);
+
+    // Slabs are kept until the pool is destroyed.
+    pool.ReleaseAll();
+    EXPECT_EQ(pool.Allocated(), 0u);
+    for (size_t i = 0; i < kObjects; ++i)
+    {
+        ASSERT_NE(pool.CreateObject(i), nullptr);
+    }
+    EXPECT_EQ(pool.Slabs(), (kObjects + kSize - 1) / kSize);
+    pool.ReleaseAll();
+}
+
+// An object the size of a typical exchange or session.
+struct BenchmarkObject
+{
+    BenchmarkObject(size_t id) : mId(id) {}
+    size_t mId;
+    uint8_t mPayload[248];
+};
+
+// Times creating and releasing objects the way exchanges are: `live` objects are active, and one of
+// them, in no particular order, is released for every one created.
+template <ObjectPoolMem P>
+uint64_t MeasureCreateReleaseNs(size_t live, size_t iterations)
+{
+    ObjectPool<BenchmarkObject, 64, P> pool;
+    BenchmarkObject * objects[64];
+    VerifyOrDie(live <= MATTER_ARRAY_SIZE(objects));
+
+    for (size_t i = 0; i < live; ++i)
+    {
+        objects[i] = pool.CreateObject(i);
+    }
+
+    std::minstd_rand random(42);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        size_t slot = random() % live;
+        pool.ReleaseObject(objects[slot]);
+        objects[slot] = pool.CreateObject(i);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    pool.ReleaseAll();
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) / iterations;
+}
+
+TEST_F(TestPool, TestAllocatorBenchmark)
+{
+    constexpr size_t kIterations = 200000;
+
+    for (size_t live : { 1u, 16u, 64u })
+    {
+        uint64_t heapNs = MeasureCreateReleaseNs<ObjectPoolMem::kHeap>(live, kIterations);
+        uint64_t slabNs = MeasureCreateReleaseNs<ObjectPoolMem::kSlab>(live, kIterations);
+        printf("Pool benchmark: %u live objects: heap %u ns, slab %u ns per create/release\n", static_cast<unsigned>(live),
+               static_cast<unsigned>(heapNs), static_cast<unsigned>(slabNs));
+    }
+}
 #endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
 } // namespace
@@ -17,6 +17,7 @@
  */
 
 #include <functional>
+#include <type_traits>
 
 #include <pw_unit_test/framework.h>
 
@@ -210,6 +211,15 @@ TEST(TestVariant, TestVariantMoveAssign)
     EXPECT_EQ(v2.Get<Pod>().m2, 10);
 }
 
+TEST(TestVariant, TestVariantNoexceptMove)
+{
+    // Moves are noexcept only if moving every alternative is.
+    EXPECT_TRUE((std::is_nothrow_move_constructible<Variant<Simple, Movable>>::value));
+    EXPECT_TRUE((std::is_nothrow_move_assignable<Variant<Simple, Movable>>::value));
+    EXPECT_FALSE((std::is_nothrow_move_constructible<Variant<Simple, Count>>::value));
+    EXPECT_FALSE((std::is_nothrow_move_assignable<Variant<Simple, Count>>::value));
+}
+
 TEST(TestVariant, TestVariantInPlace)
 {
     int i = 0;
@@ -77,6 +77,9 @@ void ReliableMessageMgr::Shutdown()
     StopTimer();
 
     // Clear the retransmit table
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+    mRetransHeap.Clear();
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         mRetransTable.ReleaseObject(entry);
         return Loop::Continue;
@@ -163,75 +166,93 @@ void ReliableMessageMgr::ExecuteActions()
     });
 
     // Retransmit / cancel anything in the retrans table whose retrans timeout has expired
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+    // Handling an entry either releases it or schedules it again. As with the scan below, each entry is handled at most once:
+    // entries scheduled from here on sort after the ones that were already due, so reaching one ends the loop.
+    const uint32_t firstNewSequence = mNextScheduleSequence;
+    for (RetransTableEntry * entry = mRetransHeap.Top(); entry != nullptr && entry->nextRetransTime <= now &&
+         static_cast<int32_t>(entry->scheduleSequence - firstNewSequence) < 0;
+         entry = mRetransHeap.Top())
+    {
+        HandleRetransTimeout(entry);
+    }
+#else
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->nextRetransTime > now)
             return Loop::Continue;
 
-        VerifyOrDie(!entry->retainedBuf.IsNull());
+        HandleRetransTimeout(entry);
+        return Loop::Continue;
+    });
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
+
+    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
+}
+
+void ReliableMessageMgr::HandleRetransTimeout(RetransTableEntry * entry)
+{
+    VerifyOrDie(!entry->retainedBuf.IsNull());
 
-        // Don't check whether the session in the exchange is valid, because when the session is released, the retrans entry is
-        // cleared inside ExchangeContext::OnSessionReleased, so the session must be valid if the entry exists.
-        auto session      = entry->ec->GetSessionHandle();
-        uint8_t sendCount = entry->sendCount;
+    // Don't check whether the session in the exchange is valid, because when the session is released, the retrans entry is
+    // cleared inside ExchangeContext::OnSessionReleased, so the session must be valid if the entry exists.
+    auto session      = entry->ec->GetSessionHandle();
+    uint8_t sendCount = entry->sendCount;
 #if CHIP_ERROR_LOGGING || CHIP_PROGRESS_LOGGING
-        uint32_t messageCounter = entry->retainedBuf.GetMessageCounter();
-        auto fabricIndex        = session->GetFabricIndex();
-        auto destination        = kUndefinedNodeId;
-        if (session->IsSecureSession())
-        {
-            destination = session->AsSecureSession()->GetPeerNodeId();
-        }
+    uint32_t messageCounter = entry->retainedBuf.GetMessageCounter();
+    auto fabricIndex        = session->GetFabricIndex();
+    auto destination        = kUndefinedNodeId;
+    if (session->IsSecureSession())
+    {
+        destination = session->AsSecureSession()->GetPeerNodeId();
+    }
 #endif // CHIP_ERROR_LOGGING || CHIP_DETAIL_LOGGING
 
-        if (sendCount == CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS)
-        {
-            // Make sure our exchange stays alive until we are done working with it.
-            ExchangeHandle ec(entry->ec);
+    if (sendCount == CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS)
+    {
+        // Make sure our exchange stays alive until we are done working with it.
+        ExchangeHandle ec(entry->ec);
 
-            ChipLogError(ExchangeManager,
-                         "<<%d [E:" ChipLogFormatExchange " S:%u M:" ChipLogFormatMessageCounter
-                         "] (%s) Msg Retransmission to %u:" ChipLogFormatX64 " failure (max retries:%d)",
-                         sendCount + 1, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
-                         Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination),
-                         CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS);
+        ChipLogError(ExchangeManager,
+                     "<<%d [E:" ChipLogFormatExchange " S:%u M:" ChipLogFormatMessageCounter
+                     "] (%s) Msg Retransmission to %u:" ChipLogFormatX64 " failure (max retries:%d)",
+                     sendCount + 1, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
+                     Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination),
+                     CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS);
 
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
-            NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kFailed);
+        NotifyMessageSendAnalytics(*entry, session, ReliableMessageAnalyticsDelegate::EventType::kFailed);
 #endif // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
 
-            // If the exchange is expecting a response, it will handle sending
-            // this notification once it detects that it has not gotten a
-            // response.  Otherwise, we need to do it.
-            if (!ec->IsResponseExpected())
+        // If the exchange is expecting a response, it will handle sending
+        // this notification once it detects that it has not gotten a
+        // response.  Otherwise, we need to do it.
+        if (!ec->IsResponseExpected())
+        {
+            if (session->IsSecureSession() && session->AsSecureSession()->IsCASESession())
             {
-                if (session->IsSecureSession() && session->AsSecureSession()->IsCASESession())
-                {
-                    session->AsSecureSession()->MarkAsDefunct();
-                }
-                session->NotifySessionHang();
+                session->AsSecureSession()->MarkAsDefunct();
             }
-
-            // Do not StartTimer, we will schedule the timer at the end of the timer handler.
-            mRetransTable.ReleaseObject(entry);
-
-            return Loop::Continue;
+            session->NotifySessionHang();
         }
 
-        entry->sendCount++;
-
-        ChipLogProgress(ExchangeManager,
-                        "<<%d [E:" ChipLogFormatExchange " S:%u M:" ChipLogFormatMessageCounter
-                        "] (%s) Msg Retransmission to %u:" ChipLogFormatX64,
-                        entry->sendCount, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
-                        Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination));
-        MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
+        // Do not StartTimer, we will schedule the timer at the end of the timer handler.
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+        mRetransHeap.Remove(entry);
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
+        mRetransTable.ReleaseObject(entry);
+        return;
+    }
 
-        TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
+    entry->sendCount++;
 
-        return Loop::Continue;
-    });
+    ChipLogProgress(ExchangeManager,
+                    "<<%d [E:" ChipLogFormatExchange " S:%u M:" ChipLogFormatMessageCounter
+                    "] (%s) Msg Retransmission to %u:" ChipLogFormatX64,
+                    entry->sendCount, ChipLogValueExchange(&entry->ec.Get()), session->SessionIdForLogging(), messageCounter,
+                    Transport::GetSessionTypeString(session), fabricIndex, ChipLogValueX64(destination));
+    MATTER_LOG_METRIC(Tracing::kMetricDeviceRMPRetryCount, entry->sendCount);
 
-    TicklessDebugDumpRetransTable("ReliableMessageMgr::ExecuteActions Dumping mRetransTable entries after processing");
+    TEMPORARY_RETURN_IGNORED SendFromRetransTable(entry);
 }
 
 void ReliableMessageMgr::Timeout(System::Layer * aSystemLayer, void * aAppState)
@@ -437,6 +458,9 @@ void ReliableMessageMgr::ClearRetransTable(ReliableMessageContext * rc)
 
 void ReliableMessageMgr::ClearRetransTable(RetransTableEntry & entry)
 {
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+    mRetransHeap.Remove(&entry);
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
     mRetransTable.ReleaseObject(&entry);
     // Expire any virtual ticks that have expired so all wakeup sources reflect the current time
     StartTimer();
@@ -455,6 +479,13 @@ void ReliableMessageMgr::StartTimer()
     });
 
     // When do we need to next wake up for ReliableMessageProtocol retransmit?
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+    const RetransTableEntry * nextRetrans = mRetransHeap.Top();
+    if (nextRetrans != nullptr && nextRetrans->nextRetransTime < nextWakeTime)
+    {
+        nextWakeTime = nextRetrans->nextRetransTime;
+    }
+#else
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->nextRetransTime < nextWakeTime)
         {
@@ -462,6 +493,7 @@ void ReliableMessageMgr::StartTimer()
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
 
     StopTimer();
 
@@ -568,6 +600,19 @@ void ReliableMessageMgr::CalculateNextRetransTime(RetransTableEntry & entry)
     System::Clock::Timeout backoff = ReliableMessageMgr::GetBackoff(baseTimeout, entry.sendCount);
     entry.nextRetransTime          = System::SystemClock().GetMonotonicTimestamp() + backoff;
 
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+    entry.scheduleSequence = mNextScheduleSequence++;
+    if (mRetransHeap.Contains(&entry))
+    {
+        mRetransHeap.Update(&entry);
+    }
+    else
+    {
+        // Cannot fail: the heap has room for every entry of the table.
+        mRetransHeap.Push(&entry);
+    }
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
+
 #if CHIP_PROGRESS_LOGGING
     const auto config       = sessionHandle->GetRemoteMRPConfig();
     uint32_t messageCounter = entry.retainedBuf.GetMessageCounter();
@@ -29,6 +29,7 @@
 #include <lib/core/CHIPError.h>
 #include <lib/core/Optional.h>
 #include <lib/support/BitFlags.h>
+#include <lib/support/IndexedMinHeap.h>
 #include <lib/support/Pool.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/ReliableMessageAnalyticsDelegate.h>
@@ -70,6 +71,10 @@ public:
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
         System::Clock::Timestamp initialSentTime; /**< Timestamp when the initial message was sent */
 #endif                                            // CHIP_CONFIG_MRP_ANALYTICS_ENABLED
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+        size_t heapPosition       = 0; /**< Position in the retransmission heap, 0 if not scheduled yet. */
+        uint32_t scheduleSequence = 0; /**< Orders entries scheduled for the same nextRetransTime. */
+#endif                                 // CHIP_CONFIG_RMP_RETRANS_HEAP
     };
 
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
@@ -243,6 +248,13 @@ private:
      */
     void CalculateNextRetransTime(RetransTableEntry & entry);
 
+    /**
+     * Retransmit an entry whose retransmission time has come, or give up on it if it was
+     * already sent the maximum number of times. Either way, the entry is rescheduled or
+     * released.
+     */
+    void HandleRetransTimeout(RetransTableEntry * entry);
+
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & mContextPool;
     chip::System::Layer * mSystemLayer;
 
@@ -266,6 +278,25 @@ private:
     // ReliableMessageProtocol Global tables for timer context
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
+#if CHIP_CONFIG_RMP_RETRANS_HEAP
+    struct RetransTimeLess
+    {
+        bool operator()(const RetransTableEntry & a, const RetransTableEntry & b) const
+        {
+            if (a.nextRetransTime != b.nextRetransTime)
+            {
+                return a.nextRetransTime < b.nextRetransTime;
+            }
+            return static_cast<int32_t>(a.scheduleSequence - b.scheduleSequence) < 0;
+        }
+    };
+
+    // The scheduled entries of mRetransTable, earliest nextRetransTime first.
+    IndexedMinHeap<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE, RetransTimeLess, &RetransTableEntry::heapPosition>
+        mRetransHeap;
+    uint32_t mNextScheduleSequence = 0;
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
+
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
 #if CHIP_CONFIG_MRP_ANALYTICS_ENABLED
     ReliableMessageAnalyticsDelegate * mAnalyticsDelegate = nullptr;
@@ -149,6 +149,21 @@ namespace chip {
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 #endif // CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE
 
+/**
+ *  @def CHIP_CONFIG_RMP_RETRANS_HEAP
+ *
+ *  @brief
+ *    Keep the ReliableMessageProtocol retransmission table entries in a min-heap
+ *    ordered by their next retransmission time, so that finding the next due entry
+ *    does not scan the whole table on every timer event.
+ *
+ *  This costs two words per retransmission table entry, and pays off with large
+ *  tables (e.g. controllers with many exchanges to sleepy devices in flight).
+ */
+#ifndef CHIP_CONFIG_RMP_RETRANS_HEAP
+#define CHIP_CONFIG_RMP_RETRANS_HEAP 0
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
+
 /**
  *  @def CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS
  *
@@ -35,6 +35,7 @@
 #include <messaging/Flags.h>
 #include <messaging/tests/MessagingContext.h>
 #include <protocols/Protocols.h>
+#include <system/SystemClock.h>
 #include <transport/SessionManager.h>
 #include <transport/TransportMgr.h>
 
@@ -352,4 +353,69 @@ TEST_F(TestExchangeMgr, CheckUmhEncryptionMismatchCleanup)
     }
 }
 
+class EchoResponder : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        return ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST2, std::move(buffer));
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+};
+
+class EchoRequester : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        mResponses++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    uint32_t mResponses = 0;
+};
+
+// Reliable request/response round trips over the loopback transport. Each one creates and releases
+// exchanges, retransmission table entries and packet buffers, so this shows what the object pools
+// cost per message.
+TEST_F(TestExchangeMgr, BenchmarkExchangeRoundTrips)
+{
+    constexpr uint32_t kRoundTrips = 2000;
+
+    EchoResponder responder;
+    ASSERT_EQ(GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1, &responder),
+              CHIP_NO_ERROR);
+
+    EchoRequester requester;
+    uint64_t startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+    for (uint32_t i = 0; i < kRoundTrips; i++)
+    {
+        ExchangeContext * ec = NewExchangeToBob(&requester);
+        ASSERT_NE(ec, nullptr);
+        ASSERT_EQ(ec->SendMessage(Protocols::BDX::Id, kMsgType_TEST1, System::PacketBufferHandle::New(64),
+                                  SendFlags(SendMessageFlags::kExpectResponse)),
+                  CHIP_NO_ERROR);
+        DrainAndServiceIO();
+    }
+    uint64_t elapsedUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+
+    EXPECT_EQ(requester.mResponses, kRoundTrips);
+    EXPECT_EQ(GetExchangeManager().GetNumActiveExchanges(), 0u);
+    ChipLogProgress(Test, "Exchange benchmark: %u round trips, %u ns/round trip", static_cast<unsigned>(kRoundTrips),
+                    static_cast<unsigned>(elapsedUs * 1000 / kRoundTrips));
+
+    EXPECT_EQ(GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Protocols::BDX::Id, kMsgType_TEST1), CHIP_NO_ERROR);
+}
+
 } // namespace
@@ -89,4 +89,9 @@ extern "C" int __cxa_atexit(void (*f)(void *), void * p, void * d);
 // so we need to make sure the pool is big enough for that.
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE 1000
 
+// With that many sessions, avoid scanning the session table for every received message.
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX 1
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
 #define INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT 0
@@ -69,6 +69,28 @@
 #define CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS 1
 #endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
 
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+ *
+ * When enabled, KeyValueStoreManagerImpl stores its entries in an append-only
+ * journal (ChipLinuxStorageJournal) at CHIP_CONFIG_KVS_PATH ".journal" instead of
+ * rewriting the INI file at CHIP_CONFIG_KVS_PATH on every update. An existing INI
+ * file is migrated into the journal the first time it is opened.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL 0
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+
+/**
+ * CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD
+ *
+ * The journal is compacted once it is larger than this many bytes and more
+ * than half of it is made of superseded records.
+ */
+#ifndef CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD
+#define CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD (64 * 1024)
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD
+
 #define CHIP_DEVICE_CONFIG_ENABLE_WIFI_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY 0
 #define CHIP_DEVICE_CONFIG_ENABLE_THREAD_TELEMETRY_FULL 0
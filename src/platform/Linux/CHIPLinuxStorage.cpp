@@ -329,6 +329,19 @@ bool ChipLinuxStorage::HasValue(const char * key)
     return retval;
 }
 
+CHIP_ERROR ChipLinuxStorage::GetKeys(std::vector<std::string> & keys)
+{
+    CHIP_ERROR retval = CHIP_NO_ERROR;
+
+    mLock.lock();
+
+    retval = ChipLinuxStorageIni::GetKeys(keys);
+
+    mLock.unlock();
+
+    return retval;
+}
+
 CHIP_ERROR ChipLinuxStorage::Commit()
 {
     CHIP_ERROR retval = CHIP_NO_ERROR;
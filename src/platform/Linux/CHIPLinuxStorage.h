@@ -36,6 +36,7 @@
 #include <mutex>
 #include <platform/Linux/CHIPLinuxStorageIni.h>
 #include <string>
+#include <vector>
 
 #ifndef FATCONFDIR
 #define FATCONFDIR "/tmp"
@@ -94,6 +95,7 @@ public:
     CHIP_ERROR ClearAll();
     CHIP_ERROR Commit();
     bool HasValue(const char * key);
+    CHIP_ERROR GetKeys(std::vector<std::string> & keys);
 
 private:
     std::mutex mLock;
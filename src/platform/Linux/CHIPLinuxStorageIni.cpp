@@ -338,6 +338,31 @@ bool ChipLinuxStorageIni::HasValue(const char * key)
     return it != section.end();
 }
 
+CHIP_ERROR ChipLinuxStorageIni::GetKeys(std::vector<std::string> & keys)
+{
+    std::map<std::string, std::string> section;
+
+    keys.clear();
+    if (GetDefaultSection(section) != CHIP_NO_ERROR)
+    {
+        // No section means no entries.
+        return CHIP_NO_ERROR;
+    }
+
+    for (const auto & entry : section)
+    {
+        std::string key = UnescapeKey(entry.first);
+        if (key.empty())
+        {
+            ChipLogError(DeviceLayer, "Skipping invalid escaped key: %s", entry.first.c_str());
+            continue;
+        }
+        keys.push_back(std::move(key));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ChipLinuxStorageIni::AddEntry(const char * key, const char * value)
 {
     CHIP_ERROR retval = CHIP_NO_ERROR;
@@ -0,0 +1,541 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file implements a journaled key-value store for Linux.
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+#include <platform/internal/CHIPDeviceLayerInternal.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+constexpr char kJournalMagic[]       = { 'C', 'H', 'I', 'P', 'K', 'V', 'J' };
+constexpr uint8_t kJournalVersion    = 1;
+constexpr size_t kJournalHeaderSize  = sizeof(kJournalMagic) + 1;
+constexpr size_t kRecordPrefixSize   = 1 + 2 + 4; // type, key length, value length
+constexpr size_t kRecordChecksumSize = 4;
+constexpr size_t kRecordOverhead     = kRecordPrefixSize + kRecordChecksumSize;
+
+uint32_t Crc32(const uint8_t * data, size_t len)
+{
+    static const auto sTable = [] {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t c = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+            }
+            table[i] = c;
+        }
+        return table;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc = sTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void AppendHeader(std::string & out)
+{
+    out.append(kJournalMagic, sizeof(kJournalMagic));
+    out.push_back(static_cast<char>(kJournalVersion));
+}
+
+void AppendRecordBytes(std::string & out, uint8_t type, const std::string & key, const void * data, size_t dataLen)
+{
+    const size_t start = out.size();
+    uint8_t prefix[kRecordPrefixSize];
+    prefix[0] = type;
+    Encoding::LittleEndian::Put16(&prefix[1], static_cast<uint16_t>(key.size()));
+    Encoding::LittleEndian::Put32(&prefix[3], static_cast<uint32_t>(dataLen));
+    out.append(reinterpret_cast<const char *>(prefix), sizeof(prefix));
+    out.append(key);
+    if (dataLen > 0)
+    {
+        out.append(static_cast<const char *>(data), dataLen);
+    }
+
+    uint8_t checksum[kRecordChecksumSize];
+    Encoding::LittleEndian::Put32(checksum, Crc32(reinterpret_cast<const uint8_t *>(out.data() + start), out.size() - start));
+    out.append(reinterpret_cast<const char *>(checksum), sizeof(checksum));
+}
+
+size_t RecordSize(const std::string & key, const std::string & value)
+{
+    return kRecordOverhead + key.size() + value.size();
+}
+
+bool WriteAll(int fd, const char * data, size_t len)
+{
+    while (len > 0)
+    {
+        ssize_t rv = write(fd, data, len);
+        if (rv < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        data += rv;
+        len -= static_cast<size_t>(rv);
+    }
+    return true;
+}
+
+// A rename() is only durable once the directory containing the file has been synced.
+bool SyncParentDirectory(const std::string & path)
+{
+    size_t slash    = path.find_last_of('/');
+    std::string dir = (slash == std::string::npos) ? std::string(".") : path.substr(0, std::max<size_t>(slash, 1));
+
+    int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        return false;
+    }
+    bool synced = (fsync(fd) == 0);
+    close(fd);
+    return synced;
+}
+
+} // namespace
+
+ChipLinuxStorageJournal::~ChipLinuxStorageJournal()
+{
+    CloseFile();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Init(const char * journalFile, const char * migrateFromIniFile)
+{
+    VerifyOrReturnError(journalFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    if (mFd >= 0)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxStorageJournal::Init: Attempt to re-initialize with journal file: %s, IGNORING.",
+                     journalFile);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxStorageJournal::Init: Using KVS journal file: %s", journalFile);
+
+    mJournalPath.assign(journalFile);
+    mEntries.clear();
+    mLiveSize   = kJournalHeaderSize;
+    mStatistics = Statistics();
+
+    if (migrateFromIniFile != nullptr && access(journalFile, F_OK) != 0 && access(migrateFromIniFile, F_OK) == 0)
+    {
+        return MigrateFromIni(migrateFromIniFile);
+    }
+
+    return OpenAndReplay();
+}
+
+void ChipLinuxStorageJournal::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    CloseFile();
+    mEntries.clear();
+    mLogSize  = 0;
+    mLiveSize = 0;
+}
+
+void ChipLinuxStorageJournal::CloseFile()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::OpenAndReplay()
+{
+    mFd = open(mJournalPath.c_str(), O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open journal %s: %s", mJournalPath.c_str(), strerror(errno)));
+
+    std::string contents;
+    char chunk[4096];
+    ssize_t rv;
+    while ((rv = pread(mFd, chunk, sizeof(chunk), static_cast<off_t>(contents.size()))) != 0)
+    {
+        if (rv < 0)
+        {
+            VerifyOrReturnError(errno == EINTR, CHIP_ERROR_READ_FAILED,
+                                ChipLogError(DeviceLayer, "Failed to read journal %s: %s", mJournalPath.c_str(), strerror(errno));
+                                CloseFile());
+            continue;
+        }
+        contents.append(chunk, static_cast<size_t>(rv));
+    }
+
+    if (contents.empty())
+    {
+        // New journal: write the header and make the new directory entry durable.
+        std::string header;
+        AppendHeader(header);
+        VerifyOrReturnError(WriteAll(mFd, header.data(), header.size()) && fdatasync(mFd) == 0 &&
+                                SyncParentDirectory(mJournalPath),
+                            CHIP_ERROR_WRITE_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to create journal %s: %s", mJournalPath.c_str(), strerror(errno));
+                            CloseFile());
+        mLogSize = header.size();
+        mStatistics.bytesWritten += header.size();
+        return CHIP_NO_ERROR;
+    }
+
+    VerifyOrReturnError(contents.size() >= kJournalHeaderSize &&
+                            memcmp(contents.data(), kJournalMagic, sizeof(kJournalMagic)) == 0 &&
+                            static_cast<uint8_t>(contents[sizeof(kJournalMagic)]) == kJournalVersion,
+                        CHIP_ERROR_PERSISTED_STORAGE_FAILED,
+                        ChipLogError(DeviceLayer, "Journal %s has an unknown format", mJournalPath.c_str());
+                        CloseFile());
+
+    const uint8_t * data = reinterpret_cast<const uint8_t *>(contents.data());
+    size_t offset        = kJournalHeaderSize;
+    while (contents.size() - offset >= kRecordOverhead)
+    {
+        const uint8_t type    = data[offset];
+        const size_t keyLen   = Encoding::LittleEndian::Get16(&data[offset + 1]);
+        const size_t valueLen = Encoding::LittleEndian::Get32(&data[offset + 3]);
+        const size_t bodyLen  = kRecordPrefixSize + keyLen + valueLen;
+        if (contents.size() - offset - kRecordChecksumSize < keyLen + valueLen + kRecordPrefixSize ||
+            Encoding::LittleEndian::Get32(&data[offset + bodyLen]) != Crc32(&data[offset], bodyLen))
+        {
+            break;
+        }
+
+        std::string key(contents, offset + kRecordPrefixSize, keyLen);
+        switch (static_cast<RecordType>(type))
+        {
+        case RecordType::kPut:
+            mEntries[std::move(key)].assign(contents, offset + kRecordPrefixSize + keyLen, valueLen);
+            break;
+        case RecordType::kDelete:
+            mEntries.erase(key);
+            break;
+        case RecordType::kClear:
+            mEntries.clear();
+            break;
+        default:
+            ChipLogError(DeviceLayer, "Journal %s: skipping record of unknown type %u", mJournalPath.c_str(), type);
+            break;
+        }
+        offset += bodyLen + kRecordChecksumSize;
+    }
+
+    if (offset != contents.size())
+    {
+        // Most likely an append torn by a crash or power loss; the record was never acknowledged, so drop it.
+        ChipLogError(DeviceLayer, "Journal %s: discarding %u bytes after the last complete record", mJournalPath.c_str(),
+                     static_cast<unsigned>(contents.size() - offset));
+        VerifyOrReturnError(ftruncate(mFd, static_cast<off_t>(offset)) == 0 && fdatasync(mFd) == 0, CHIP_ERROR_WRITE_FAILED,
+                            ChipLogError(DeviceLayer, "Failed to truncate journal %s: %s", mJournalPath.c_str(), strerror(errno));
+                            CloseFile());
+    }
+
+    mLogSize  = offset;
+    mLiveSize = kJournalHeaderSize;
+    for (const auto & entry : mEntries)
+    {
+        mLiveSize += RecordSize(entry.first, entry.second);
+    }
+
+    ChipLogDetail(DeviceLayer, "Replayed %u entries from journal %s (%u bytes)", static_cast<unsigned>(mEntries.size()),
+                  mJournalPath.c_str(), static_cast<unsigned>(mLogSize));
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::MigrateFromIni(const char * iniFile)
+{
+    ChipLogProgress(DeviceLayer, "Migrating KVS entries from %s to journal %s", iniFile, mJournalPath.c_str());
+
+    ChipLinuxStorage ini;
+    ReturnErrorOnFailure(ini.Init(iniFile));
+
+    std::vector<std::string> keys;
+    ReturnErrorOnFailure(ini.GetKeys(keys));
+
+    for (const auto & key : keys)
+    {
+        size_t len     = 0;
+        CHIP_ERROR err = ini.ReadValueBin(key.c_str(), nullptr, 0, len);
+        VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL, err);
+
+        Platform::ScopedMemoryBuffer<uint8_t> value;
+        VerifyOrReturnError(value.Alloc(std::max<size_t>(len, 1)), CHIP_ERROR_NO_MEMORY);
+        ReturnErrorOnFailure(ini.ReadValueBin(key.c_str(), value.Get(), len, len));
+
+        mLiveSize += RecordSize(key, mEntries[key].assign(reinterpret_cast<const char *>(value.Get()), len));
+    }
+
+    // The snapshot is renamed into place, so an interrupted migration leaves no journal behind and is simply redone.
+    ReturnErrorOnFailure(WriteSnapshot());
+
+    ChipLogProgress(DeviceLayer, "Migrated %u KVS entries to journal %s", static_cast<unsigned>(mEntries.size()),
+                    mJournalPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::AppendRecord(RecordType type, const std::string & key, const void * data, size_t dataLen)
+{
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key.size() <= UINT16_MAX && dataLen <= UINT32_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::string record;
+    record.reserve(kRecordOverhead + key.size() + dataLen);
+    AppendRecordBytes(record, to_underlying(type), key, data, dataLen);
+
+    if (!WriteAll(mFd, record.data(), record.size()) || fdatasync(mFd) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to append to journal %s: %s", mJournalPath.c_str(), strerror(errno));
+        // Drop any partial record, so that later appends are not hidden behind it on replay.
+        if (ftruncate(mFd, static_cast<off_t>(mLogSize)) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate journal %s: %s", mJournalPath.c_str(), strerror(errno));
+        }
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    mLogSize += record.size();
+    mStatistics.commits++;
+    mStatistics.bytesWritten += record.size();
+    return CHIP_NO_ERROR;
+}
+
+// Writes the live entries to a temporary file and renames it over the journal, so that a crash at any point leaves
+// either the old or the new journal in place.
+CHIP_ERROR ChipLinuxStorageJournal::WriteSnapshot()
+{
+    std::string snapshot;
+    snapshot.reserve(mLiveSize);
+    AppendHeader(snapshot);
+    for (const auto & entry : mEntries)
+    {
+        AppendRecordBytes(snapshot, to_underlying(RecordType::kPut), entry.first, entry.second.data(), entry.second.size());
+    }
+
+    std::string tmpPath = mJournalPath + "-XXXXXX";
+    int tmpFd           = mkostemp(tmpPath.data(), O_APPEND | O_CLOEXEC);
+    VerifyOrReturnError(tmpFd >= 0, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    if (!WriteAll(tmpFd, snapshot.data(), snapshot.size()) || fdatasync(tmpFd) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to write temp file %s: %s", tmpPath.c_str(), strerror(errno));
+        close(tmpFd);
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    if (rename(tmpPath.c_str(), mJournalPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", tmpPath.c_str(), mJournalPath.c_str(), strerror(errno));
+        close(tmpFd);
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+    if (!SyncParentDirectory(mJournalPath))
+    {
+        ChipLogError(DeviceLayer, "Failed to sync directory of %s: %s", mJournalPath.c_str(), strerror(errno));
+    }
+
+    // The temporary file is the journal now. Keep appending through its descriptor: opening the journal again could
+    // fail, and leave no journal to append later updates to.
+    CloseFile();
+    mFd = tmpFd;
+
+    mLogSize  = snapshot.size();
+    mLiveSize = snapshot.size();
+    mStatistics.compactions++;
+    mStatistics.bytesWritten += snapshot.size();
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxStorageJournal::CompactIfNeeded()
+{
+    VerifyOrReturn(mLogSize > CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD && mLogSize > 2 * mLiveSize);
+
+    ChipLogDetail(DeviceLayer, "Compacting journal %s: %u bytes, %u live", mJournalPath.c_str(), static_cast<unsigned>(mLogSize),
+                  static_cast<unsigned>(mLiveSize));
+
+    // The update that triggered the compaction is already durable, so a failure is not reported to the caller; the
+    // compaction is retried on a later update.
+    CHIP_ERROR err = WriteSnapshot();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact journal %s: %" CHIP_ERROR_FORMAT, mJournalPath.c_str(), err.Format());
+    }
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ReadValue(const char * key, void * buf, size_t bufSize, size_t * readBytes, size_t offset)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(buf != nullptr || bufSize == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const std::string & value = it->second;
+    VerifyOrReturnError(offset <= value.size(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = value.size() - offset;
+    const size_t copySize  = std::min(bufSize, remaining);
+    if (copySize > 0)
+    {
+        memcpy(buf, value.data() + offset, copySize);
+    }
+    if (readBytes != nullptr)
+    {
+        *readBytes = copySize;
+    }
+
+    return (bufSize < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::WriteValue(const char * key, const void * data, size_t dataLen)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(data != nullptr || dataLen == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    std::string keyString(key);
+    ReturnErrorOnFailure(AppendRecord(RecordType::kPut, keyString, data, dataLen));
+
+    auto it = mEntries.find(keyString);
+    if (it != mEntries.end())
+    {
+        mLiveSize -= RecordSize(it->first, it->second);
+        it->second.assign(static_cast<const char *>(data), dataLen);
+    }
+    else
+    {
+        it = mEntries.emplace(std::move(keyString), std::string(static_cast<const char *>(data), dataLen)).first;
+    }
+    mLiveSize += RecordSize(it->first, it->second);
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ClearValue(const char * key)
+{
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mEntries.find(key);
+    VerifyOrReturnError(it != mEntries.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(RecordType::kDelete, it->first, nullptr, 0));
+
+    mLiveSize -= RecordSize(it->first, it->second);
+    mEntries.erase(it);
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::ClearAll()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    ReturnErrorOnFailure(AppendRecord(RecordType::kClear, std::string(), nullptr, 0));
+
+    mEntries.clear();
+    mLiveSize = kJournalHeaderSize;
+
+    CompactIfNeeded();
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxStorageJournal::HasValue(const char * key)
+{
+    VerifyOrReturnValue(key != nullptr, false);
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mEntries.find(key) != mEntries.end();
+}
+
+CHIP_ERROR ChipLinuxStorageJournal::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_INCORRECT_STATE);
+    return WriteSnapshot();
+}
+
+size_t ChipLinuxStorageJournal::GetLogSize()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mLogSize;
+}
+
+ChipLinuxStorageJournal::Statistics ChipLinuxStorageJournal::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return mStatistics;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
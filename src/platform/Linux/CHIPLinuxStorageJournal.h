@@ -0,0 +1,128 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *         This file defines a journaled key-value store for Linux.
+ *
+ *         Unlike ChipLinuxStorage, which rewrites the whole INI file on every
+ *         commit, every update is appended to a log file as a single
+ *         checksummed record and synced, so the I/O per commit is proportional
+ *         to the size of the updated value. The log is periodically compacted
+ *         into a snapshot of the live entries.
+ *
+ *         The journal file layout is:
+ *
+ *           header: "CHIPKVJ" magic, 1-byte format version
+ *           record: 1-byte type, 2-byte key length, 4-byte value length,
+ *                   key, value, 4-byte CRC-32 of all preceding record bytes
+ *
+ *         with all integers in little-endian order. A record that is
+ *         truncated or fails its checksum (e.g. a write torn by a power loss)
+ *         ends the replay, and the log is truncated back to the last complete
+ *         record.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxStorageJournal
+{
+public:
+    struct Statistics
+    {
+        uint32_t commits      = 0; ///< Records appended (and synced) since Init().
+        uint32_t compactions  = 0; ///< Snapshots written since Init().
+        uint64_t bytesWritten = 0; ///< Bytes written to the journal by commits and compactions since Init().
+    };
+
+    ChipLinuxStorageJournal() = default;
+    ~ChipLinuxStorageJournal();
+
+    ChipLinuxStorageJournal(const ChipLinuxStorageJournal &)             = delete;
+    ChipLinuxStorageJournal & operator=(const ChipLinuxStorageJournal &) = delete;
+
+    /**
+     * Open (or create) the journal at `journalFile` and replay it.
+     *
+     * If the journal does not exist yet and `migrateFromIniFile` names an existing
+     * ChipLinuxStorage INI file, its entries are imported into a new journal. The INI
+     * file is left untouched, so the previous backend can still be used to roll back.
+     */
+    CHIP_ERROR Init(const char * journalFile, const char * migrateFromIniFile = nullptr);
+    void Shutdown();
+
+    /**
+     * Read a value with the semantics of KeyValueStoreManager::Get(): copies at most
+     * `bufSize` bytes starting at `offset`, and returns CHIP_ERROR_BUFFER_TOO_SMALL if
+     * the remainder of the value did not fit.
+     */
+    CHIP_ERROR ReadValue(const char * key, void * buf, size_t bufSize, size_t * readBytes = nullptr, size_t offset = 0);
+
+    /// Store a value. The update is durable when this returns CHIP_NO_ERROR.
+    CHIP_ERROR WriteValue(const char * key, const void * data, size_t dataLen);
+
+    /// Remove a value. Returns CHIP_ERROR_KEY_NOT_FOUND if the key is not present.
+    CHIP_ERROR ClearValue(const char * key);
+    CHIP_ERROR ClearAll();
+    bool HasValue(const char * key);
+
+    /// Rewrite the journal as a snapshot of the live entries.
+    CHIP_ERROR Compact();
+
+    size_t GetLogSize();
+    Statistics GetStatistics();
+
+private:
+    enum class RecordType : uint8_t
+    {
+        kPut    = 1,
+        kDelete = 2,
+        kClear  = 3,
+    };
+
+    CHIP_ERROR OpenAndReplay();
+    CHIP_ERROR MigrateFromIni(const char * iniFile);
+    CHIP_ERROR AppendRecord(RecordType type, const std::string & key, const void * data, size_t dataLen);
+    CHIP_ERROR WriteSnapshot();
+    void CompactIfNeeded();
+    void CloseFile();
+
+    std::mutex mLock;
+    std::unordered_map<std::string, std::string> mEntries;
+    std::string mJournalPath;
+    int mFd         = -1;
+    size_t mLogSize = 0;
+    // Size the log would have as a snapshot of mEntries; drives compaction.
+    size_t mLiveSize = 0;
+    Statistics mStatistics;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -81,6 +81,56 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #define CHIP_CONFIG_LAMBDA_EVENT_SIZE (48)
 #endif // CHIP_CONFIG_LAMBDA_EVENT_SIZE
 
+// Controllers on Linux may hold many concurrent sessions; index the session table.
+#ifndef CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+#define CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX 1
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+// Bridges on Linux may register hundreds of code-driven clusters; index their paths.
+#ifndef CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+#define CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX 1
+#endif // CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX
+
+// Bridges on Linux may expose hundreds of dynamic endpoints; index the ember endpoint table.
+#ifndef CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+#define CHIP_CONFIG_EMBER_ENDPOINT_INDEX 1
+#endif // CHIP_CONFIG_EMBER_ENDPOINT_INDEX
+
+// Cache access control decisions for the many checks of wildcard reads and subscriptions.
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+#define CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE 1
+#endif // CHIP_CONFIG_ACCESS_CONTROL_CHECK_CACHE
+
+// Controllers on Linux may have many messages awaiting acknowledgement; order retransmissions in a heap.
+#ifndef CHIP_CONFIG_RMP_RETRANS_HEAP
+#define CHIP_CONFIG_RMP_RETRANS_HEAP 1
+#endif // CHIP_CONFIG_RMP_RETRANS_HEAP
+
+// Bridges on Linux may change many attributes at once; report exactly those instead of merged wildcards.
+#ifndef CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS
+#define CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS 1024
+#endif // CHIP_IM_SERVER_MAX_NUM_DIRTY_ATTRIBUTE_PATHS
+
+// Controllers on Linux may reconnect to many nodes at once; remember their addresses across lookups.
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 256
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+// Devices on Linux may serve many subscribers; let reports seek into the event logs.
+#ifndef CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+#define CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE 64
+#endif // CHIP_CONFIG_EVENT_LOGGING_INDEX_SIZE
+
+// Devices on Linux may receive bursts of group commands; match their keys without storage reads.
+#ifndef CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+#define CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE 64
+#endif // CHIP_CONFIG_GROUP_SESSION_INDEX_SIZE
+
+// Controllers on Linux reconnect to many devices over CASE; skip re-verifying certificate chains seen before.
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE 256
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE
+
 // ==================== Security Configuration Overrides ====================
 
 #ifndef CHIP_CONFIG_KVS_PATH
@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <string.h>
+#include <string>
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -36,9 +37,23 @@ namespace PersistedStorage {
 
 KeyValueStoreManagerImpl KeyValueStoreManagerImpl::sInstance;
 
+CHIP_ERROR KeyValueStoreManagerImpl::Init(const char * file)
+{
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    VerifyOrReturnError(file != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    return mStorage.Init((std::string(file) + ".journal").c_str(), file);
+#else
+    return mStorage.Init(file);
+#endif
+}
+
 CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t value_size, size_t * read_bytes_size,
                                           size_t offset_bytes)
 {
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    CHIP_ERROR err = mStorage.ReadValue(key, value, value_size, read_bytes_size, offset_bytes);
+    return (err == CHIP_ERROR_KEY_NOT_FOUND) ? CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND : err;
+#else
     size_t read_size;
 
     // Copy data into value buffer
@@ -74,10 +89,15 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     ::memcpy(value, buf.Get() + offset_bytes, copy_size);
 
     return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
 }
 
 CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
 {
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    // Journal writes are durable when they return, there is nothing to commit.
+    return mStorage.WriteValue(key, value, value_size);
+#else
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
@@ -89,10 +109,15 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value,
 
 exit:
     return err;
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
 }
 
 CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
 {
+#if CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
+    CHIP_ERROR err = mStorage.ClearValue(key);
+    return (err == CHIP_ERROR_KEY_NOT_FOUND) ? CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND : err;
+#else
     CHIP_ERROR err = CHIP_NO_ERROR;
     err            = mStorage.ClearValue(key);
 
@@ -108,6 +133,7 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
 
 exit:
     return err;
+#endif // CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL
 }
 
 } // namespace PersistedStorage
@@ -0,0 +1,331 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the journaled key-value
+ *      store of the Linux platform.
+ *
+ *      It also contains a benchmark comparing writes/sec and bytes written
+ *      per commit with the INI based ChipLinuxStorage.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceConfig.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+#include <platform/Linux/CHIPLinuxStorageJournal.h>
+
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <string>
+
+using namespace chip;
+using namespace chip::DeviceLayer::Internal;
+
+namespace {
+
+uint64_t NowNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+size_t FileSize(const std::string & path)
+{
+    struct stat st;
+    return (stat(path.c_str(), &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+}
+
+std::string ReadString(ChipLinuxStorageJournal & journal, const char * key)
+{
+    char buf[2048];
+    size_t len     = 0;
+    CHIP_ERROR err = journal.ReadValue(key, buf, sizeof(buf), &len);
+    return (err == CHIP_NO_ERROR) ? std::string(buf, len) : std::string("<") + err.AsString() + ">";
+}
+
+CHIP_ERROR WriteString(ChipLinuxStorageJournal & journal, const char * key, const std::string & value)
+{
+    return journal.WriteValue(key, value.data(), value.size());
+}
+
+class TestLinuxStorageJournal : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char dirTemplate[] = "/tmp/chip-kvs-journal-XXXXXX";
+        ASSERT_NE(mkdtemp(dirTemplate), nullptr);
+        mDir         = dirTemplate;
+        mJournalPath = mDir + "/chip_kvs.journal";
+        mIniPath     = mDir + "/chip_kvs";
+    }
+
+    void TearDown() override
+    {
+        std::string command = "rm -rf " + mDir;
+        EXPECT_EQ(system(command.c_str()), 0);
+    }
+
+    std::string mDir;
+    std::string mJournalPath;
+    std::string mIniPath;
+};
+
+TEST_F(TestLinuxStorageJournal, PutGetDelete)
+{
+    ChipLinuxStorageJournal journal;
+    ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+
+    EXPECT_FALSE(journal.HasValue("a"));
+    EXPECT_EQ(journal.ReadValue("a", nullptr, 0), CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(journal.ClearValue("a"), CHIP_ERROR_KEY_NOT_FOUND);
+
+    EXPECT_EQ(WriteString(journal, "a", "hello world"), CHIP_NO_ERROR);
+    EXPECT_EQ(WriteString(journal, "empty", ""), CHIP_NO_ERROR);
+    EXPECT_TRUE(journal.HasValue("a"));
+    EXPECT_EQ(ReadString(journal, "a"), "hello world");
+    EXPECT_EQ(ReadString(journal, "empty"), "");
+
+    // Partial and offset reads follow KeyValueStoreManager::Get().
+    char buf[5];
+    size_t len = 0;
+    EXPECT_EQ(journal.ReadValue("a", buf, sizeof(buf), &len), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(std::string(buf, len), "hello");
+    EXPECT_EQ(journal.ReadValue("a", buf, sizeof(buf), &len, 6), CHIP_NO_ERROR);
+    EXPECT_EQ(std::string(buf, len), "world");
+    EXPECT_EQ(journal.ReadValue("a", buf, sizeof(buf), &len, 12), CHIP_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(WriteString(journal, "a", "updated"), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(journal, "a"), "updated");
+
+    EXPECT_EQ(journal.ClearValue("a"), CHIP_NO_ERROR);
+    EXPECT_FALSE(journal.HasValue("a"));
+    EXPECT_TRUE(journal.HasValue("empty"));
+
+    EXPECT_EQ(journal.ClearAll(), CHIP_NO_ERROR);
+    EXPECT_FALSE(journal.HasValue("empty"));
+}
+
+TEST_F(TestLinuxStorageJournal, ReplayAfterReopen)
+{
+    {
+        ChipLinuxStorageJournal journal;
+        ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(journal, "kept", "1"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(journal, "overwritten", "old"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(journal, "overwritten", "new"), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(journal, "deleted", "x"), CHIP_NO_ERROR);
+        EXPECT_EQ(journal.ClearValue("deleted"), CHIP_NO_ERROR);
+        EXPECT_EQ(journal.GetStatistics().commits, 5u);
+    }
+
+    ChipLinuxStorageJournal journal;
+    ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(journal, "kept"), "1");
+    EXPECT_EQ(ReadString(journal, "overwritten"), "new");
+    EXPECT_FALSE(journal.HasValue("deleted"));
+}
+
+TEST_F(TestLinuxStorageJournal, TornAppendIsDiscarded)
+{
+    size_t sizeBeforeLastWrite;
+    {
+        ChipLinuxStorageJournal journal;
+        ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(journal, "first", "complete"), CHIP_NO_ERROR);
+        sizeBeforeLastWrite = journal.GetLogSize();
+        EXPECT_EQ(WriteString(journal, "second", "torn by a power loss"), CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of the last append.
+    ASSERT_EQ(truncate(mJournalPath.c_str(), static_cast<off_t>(FileSize(mJournalPath) - 3)), 0);
+
+    {
+        ChipLinuxStorageJournal journal;
+        ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ReadString(journal, "first"), "complete");
+        EXPECT_FALSE(journal.HasValue("second"));
+        EXPECT_EQ(journal.GetLogSize(), sizeBeforeLastWrite);
+        EXPECT_EQ(FileSize(mJournalPath), sizeBeforeLastWrite);
+
+        // Appends after the recovered tail must survive the next replay.
+        EXPECT_EQ(WriteString(journal, "third", "after recovery"), CHIP_NO_ERROR);
+    }
+
+    // A corrupted record is rejected by its checksum.
+    FILE * file = fopen(mJournalPath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(fseek(file, -6, SEEK_END), 0);
+    fputc('#', file);
+    fclose(file);
+
+    ChipLinuxStorageJournal journal;
+    ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(journal, "first"), "complete");
+    EXPECT_FALSE(journal.HasValue("third"));
+}
+
+TEST_F(TestLinuxStorageJournal, UnknownFormatIsNotOverwritten)
+{
+    FILE * file = fopen(mJournalPath.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    fputs("[DEFAULT]\nkey=value\n", file);
+    fclose(file);
+    const size_t size = FileSize(mJournalPath);
+
+    ChipLinuxStorageJournal journal;
+    EXPECT_EQ(journal.Init(mJournalPath.c_str()), CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    EXPECT_EQ(FileSize(mJournalPath), size);
+}
+
+TEST_F(TestLinuxStorageJournal, Compaction)
+{
+    const std::string value(1024, 'v');
+    constexpr int kWrites = 1000;
+
+    {
+        ChipLinuxStorageJournal journal;
+        ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(WriteString(journal, "static", "unchanged"), CHIP_NO_ERROR);
+        for (int i = 0; i < kWrites; i++)
+        {
+            std::string versioned = value + std::to_string(i);
+            ASSERT_EQ(WriteString(journal, "hot", versioned), CHIP_NO_ERROR);
+        }
+
+        // ~1 MB of updates, but the log never grows much past the compaction threshold.
+        EXPECT_GT(journal.GetStatistics().compactions, 0u);
+        EXPECT_LE(journal.GetLogSize(), static_cast<size_t>(CHIP_DEVICE_CONFIG_LINUX_KVS_JOURNAL_COMPACTION_THRESHOLD) + 2048);
+        EXPECT_EQ(FileSize(mJournalPath), journal.GetLogSize());
+
+        EXPECT_EQ(journal.Compact(), CHIP_NO_ERROR);
+        EXPECT_LT(journal.GetLogSize(), 2 * value.size());
+
+        // Updates that follow a compaction are appended to the snapshot.
+        EXPECT_EQ(WriteString(journal, "after", "compaction"), CHIP_NO_ERROR);
+        EXPECT_EQ(FileSize(mJournalPath), journal.GetLogSize());
+    }
+
+    ChipLinuxStorageJournal journal;
+    ASSERT_EQ(journal.Init(mJournalPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(ReadString(journal, "static"), "unchanged");
+    EXPECT_EQ(ReadString(journal, "hot"), value + std::to_string(kWrites - 1));
+    EXPECT_EQ(ReadString(journal, "after"), "compaction");
+}
+
+TEST_F(TestLinuxStorageJournal, MigratesFromIni)
+{
+    const uint8_t blob[] = { 0x00, 0x01, 0xFE, 0xFF, '=', '\n' };
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mIniPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("g/fs/c", blob, sizeof(blob)), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("key with spaces=and[brackets]", blob, 2), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.WriteValueBin("empty", blob, 0), CHIP_NO_ERROR);
+        EXPECT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+    const size_t iniSize = FileSize(mIniPath);
+
+    {
+        ChipLinuxStorageJournal journal;
+        ASSERT_EQ(journal.Init(mJournalPath.c_str(), mIniPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ReadString(journal, "g/fs/c"), std::string(reinterpret_cast<const char *>(blob), sizeof(blob)));
+        EXPECT_EQ(ReadString(journal, "key with spaces=and[brackets]"), std::string(reinterpret_cast<const char *>(blob), 2));
+        EXPECT_EQ(ReadString(journal, "empty"), "");
+
+        EXPECT_EQ(journal.ClearValue("g/fs/c"), CHIP_NO_ERROR);
+    }
+
+    // The INI file is left as is for rollback, and is not migrated again once the journal exists.
+    EXPECT_EQ(FileSize(mIniPath), iniSize);
+
+    ChipLinuxStorageJournal journal;
+    ASSERT_EQ(journal.Init(mJournalPath.c_str(), mIniPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_FALSE(journal.HasValue("g/fs/c"));
+    EXPECT_TRUE(journal.HasValue("empty"));
+}
+
+// Benchmark: commits of a small value (as for a counter or subscription update) into a store that
+// already holds a few hundred entries, with the INI backend and with the journal.
+TEST_F(TestLinuxStorageJournal, BenchmarkCommits)
+{
+    constexpr int kEntries = 300;
+    constexpr int kCommits = 200;
+    const std::string entry(256, 'e');
+    const std::string update(16, 'u');
+
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mIniPath.c_str()), CHIP_NO_ERROR);
+        for (int i = 0; i < kEntries; i++)
+        {
+            std::string key = "entry/" + std::to_string(i);
+            ASSERT_EQ(ini.WriteValueBin(key.c_str(), reinterpret_cast<const uint8_t *>(entry.data()), entry.size()), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+
+        uint64_t bytes = 0;
+        uint64_t start = NowNs();
+        for (int i = 0; i < kCommits; i++)
+        {
+            ASSERT_EQ(ini.WriteValueBin("counter", reinterpret_cast<const uint8_t *>(update.data()), update.size()), CHIP_NO_ERROR);
+            ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+            // Every commit rewrites the whole file.
+            bytes += FileSize(mIniPath);
+        }
+        uint64_t elapsed = NowNs() - start;
+
+        ChipLogProgress(Test, "INI:     %u entries, %u commits/s, %u bytes written per commit", static_cast<unsigned>(kEntries),
+                        static_cast<unsigned>(kCommits * 1000000000ull / elapsed), static_cast<unsigned>(bytes / kCommits));
+    }
+
+    {
+        ChipLinuxStorageJournal journal;
+        ASSERT_EQ(journal.Init(mJournalPath.c_str(), mIniPath.c_str()), CHIP_NO_ERROR);
+        EXPECT_EQ(ReadString(journal, "entry/0"), entry);
+
+        const auto before = journal.GetStatistics();
+        uint64_t start    = NowNs();
+        for (int i = 0; i < kCommits; i++)
+        {
+            ASSERT_EQ(WriteString(journal, "counter", update), CHIP_NO_ERROR);
+        }
+        uint64_t elapsed   = NowNs() - start;
+        const auto after   = journal.GetStatistics();
+        const auto commits = after.commits - before.commits;
+        EXPECT_EQ(commits, static_cast<uint32_t>(kCommits));
+
+        ChipLogProgress(Test, "Journal: %u entries, %u commits/s, %u bytes written per commit (%u compactions)",
+                        static_cast<unsigned>(kEntries), static_cast<unsigned>(kCommits * 1000000000ull / elapsed),
+                        static_cast<unsigned>((after.bytesWritten - before.bytesWritten) / commits),
+                        static_cast<unsigned>(after.compactions - before.compactions));
+    }
+}
+
+} // namespace
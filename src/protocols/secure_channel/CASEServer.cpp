@@ -23,8 +23,11 @@
 #include <lib/support/SafeInt.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <tracing/macros.h>
+#include <tracing/metric_event.h>
 #include <transport/SessionManager.h>
 
+#include <algorithm>
+
 using namespace ::chip::Inet;
 using namespace ::chip::Transport;
 using namespace ::chip::Credentials;
@@ -48,24 +51,31 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mGroupDataProvider         = responderGroupDataProvider;
 
     // Set up the group state provider that persists across all handshakes.
-    GetSession().SetGroupDataProvider(mGroupDataProvider);
+    for (auto & slot : mHandshakes)
+    {
+        slot.mSession.SetGroupDataProvider(mGroupDataProvider);
+    }
 
-    ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
+    ChipLogProgress(Inet, "CASE Server enabling CASE session setups (%u concurrent handshakes)",
+                    static_cast<unsigned>(kMaxConcurrentHandshakes));
     TEMPORARY_RETURN_IGNORED mExchangeManager->RegisterUnsolicitedMessageHandlerForType(
         Protocols::SecureChannel::MsgType::CASE_Sigma1, this);
 
-    PrepareForSessionEstablishment();
+    for (auto & slot : mHandshakes)
+    {
+        PrepareForSessionEstablishment(slot);
+    }
 
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::InitCASEHandshake(Messaging::ExchangeContext * ec)
+CHIP_ERROR CASEServer::InitCASEHandshake(HandshakeSlot & slot, Messaging::ExchangeContext * ec)
 {
     MATTER_TRACE_SCOPE("InitCASEHandshake", "CASEServer");
     VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
     // Hand over the exchange context to the CASE session.
-    ec->SetDelegate(&GetSession());
+    ec->SetDelegate(&slot.mSession);
 
     return CHIP_NO_ERROR;
 }
@@ -77,55 +87,98 @@ CHIP_ERROR CASEServer::OnUnsolicitedMessageReceived(const PayloadHeader & payloa
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
-                                         System::PacketBufferHandle && payload)
+size_t CASEServer::GetActiveHandshakeCount() const
 {
-    MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
+    size_t count = 0;
+    for (const auto & slot : mHandshakes)
+    {
+        if (slot.mSession.GetState() != CASESession::State::kInitialized)
+        {
+            count++;
+        }
+    }
+    return count;
+}
 
-    bool busy = GetSession().GetState() != CASESession::State::kInitialized;
-    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, busy = true);
-    if (busy)
+CASEServer::HandshakeSlot * CASEServer::AllocateHandshakeSlot()
+{
+    for (auto & slot : mHandshakes)
     {
-        // We are in the middle of CASE handshake
+        if (slot.IsIdle())
+        {
+            return &slot;
+        }
+    }
 
-        // Invoke watchdog to fix any stuck handshakes
-        bool watchdogFired = GetSession().InvokeBackgroundWorkWatchdog();
-        if (!watchdogFired)
+    // All slots are in the middle of a CASE handshake. Invoke the watchdog to fix any stuck handshakes; a stuck
+    // handshake is failed by its session, which makes the slot idle again.
+    for (auto & slot : mHandshakes)
+    {
+        if (slot.mSession.InvokeBackgroundWorkWatchdog() && slot.IsIdle())
         {
-            // Handshake wasn't stuck, send the busy status report and let the existing handshake continue.
+            mStatistics.handshakesRecoveredByWatchdog++;
+            return &slot;
+        }
+    }
 
-            // A successful CASE handshake can take several seconds and some may time out (30 seconds or more).
+    return nullptr;
+}
 
-            System::Clock::Milliseconds16 delay = System::Clock::kZero;
-            if (GetSession().GetState() == CASESession::State::kSentSigma2)
+System::Clock::Milliseconds16 CASEServer::ComputeBusyWaitTime()
+{
+    // A successful CASE handshake can take several seconds and some may time out (30 seconds or more). Report the
+    // time until the first in-progress handshake is expected to release its slot.
+    System::Clock::Milliseconds16 delay = System::Clock::Milliseconds16::max();
+    for (auto & slot : mHandshakes)
+    {
+        System::Clock::Milliseconds16 slotDelay;
+        if (slot.mSession.GetState() == CASESession::State::kSentSigma2)
+        {
+            // The delay should be however long we think it will take for
+            // that to time out.
+            auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(slot.mSession.GetRemoteMRPConfig());
+            if (sigma2Timeout < System::Clock::Milliseconds16::max())
             {
-                // The delay should be however long we think it will take for
-                // that to time out.
-                auto sigma2Timeout = CASESession::ComputeSigma2ResponseTimeout(GetSession().GetRemoteMRPConfig());
-                if (sigma2Timeout < System::Clock::Milliseconds16::max())
-                {
-                    delay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
-                }
-                else
-                {
-                    // Avoid overflow issues, just wait for as long as we can to
-                    // get close to our expected Sigma2 timeout.
-                    delay = System::Clock::Milliseconds16::max();
-                }
+                slotDelay = std::chrono::duration_cast<System::Clock::Milliseconds16>(sigma2Timeout);
             }
             else
             {
-                // For now, setting minimum wait time to 5000 milliseconds if we
-                // have no other information.
-                delay = System::Clock::Milliseconds16(5000);
-            }
-            CHIP_ERROR err = SendBusyStatusReport(ec, delay);
-            if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+                // Avoid overflow issues, just wait for as long as we can to
+                // get close to our expected Sigma2 timeout.
+                slotDelay = System::Clock::Milliseconds16::max();
             }
-            return err;
         }
+        else
+        {
+            // For now, setting minimum wait time to 5000 milliseconds if we
+            // have no other information.
+            slotDelay = System::Clock::Milliseconds16(5000);
+        }
+        delay = std::min(delay, slotDelay);
+    }
+    return delay;
+}
+
+CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                         System::PacketBufferHandle && payload)
+{
+    MATTER_TRACE_SCOPE("OnMessageReceived", "CASEServer");
+
+    HandshakeSlot * slot = AllocateHandshakeSlot();
+    CHIP_FAULT_INJECT(FaultInjection::kFault_CASEServerBusy, slot = nullptr);
+    if (slot == nullptr)
+    {
+        // Handshakes weren't stuck, send the busy status report and let the existing handshakes continue.
+        System::Clock::Milliseconds16 delay = ComputeBusyWaitTime();
+        mStatistics.sigma1Busy++;
+        MATTER_LOG_METRIC(Tracing::kMetricDeviceCASEServerSigma1Busy, static_cast<uint32_t>(delay.count()));
+
+        CHIP_ERROR err = SendBusyStatusReport(ec, delay);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to send the busy status report, err:%" CHIP_ERROR_FORMAT, err.Format());
+        }
+        return err;
     }
 
     if (!ec->GetSessionHandle()->IsUnauthenticatedSession())
@@ -136,24 +189,28 @@ CHIP_ERROR CASEServer::OnMessageReceived(Messaging::ExchangeContext * ec, const
 
     ChipLogProgress(Inet, "CASE Server received Sigma1 message %s EC %p", ". Starting handshake.", ec);
 
-    CHIP_ERROR err = InitCASEHandshake(ec);
+    CHIP_ERROR err = InitCASEHandshake(*slot, ec);
     SuccessOrExit(err);
 
-    // TODO - Enable multiple concurrent CASE session establishment
-    // https://github.com/project-chip/connectedhomeip/issues/8342
-
-    err = GetSession().OnMessageReceived(ec, payloadHeader, std::move(payload));
+    err = slot->mSession.OnMessageReceived(ec, payloadHeader, std::move(payload));
     SuccessOrExit(err);
 
+    {
+        const auto active = static_cast<uint16_t>(GetActiveHandshakeCount());
+        mStatistics.sigma1Admitted++;
+        mStatistics.peakConcurrentHandshakes = std::max(mStatistics.peakConcurrentHandshakes, active);
+        MATTER_LOG_METRIC(Tracing::kMetricDeviceCASEServerSigma1Admitted, active);
+    }
+
 exit:
     // CASESession::OnMessageReceived guarantees that it will call
     // OnSessionEstablishmentError if it returns error, so nothing else to do here.
     return err;
 }
 
-void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer)
+void CASEServer::PrepareForSessionEstablishment(HandshakeSlot & slot, const ScopedNodeId & previouslyEstablishedPeer)
 {
-    GetSession().Clear();
+    slot.mSession.Clear();
 
     //
     // This releases our reference to a previously pinned session. If that was a successfully established session and is now
@@ -164,7 +221,7 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // de-allocated since no one else is holding onto this session. This will mean that when we get to allocating a session below,
     // we'll at least have one free session available in the session table, and won't need to evict an arbitrary session.
     //
-    mPinnedSecureSession.ClearValue();
+    slot.mPinnedSecureSession.ClearValue();
 
     //
     // Indicate to the underlying CASE session to prepare for session establishment requests coming its way. This will
@@ -182,9 +239,9 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     // TODO(#17568): Once session eviction is actually in place, this call should NEVER fail and if so, is a logic bug.
     // Dying here on failure is even more appropriate then.
     //
-    VerifyOrDie(GetSession().PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
-                                                            mCertificateValidityPolicy, this, previouslyEstablishedPeer,
-                                                            GetLocalMRPConfig()) == CHIP_NO_ERROR);
+    VerifyOrDie(slot.mSession.PrepareForSessionEstablishment(*mSessionManager, mFabrics, mSessionResumptionStorage,
+                                                             mCertificateValidityPolicy, &slot, previouslyEstablishedPeer,
+                                                             GetLocalMRPConfig()) == CHIP_NO_ERROR);
 
     //
     // PairingSession::mSecureSessionHolder is a weak-reference. If MarkForEviction is called on this session, the session is
@@ -196,36 +253,36 @@ void CASEServer::PrepareForSessionEstablishment(const ScopedNodeId & previouslyE
     //
     // Let's create a SessionHandle strong-reference to it to keep it resident.
     //
-    mPinnedSecureSession = GetSession().CopySecureSession();
+    slot.mPinnedSecureSession = slot.mSession.CopySecureSession();
 
     //
     // If we've gotten this far, it means we have successfully allocated a SecureSession to back our next attempt. If we haven't,
     // there is a bug somewhere and we should raise attention to it by dying.
     //
-    VerifyOrDie(mPinnedSecureSession.HasValue());
+    VerifyOrDie(slot.mPinnedSecureSession.HasValue());
 }
 
-void CASEServer::OnSessionEstablishmentError(CHIP_ERROR err)
+void CASEServer::HandshakeSlot::OnSessionEstablishmentError(CHIP_ERROR err)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablishmentError", "CASEServer");
     ChipLogError(Inet, "CASE Session establishment failed: %" CHIP_ERROR_FORMAT, err.Format());
 
     MATTER_TRACE_SCOPE("CASEFail", "CASESession");
-    PrepareForSessionEstablishment();
+    mServer->PrepareForSessionEstablishment(*this);
 }
 
-void CASEServer::OnSessionEstablished(const SessionHandle & session)
+void CASEServer::HandshakeSlot::OnSessionEstablished(const SessionHandle & session)
 {
     MATTER_TRACE_SCOPE("OnSessionEstablished", "CASEServer");
     ChipLogProgress(Inet, "CASE Session established to peer: " ChipLogFormatScopedNodeId,
                     ChipLogValueScopedNodeId(session->GetPeer()));
-    PrepareForSessionEstablishment(session->GetPeer());
+    mServer->PrepareForSessionEstablishment(*this, session->GetPeer());
 }
 
 CHIP_ERROR CASEServer::SendBusyStatusReport(Messaging::ExchangeContext * ec, System::Clock::Milliseconds16 minimumWaitTime)
 {
     MATTER_TRACE_SCOPE("SendBusyStatusReport", "CASEServer");
-    ChipLogProgress(Inet, "Already in the middle of CASE handshake, sending busy status report");
+    ChipLogProgress(Inet, "All CASE handshake slots are in use, sending busy status report");
 
     System::PacketBufferHandle handle = Protocols::SecureChannel::StatusReport::MakeBusyStatusReportMessage(minimumWaitTime);
     VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
@@ -19,25 +19,53 @@
 
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/GroupDataProvider.h>
+#include <lib/support/CodeUtils.h>
 #include <messaging/ExchangeDelegate.h>
 #include <messaging/ExchangeMgr.h>
 #include <protocols/secure_channel/CASESession.h>
+#include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <system/SystemClock.h>
 
 namespace chip {
 
-class CASEServer : public SessionEstablishmentDelegate,
-                   public Messaging::UnsolicitedMessageHandler,
-                   public Messaging::ExchangeDelegate
+class CASEServer : public Messaging::UnsolicitedMessageHandler, public Messaging::ExchangeDelegate
 {
 public:
-    CASEServer() {}
+    /**
+     * Number of CASE handshakes the server drives concurrently. Each handshake slot keeps one
+     * SecureSession pinned, see CHIP_CONFIG_SECURE_SESSION_POOL_SIZE.
+     */
+    static constexpr size_t kMaxConcurrentHandshakes = CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES;
+    static_assert(kMaxConcurrentHandshakes >= 1, "CASEServer needs at least one handshake slot");
+
+    /**
+     * Counters describing how incoming Sigma1 messages were admitted.
+     */
+    struct Statistics
+    {
+        // Sigma1 messages handed to a free handshake slot.
+        uint32_t sigma1Admitted = 0;
+        // Sigma1 messages answered with Busy because all slots were in use.
+        uint32_t sigma1Busy = 0;
+        // Stuck handshakes reclaimed by the background work watchdog to admit a new Sigma1.
+        uint32_t handshakesRecoveredByWatchdog = 0;
+        // Highest number of handshakes in progress at once.
+        uint16_t peakConcurrentHandshakes = 0;
+    };
+
+    CASEServer()
+    {
+        for (auto & slot : mHandshakes)
+        {
+            slot.mServer = this;
+        }
+    }
     ~CASEServer() override { Shutdown(); }
 
     /*
-     * This method will shutdown this object, releasing the strong reference to the pinned SecureSession object.
-     * It will also unregister the unsolicited handler and clear out the session object (which will release the weak
-     * reference through the underlying SessionHolder).
+     * This method will shutdown this object, releasing the strong references to the pinned SecureSession objects.
+     * It will also unregister the unsolicited handler and clear out the session objects (which will release the weak
+     * references through the underlying SessionHolder).
      *
      */
     void Shutdown()
@@ -49,8 +77,11 @@ public:
             mExchangeManager = nullptr;
         }
 
-        GetSession().Clear();
-        mPinnedSecureSession.ClearValue();
+        for (auto & slot : mHandshakes)
+        {
+            slot.mSession.Clear();
+            slot.mPinnedSecureSession.ClearValue();
+        }
     }
 
     CHIP_ERROR ListenForSessionEstablishment(Messaging::ExchangeManager * exchangeManager, SessionManager * sessionManager,
@@ -58,10 +89,6 @@ public:
                                              Credentials::CertificateValidityPolicy * policy,
                                              Credentials::GroupDataProvider * responderGroupDataProvider);
 
-    //////////// SessionEstablishmentDelegate Implementation ///////////////
-    void OnSessionEstablishmentError(CHIP_ERROR error) override;
-    void OnSessionEstablished(const SessionHandle & session) override;
-
     //// UnsolicitedMessageHandler Implementation ////
     CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override;
 
@@ -69,48 +96,91 @@ public:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
     void OnResponseTimeout(Messaging::ExchangeContext * ec) override {}
-    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return GetSession().GetMessageDispatch(); }
+    // Sigma1 is received on an unauthenticated session before a handshake slot is chosen, which every slot's CASESession
+    // dispatches the same way.
+    Messaging::ExchangeMessageDispatch & GetMessageDispatch() override { return SessionEstablishmentExchangeDispatch::Instance(); }
+
+    /**
+     * Returns the CASESession of the given handshake slot, index < kMaxConcurrentHandshakes.
+     */
+    CASESession & GetSession(size_t index)
+    {
+        VerifyOrDie(index < kMaxConcurrentHandshakes);
+        return mHandshakes[index].mSession;
+    }
+
+    /**
+     * Number of handshake slots currently driving a handshake.
+     */
+    size_t GetActiveHandshakeCount() const;
 
-    CASESession & GetSession() { return mPairingSession; }
+    const Statistics & GetStatistics() const { return mStatistics; }
+    void ResetStatistics() { mStatistics = Statistics(); }
 
 private:
+    struct HandshakeSlot : public SessionEstablishmentDelegate
+    {
+        void OnSessionEstablishmentError(CHIP_ERROR error) override;
+        void OnSessionEstablished(const SessionHandle & session) override;
+
+        bool IsIdle() const { return mSession.GetState() == CASESession::State::kInitialized; }
+
+        CASEServer * mServer = nullptr;
+
+        //
+        // When we're in the process of establishing a session, this is used
+        // to maintain an additional, strong reference to the underlying SecureSession.
+        // This is because the existing reference in PairingSession is a weak one
+        // (i.e a SessionHolder) and can lose its reference if the session is evicted
+        // for any reason.
+        //
+        // This initially points to a session that is not yet active. Upon activation, it
+        // transfers ownership of the session to the SecureSessionManager and this reference
+        // is released before simultaneously acquiring ownership of a new SecureSession.
+        //
+        Optional<SessionHandle> mPinnedSecureSession;
+
+        CASESession mSession;
+    };
+
     Messaging::ExchangeManager * mExchangeManager                       = nullptr;
     SessionResumptionStorage * mSessionResumptionStorage                = nullptr;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy = nullptr;
 
-    //
-    // When we're in the process of establishing a session, this is used
-    // to maintain an additional, strong reference to the underlying SecureSession.
-    // This is because the existing reference in PairingSession is a weak one
-    // (i.e a SessionHolder) and can lose its reference if the session is evicted
-    // for any reason.
-    //
-    // This initially points to a session that is not yet active. Upon activation, it
-    // transfers ownership of the session to the SecureSessionManager and this reference
-    // is released before simultaneously acquiring ownership of a new SecureSession.
-    //
-    Optional<SessionHandle> mPinnedSecureSession;
-
-    CASESession mPairingSession;
+    HandshakeSlot mHandshakes[kMaxConcurrentHandshakes];
     SessionManager * mSessionManager = nullptr;
 
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
-    CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
+    Statistics mStatistics;
+
+    CHIP_ERROR InitCASEHandshake(HandshakeSlot & slot, Messaging::ExchangeContext * ec);
+
+    /*
+     * Returns an idle handshake slot, reclaiming a stuck one through its background work watchdog
+     * if needed, or nullptr if all slots are legitimately busy.
+     */
+    HandshakeSlot * AllocateHandshakeSlot();
+
+    /*
+     * Minimum wait time reported in a Busy response: how long until the earliest in-progress
+     * handshake is expected to complete or time out.
+     */
+    System::Clock::Milliseconds16 ComputeBusyWaitTime();
 
     /*
      * This will clean up any state from a previous session establishment
-     * attempt (if any) and setup the machinery to listen for and handle
+     * attempt (if any) on the given slot and setup the machinery to listen for and handle
      * any session handshakes there-after.
      *
      * If a session had previously been established successfully, previouslyEstablishedPeer
      * should be set to the scoped node-id of the peer associated with that session.
      *
      */
-    void PrepareForSessionEstablishment(const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
+    void PrepareForSessionEstablishment(HandshakeSlot & slot, const ScopedNodeId & previouslyEstablishedPeer = ScopedNodeId());
 
-    // If we are in the middle of handshake and receive a Sigma1 then respond with Busy status code.
+    // If all handshake slots are in use and we receive a Sigma1 then respond with Busy status code.
     // @param[in] ec              Exchange Context
     // @param[in] minimumWaitTime Minimum wait time reported to client before it can attempt to resend sigma1
     //
@@ -1983,7 +1983,8 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
         {
             MutableByteSpan fabricRCAC{ data.rootCertBuf };
             SuccessOrExit(err = mFabricsTable->FetchRootCert(mFabricIndex, fabricRCAC));
-            data.fabricRCAC = fabricRCAC;
+            data.fabricRCAC     = fabricRCAC;
+            data.certChainCache = mFabricsTable->GetVerifiedCertChainCache();
             // TODO probably should make SetEffectiveTime static and call closer to VerifyCredentials
             SuccessOrExit(err = SetEffectiveTime());
         }
@@ -2103,8 +2104,9 @@ CHIP_ERROR CASESession::HandleSigma3b(HandleSigma3Data & data, bool & cancel)
     CompressedFabricId unused;
     FabricId initiatorFabricId;
     P256PublicKey initiatorPublicKey;
-    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.initiatorNOC, data.initiatorICAC, data.fabricRCAC, data.validContext,
-                                                        unused, initiatorFabricId, data.initiatorNodeId, initiatorPublicKey));
+    ReturnErrorOnFailure(FabricTable::VerifyCredentials(data.certChainCache, data.initiatorNOC, data.initiatorICAC, data.fabricRCAC,
+                                                        data.validContext, unused, initiatorFabricId, data.initiatorNodeId,
+                                                        initiatorPublicKey));
     VerifyOrReturnError(data.fabricId == initiatorFabricId, CHIP_ERROR_INVALID_CASE_PARAMETER);
 
     // Step 7 - Validate Signature
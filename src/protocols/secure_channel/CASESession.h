@@ -184,7 +184,7 @@ public:
         kHandleSigma3Pending = 9,
     };
 
-    State GetState() { return mState; }
+    State GetState() const { return mState; }
 
     // Returns true if the CASE session handshake was stuck due to failing to schedule work on the Matter thread.
     // If this function returns true, the CASE session has been reset and is ready for a new session establishment.
@@ -326,6 +326,9 @@ protected:
         uint8_t rootCertBuf[Credentials::kMaxCHIPCertLength];
         ByteSpan fabricRCAC;
 
+        // Cache of verified chains of the fabric table, which may be used from the background task.
+        Credentials::VerifiedCertChainCache * certChainCache = nullptr;
+
         Crypto::P256ECDSASignature tbsData3Signature;
 
         FabricId fabricId;
@@ -0,0 +1,462 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CachedSessionResumptionStorage.h>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <algorithm>
+
+namespace chip {
+
+namespace {
+
+size_t Mix(uint64_t value)
+{
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdULL;
+    value ^= value >> 33;
+    return static_cast<size_t>(value);
+}
+
+bool SameResumptionId(const SessionResumptionStorage::ResumptionIdStorage & a,
+                      SessionResumptionStorage::ConstResumptionIdView b)
+{
+    return std::equal(a.begin(), a.end(), b.begin(), b.end());
+}
+
+} // namespace
+
+CachedSessionResumptionStorage::CachedSessionResumptionStorage()
+{
+    Clear();
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::Init(PersistentStorageDelegate * storage)
+{
+    ReturnErrorOnFailure(SimpleSessionResumptionStorage::Init(storage));
+    Clear();
+
+    SessionIndex index;
+    ReturnErrorOnFailure(LoadIndex(index));
+
+    // The index lists the peers from the least to the most recently used when written by this class, and in the order they
+    // were added when written by SimpleSessionResumptionStorage.
+    for (size_t i = 0; i < index.mSize; ++i)
+    {
+        const ScopedNodeId & node = index.mNodes[i];
+        ResumptionIdStorage resumptionId;
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+        CATValues peerCATs;
+
+        // Peers removed since the index was last written no longer have a state.
+        if (FindEntry(node) != nullptr || LoadState(node, resumptionId, sharedSecret, peerCATs) != CHIP_NO_ERROR ||
+            FindEntry(resumptionId) != nullptr)
+        {
+            mIndexNeedsWrite = true;
+            continue;
+        }
+
+        AddEntry(node, resumptionId);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                                              Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    Entry * entry = FindEntry(node);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(LoadState(node, resumptionId, sharedSecret, peerCATs));
+    MarkUsed(*entry);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                                              Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs)
+{
+    Entry * entry = FindEntry(resumptionId);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    ResumptionIdStorage storedResumptionId;
+    ReturnErrorOnFailure(LoadState(entry->mNode, storedResumptionId, sharedSecret, peerCATs));
+    VerifyOrReturnError(SameResumptionId(storedResumptionId, resumptionId), CHIP_ERROR_KEY_NOT_FOUND);
+
+    node = entry->mNode;
+    MarkUsed(*entry);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node)
+{
+    Entry * entry = FindEntry(resumptionId);
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    node = entry->mNode;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                                                const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs)
+{
+    Entry * entry = FindEntry(node);
+
+    // Resumption IDs identify a single session; a peer that presents the ID of another one supersedes it.
+    Entry * other = FindEntry(resumptionId);
+    if (other != nullptr && other != entry)
+    {
+        RETURN_SAFELY_IGNORED DeleteFromStorage(*other);
+        RemoveEntry(*other);
+        mIndexNeedsWrite = true;
+    }
+
+    if (entry != nullptr)
+    {
+        // Node already exists in the index. Save in place; the index does not change. Removal of the old
+        // resumption-id-keyed link is best effort, as in DefaultSessionResumptionStorage.
+        if (!SameResumptionId(entry->mResumptionId, resumptionId))
+        {
+            CHIP_ERROR err = DeleteLink(ConstResumptionIdView(entry->mResumptionId));
+            if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+            {
+                ChipLogError(SecureChannel,
+                             "DeleteLink failed; unable to fully delete session resumption record for node " ChipLogFormatX64
+                             ": %" CHIP_ERROR_FORMAT,
+                             ChipLogValueX64(node.GetNodeId()), err.Format());
+            }
+        }
+
+        ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+        ReturnErrorOnFailure(SaveLink(resumptionId, node));
+
+        SetResumptionId(*entry, resumptionId);
+        MarkUsed(*entry);
+        return CHIP_NO_ERROR;
+    }
+
+    if (mCount == kCapacity)
+    {
+        Entry * leastRecentlyUsed = nullptr;
+        for (auto & candidate : mEntries)
+        {
+            if (candidate.mLastUsed != 0 && (leastRecentlyUsed == nullptr || candidate.mLastUsed < leastRecentlyUsed->mLastUsed))
+            {
+                leastRecentlyUsed = &candidate;
+            }
+        }
+
+        RETURN_SAFELY_IGNORED DeleteFromStorage(*leastRecentlyUsed);
+        RemoveEntry(*leastRecentlyUsed);
+        mIndexNeedsWrite = true;
+    }
+
+    ReturnErrorOnFailure(SaveState(node, resumptionId, sharedSecret, peerCATs));
+    ReturnErrorOnFailure(SaveLink(resumptionId, node));
+    AddEntry(node, resumptionId);
+
+    // A new peer is written to the index right away (along with the removals batched so far): if it was not, its state would
+    // be left behind in storage, unreachable, after a reboot.
+    mIndexNeedsWrite = true;
+    return WriteIndex();
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::Delete(const ScopedNodeId & node)
+{
+    Entry * entry = FindEntry(node);
+    if (entry == nullptr)
+    {
+        ChipLogError(SecureChannel, "Unable to find session resumption state for node in index " ChipLogFormatX64,
+                     ChipLogValueX64(node.GetNodeId()));
+        return CHIP_NO_ERROR;
+    }
+
+    RETURN_SAFELY_IGNORED DeleteFromStorage(*entry);
+    RemoveEntry(*entry);
+
+    // The removal is written with the next index write: until then, Init() skips the node, whose state is gone.
+    mIndexNeedsWrite = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::DeleteAll(FabricIndex fabricIndex)
+{
+    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
+    bool found           = false;
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.mLastUsed == 0 || entry.mNode.GetFabricIndex() != fabricIndex)
+        {
+            continue;
+        }
+
+        CHIP_ERROR err = DeleteFromStorage(entry);
+        stickyErr      = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        RemoveEntry(entry);
+        found = true;
+    }
+
+    if (found)
+    {
+        // The fabric index may be reused right away, so the index is written now.
+        mIndexNeedsWrite = true;
+        CHIP_ERROR err   = WriteIndex();
+        stickyErr        = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SecureChannel,
+                         "Unable to save session resumption index during attempted deletion of fabric index %u: "
+                         "%" CHIP_ERROR_FORMAT,
+                         fabricIndex, err.Format());
+        }
+    }
+
+    return stickyErr;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::FlushIndex()
+{
+    VerifyOrReturnError(mIndexNeedsWrite, CHIP_NO_ERROR);
+    return WriteIndex();
+}
+
+size_t CachedSessionResumptionStorage::HashNode(const ScopedNodeId & node)
+{
+    return Mix(node.GetNodeId() + node.GetFabricIndex() * 0x9e3779b97f4a7c15ULL);
+}
+
+size_t CachedSessionResumptionStorage::HashResumptionId(const uint8_t * resumptionId)
+{
+    static_assert(kResumptionIdSize == 2 * sizeof(uint64_t), "resumption IDs are hashed as two 64-bit words");
+    return Mix(Encoding::LittleEndian::Get64(resumptionId) ^ Encoding::LittleEndian::Get64(resumptionId + sizeof(uint64_t)));
+}
+
+CachedSessionResumptionStorage::Entry * CachedSessionResumptionStorage::FindEntry(const ScopedNodeId & node)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+
+    // Linear probing; the tables are at most half full, so an empty bucket ends every probe sequence.
+    for (size_t i = HashNode(node) & kMask;; i = (i + 1) & kMask)
+    {
+        uint16_t entryIndex = mNodeBuckets[i];
+        if (entryIndex == kEmptyBucket)
+        {
+            return nullptr;
+        }
+        if (mEntries[entryIndex].mNode == node)
+        {
+            return &mEntries[entryIndex];
+        }
+    }
+}
+
+CachedSessionResumptionStorage::Entry * CachedSessionResumptionStorage::FindEntry(ConstResumptionIdView resumptionId)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+
+    for (size_t i = HashResumptionId(resumptionId.data()) & kMask;; i = (i + 1) & kMask)
+    {
+        uint16_t entryIndex = mResumptionIdBuckets[i];
+        if (entryIndex == kEmptyBucket)
+        {
+            return nullptr;
+        }
+        if (SameResumptionId(mEntries[entryIndex].mResumptionId, resumptionId))
+        {
+            return &mEntries[entryIndex];
+        }
+    }
+}
+
+CachedSessionResumptionStorage::Entry * CachedSessionResumptionStorage::AddEntry(const ScopedNodeId & node,
+                                                                                 ConstResumptionIdView resumptionId)
+{
+    VerifyOrDie(mCount < kCapacity);
+
+    uint16_t entryIndex = 0;
+    while (mEntries[entryIndex].mLastUsed != 0)
+    {
+        entryIndex++;
+    }
+
+    Entry & entry = mEntries[entryIndex];
+    entry.mNode   = node;
+    std::copy(resumptionId.begin(), resumptionId.end(), entry.mResumptionId.begin());
+    MarkUsed(entry);
+    mCount++;
+
+    InsertBucket(/* byNode = */ true, entryIndex);
+    InsertBucket(/* byNode = */ false, entryIndex);
+    return &entry;
+}
+
+void CachedSessionResumptionStorage::RemoveEntry(Entry & entry)
+{
+    uint16_t entryIndex = static_cast<uint16_t>(&entry - mEntries);
+
+    RemoveBucket(/* byNode = */ true, entryIndex);
+    RemoveBucket(/* byNode = */ false, entryIndex);
+
+    entry.mLastUsed = 0;
+    mCount--;
+}
+
+void CachedSessionResumptionStorage::SetResumptionId(Entry & entry, ConstResumptionIdView resumptionId)
+{
+    uint16_t entryIndex = static_cast<uint16_t>(&entry - mEntries);
+
+    RemoveBucket(/* byNode = */ false, entryIndex);
+    std::copy(resumptionId.begin(), resumptionId.end(), entry.mResumptionId.begin());
+    InsertBucket(/* byNode = */ false, entryIndex);
+}
+
+void CachedSessionResumptionStorage::MarkUsed(Entry & entry)
+{
+    if (mUseCount == UINT32_MAX)
+    {
+        // Renumber the uses rather than let the use counts wrap around, which only happens after billions of uses.
+        uint16_t order[kCapacity];
+        size_t count = SortByLastUse(order);
+        for (size_t i = 0; i < count; ++i)
+        {
+            mEntries[order[i]].mLastUsed = static_cast<uint32_t>(i + 1);
+        }
+        mUseCount = static_cast<uint32_t>(count);
+    }
+
+    entry.mLastUsed = ++mUseCount;
+}
+
+void CachedSessionResumptionStorage::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.mLastUsed = 0;
+    }
+    std::fill(std::begin(mNodeBuckets), std::end(mNodeBuckets), kEmptyBucket);
+    std::fill(std::begin(mResumptionIdBuckets), std::end(mResumptionIdBuckets), kEmptyBucket);
+    mCount           = 0;
+    mUseCount        = 0;
+    mIndexNeedsWrite = false;
+}
+
+size_t CachedSessionResumptionStorage::BucketHash(uint16_t entryIndex, bool byNode) const
+{
+    const Entry & entry = mEntries[entryIndex];
+    return byNode ? HashNode(entry.mNode) : HashResumptionId(entry.mResumptionId.data());
+}
+
+void CachedSessionResumptionStorage::InsertBucket(bool byNode, uint16_t entryIndex)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+    uint16_t * buckets     = byNode ? mNodeBuckets : mResumptionIdBuckets;
+
+    size_t i = BucketHash(entryIndex, byNode) & kMask;
+    while (buckets[i] != kEmptyBucket)
+    {
+        i = (i + 1) & kMask;
+    }
+    buckets[i] = entryIndex;
+}
+
+void CachedSessionResumptionStorage::RemoveBucket(bool byNode, uint16_t entryIndex)
+{
+    constexpr size_t kMask = kBucketCount - 1;
+    uint16_t * buckets     = byNode ? mNodeBuckets : mResumptionIdBuckets;
+
+    size_t hole = BucketHash(entryIndex, byNode) & kMask;
+    while (buckets[hole] != entryIndex)
+    {
+        VerifyOrDie(buckets[hole] != kEmptyBucket);
+        hole = (hole + 1) & kMask;
+    }
+
+    // Move the following entries of the probe sequence back into the hole, so that lookups can still stop at the first
+    // empty bucket. An entry can move back unless its home bucket is in the (cyclic) range (hole, i].
+    for (size_t i = (hole + 1) & kMask; buckets[i] != kEmptyBucket; i = (i + 1) & kMask)
+    {
+        size_t home      = BucketHash(buckets[i], byNode) & kMask;
+        bool homeInRange = (hole <= i) ? (hole < home && home <= i) : (hole < home || home <= i);
+        if (!homeInRange)
+        {
+            buckets[hole] = buckets[i];
+            hole          = i;
+        }
+    }
+    buckets[hole] = kEmptyBucket;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::DeleteFromStorage(const Entry & entry)
+{
+    CHIP_ERROR stickyErr = CHIP_NO_ERROR;
+
+    CHIP_ERROR err = DeleteLink(ConstResumptionIdView(entry.mResumptionId));
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Unable to delete session resumption link for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(entry.mNode.GetNodeId()), err.Format());
+        stickyErr = err;
+    }
+
+    err = DeleteState(entry.mNode);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(SecureChannel, "Unable to delete session resumption state for node " ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(entry.mNode.GetNodeId()), err.Format());
+        stickyErr = stickyErr == CHIP_NO_ERROR ? err : stickyErr;
+    }
+
+    return stickyErr;
+}
+
+size_t CachedSessionResumptionStorage::SortByLastUse(uint16_t (&order)[kCapacity]) const
+{
+    size_t count = 0;
+    for (uint16_t entryIndex = 0; entryIndex < kCapacity; ++entryIndex)
+    {
+        if (mEntries[entryIndex].mLastUsed != 0)
+        {
+            order[count++] = entryIndex;
+        }
+    }
+
+    std::sort(order, order + count, [this](uint16_t a, uint16_t b) { return mEntries[a].mLastUsed < mEntries[b].mLastUsed; });
+    return count;
+}
+
+CHIP_ERROR CachedSessionResumptionStorage::WriteIndex()
+{
+    uint16_t order[kCapacity];
+    size_t count = SortByLastUse(order);
+
+    SessionIndex index;
+    for (size_t i = 0; i < count; ++i)
+    {
+        index.mNodes[i] = mEntries[order[i]].mNode;
+    }
+    index.mSize = count;
+
+    ReturnErrorOnFailure(SaveIndex(index));
+    mIndexNeedsWrite = false;
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+
+namespace detail {
+constexpr size_t ResumptionBucketCount(size_t capacity, size_t count = 1)
+{
+    return (count >= 2 * capacity) ? count : ResumptionBucketCount(capacity, 2 * count);
+}
+} // namespace detail
+
+/**
+ * @brief A SimpleSessionResumptionStorage that keeps the index of the stored sessions in RAM, for session resumption with many
+ *   peers (e.g. on a controller).
+ *
+ *   The <FabricIndex, PeerNodeId> and <ResumptionId> of every stored session are kept in two hash tables, so that looking up a
+ *   session takes a single storage read (of its state), and none when it is not stored. Saving a session for a known peer does
+ *   not read the index from storage either.
+ *
+ *   When full, the least recently used session (saved or looked up) is replaced, instead of the oldest saved one.
+ *
+ *   The storage layout is the one of SimpleSessionResumptionStorage, which can read what this class stored and vice versa.
+ *   The index is written to storage when a peer is added, and the removals of peers are batched into the next write (or
+ *   FlushIndex()): a stored index that still lists removed peers is fixed up by Init().
+ *
+ *   A controller uses it by passing an initialized instance as FactoryInitParams::sessionResumptionStorage.
+ */
+class CachedSessionResumptionStorage : public SimpleSessionResumptionStorage
+{
+public:
+    static constexpr size_t kCapacity = CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE;
+
+    CachedSessionResumptionStorage();
+
+    /**
+     * Loads the index from storage.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage) override;
+
+    CHIP_ERROR FindByScopedNodeId(const ScopedNodeId & node, ResumptionIdStorage & resumptionId,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR FindByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node,
+                                  Crypto::P256ECDHDerivedSecret & sharedSecret, CATValues & peerCATs) override;
+    CHIP_ERROR FindNodeByResumptionId(ConstResumptionIdView resumptionId, ScopedNodeId & node) override;
+    CHIP_ERROR Save(const ScopedNodeId & node, ConstResumptionIdView resumptionId,
+                    const Crypto::P256ECDHDerivedSecret & sharedSecret, const CATValues & peerCATs) override;
+    CHIP_ERROR Delete(const ScopedNodeId & node) override;
+    CHIP_ERROR DeleteAll(FabricIndex fabricIndex) override;
+
+    /**
+     * Writes the index to storage if peers were removed since it was last written.
+     */
+    CHIP_ERROR FlushIndex();
+
+    /**
+     * Returns the number of stored sessions.
+     */
+    size_t Count() const { return mCount; }
+
+private:
+    static_assert(kCapacity > 0 && kCapacity < UINT16_MAX, "entries are referenced by 16-bit indexes");
+
+    // Power of two, at least twice the capacity to keep the probe sequences short.
+    static constexpr size_t kBucketCount   = detail::ResumptionBucketCount(kCapacity);
+    static constexpr uint16_t kEmptyBucket = UINT16_MAX;
+
+    struct Entry
+    {
+        ScopedNodeId mNode;
+        ResumptionIdStorage mResumptionId;
+        uint32_t mLastUsed = 0; // 0 if the entry is free
+    };
+
+    static size_t HashNode(const ScopedNodeId & node);
+    static size_t HashResumptionId(const uint8_t * resumptionId);
+
+    Entry * FindEntry(const ScopedNodeId & node);
+    Entry * FindEntry(ConstResumptionIdView resumptionId);
+    Entry * AddEntry(const ScopedNodeId & node, ConstResumptionIdView resumptionId);
+    void RemoveEntry(Entry & entry);
+    void SetResumptionId(Entry & entry, ConstResumptionIdView resumptionId);
+    void MarkUsed(Entry & entry);
+
+    void Clear();
+
+    size_t BucketHash(uint16_t entryIndex, bool byNode) const;
+    void InsertBucket(bool byNode, uint16_t entryIndex);
+    void RemoveBucket(bool byNode, uint16_t entryIndex);
+
+    // Removes the link and state of a session from storage, logging failures.
+    CHIP_ERROR DeleteFromStorage(const Entry & entry);
+
+    // Sorts the indexes of the used entries from the least to the most recently used, returning their count.
+    size_t SortByLastUse(uint16_t (&order)[kCapacity]) const;
+
+    CHIP_ERROR WriteIndex();
+
+    Entry mEntries[kCapacity];
+    uint16_t mNodeBuckets[kBucketCount];
+    uint16_t mResumptionIdBuckets[kBucketCount];
+    size_t mCount         = 0;
+    uint32_t mUseCount    = 0;
+    bool mIndexNeedsWrite = false;
+};
+
+} // namespace chip
@@ -36,7 +36,7 @@ namespace chip {
 class SimpleSessionResumptionStorage : public DefaultSessionResumptionStorage
 {
 public:
-    CHIP_ERROR Init(PersistentStorageDelegate * storage)
+    virtual CHIP_ERROR Init(PersistentStorageDelegate * storage)
     {
         VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
         mStorage = storage;
@@ -599,12 +599,12 @@ TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
 
 TEST_F(TestCASESession, ClientReceivesBusyTest)
 {
-    TemporarySessionManager sessionManager(*this);
-    TestCASESecurePairingDelegate delegateCommissioner1, delegateCommissioner2;
-    CASESession pairingCommissioner1, pairingCommissioner2;
+    // One more initiator than the server has handshake slots: all but the last one get a slot.
+    constexpr size_t kInitiators = CASEServer::kMaxConcurrentHandshakes + 1;
 
-    pairingCommissioner1.SetGroupDataProvider(&gCommissionerGroupDataProvider);
-    pairingCommissioner2.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioners[kInitiators];
+    CASESession pairingCommissioners[kInitiators];
 
     auto & loopback            = GetLoopback();
     loopback.mSentMessageCount = 0;
@@ -612,37 +612,226 @@ TEST_F(TestCASESession, ClientReceivesBusyTest)
     EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
                                                            nullptr, nullptr, &gDeviceGroupDataProvider),
               CHIP_NO_ERROR);
+    gPairingServer.ResetStatistics();
+
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        pairingCommissioners[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioners[i]);
+        EXPECT_SUCCESS(pairingCommissioners[i].EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                                ScopedNodeId{ Node01_01, gCommissionerFabricIndex },
+                                                                contextCommissioner, nullptr, nullptr, &delegateCommissioners[i],
+                                                                NullOptional));
+    }
+
+    ServiceEvents();
+
+    // We should have one full handshake per handshake slot and one Sigma1 + Busy + ack.
+    EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount * CASEServer::kMaxConcurrentHandshakes + 3);
+    for (size_t i = 0; i < kInitiators - 1; i++)
+    {
+        EXPECT_EQ(delegateCommissioners[i].mNumPairingComplete, 1u);
+        EXPECT_EQ(delegateCommissioners[i].mNumPairingErrors, 0u);
+        EXPECT_EQ(delegateCommissioners[i].mNumBusyResponses, 0u);
+    }
+    EXPECT_EQ(delegateCommissioners[kInitiators - 1].mNumPairingComplete, 0u);
+    EXPECT_EQ(delegateCommissioners[kInitiators - 1].mNumPairingErrors, 1u);
+    EXPECT_EQ(delegateCommissioners[kInitiators - 1].mNumBusyResponses, 1u);
 
-    ExchangeContext * contextCommissioner1 = NewUnauthenticatedExchangeToBob(&pairingCommissioner1);
-    ExchangeContext * contextCommissioner2 = NewUnauthenticatedExchangeToBob(&pairingCommissioner2);
+    EXPECT_EQ(gPairingServer.GetStatistics().sigma1Admitted, CASEServer::kMaxConcurrentHandshakes);
+    EXPECT_EQ(gPairingServer.GetStatistics().sigma1Busy, 1u);
+    EXPECT_EQ(gPairingServer.GetStatistics().peakConcurrentHandshakes, CASEServer::kMaxConcurrentHandshakes);
+    EXPECT_EQ(gPairingServer.GetActiveHandshakeCount(), 0u);
 
-    EXPECT_EQ(pairingCommissioner1.EstablishSession(sessionManager, &gCommissionerFabrics,
-                                                    ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner1,
-                                                    nullptr, nullptr, &delegateCommissioner1, NullOptional),
+    gPairingServer.Shutdown();
+}
+
+#if CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES > 1
+
+TEST_F(TestCASESession, InterleavedHandshakesServerTest)
+{
+    constexpr size_t kInitiators = 2;
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioners[kInitiators];
+    CASESession pairingCommissioners[kInitiators];
+
+    auto & loopback            = GetLoopback();
+    loopback.mSentMessageCount = 0;
+
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
               CHIP_NO_ERROR);
-    EXPECT_SUCCESS(pairingCommissioner2.EstablishSession(sessionManager, &gCommissionerFabrics,
-                                                         ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner2,
-                                                         nullptr, nullptr, &delegateCommissioner2, NullOptional));
+    gPairingServer.ResetStatistics();
+
+    // Each slot tells its initiator the session id it reserved, in Sigma2.
+    uint16_t slotSessionIds[kInitiators];
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        ASSERT_TRUE(gPairingServer.GetSession(i).GetLocalSessionId().HasValue());
+        slotSessionIds[i] = gPairingServer.GetSession(i).GetLocalSessionId().Value();
+    }
+    EXPECT_NE(slotSessionIds[0], slotSessionIds[1]);
+
+    // Both Sigma1 are queued before the server handles either, so the two handshakes proceed message by message in
+    // lockstep: slot 1 receives its Sigma3 while slot 0 is handling the Sigma3 of the other initiator.
+    uint16_t initiatorSessionIds[kInitiators];
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        pairingCommissioners[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+        ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioners[i]);
+        EXPECT_SUCCESS(pairingCommissioners[i].EstablishSession(sessionManager, &gCommissionerFabrics,
+                                                                ScopedNodeId{ Node01_01, gCommissionerFabricIndex },
+                                                                contextCommissioner, nullptr, nullptr, &delegateCommissioners[i],
+                                                                NullOptional));
+        ASSERT_TRUE(pairingCommissioners[i].GetLocalSessionId().HasValue());
+        initiatorSessionIds[i] = pairingCommissioners[i].GetLocalSessionId().Value();
+    }
 
     ServiceEvents();
 
-    // We should have one full handshake and one Sigma1 + Busy + ack.  If that
-    // ever changes (e.g. because our server starts supporting multiple parallel
-    // handshakes), this test needs to be fixed so that the server is still
-    // responding BUSY to the client.
-    EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount + 3);
-    EXPECT_EQ(delegateCommissioner1.mNumPairingComplete, 1u);
-    EXPECT_EQ(delegateCommissioner2.mNumPairingComplete, 0u);
+    EXPECT_EQ(loopback.mSentMessageCount, sTestCaseMessageCount * kInitiators);
+    EXPECT_EQ(gPairingServer.GetStatistics().sigma1Admitted, kInitiators);
+    EXPECT_EQ(gPairingServer.GetStatistics().sigma1Busy, 0u);
+    EXPECT_EQ(gPairingServer.GetStatistics().peakConcurrentHandshakes, kInitiators);
 
-    EXPECT_EQ(delegateCommissioner1.mNumPairingErrors, 0u);
-    EXPECT_EQ(delegateCommissioner2.mNumPairingErrors, 1u);
+    for (size_t i = 0; i < kInitiators; i++)
+    {
+        EXPECT_EQ(delegateCommissioners[i].mNumPairingComplete, 1u);
+        EXPECT_EQ(delegateCommissioners[i].mNumPairingErrors, 0u);
+
+        // Slot i admitted the Sigma1 of initiator i, and the responder only activates the session of slot i once that
+        // slot has validated a Sigma3 of the same initiator.
+        auto responderSession = GetSecureSessionManager().GetSecureSessions().FindSecureSessionByLocalKey(slotSessionIds[i]);
+        ASSERT_TRUE(responderSession.HasValue());
+        EXPECT_TRUE(responderSession.Value()->AsSecureSession()->IsActiveSession());
+        EXPECT_EQ(responderSession.Value()->AsSecureSession()->GetPeerSessionId(), initiatorSessionIds[i]);
+
+        auto initiatorSession =
+            static_cast<SessionManager &>(sessionManager).GetSecureSessions().FindSecureSessionByLocalKey(initiatorSessionIds[i]);
+        ASSERT_TRUE(initiatorSession.HasValue());
+        EXPECT_TRUE(initiatorSession.Value()->AsSecureSession()->IsActiveSession());
+        EXPECT_EQ(initiatorSession.Value()->AsSecureSession()->GetPeerSessionId(), slotSessionIds[i]);
+    }
+    EXPECT_EQ(gPairingServer.GetActiveHandshakeCount(), 0u);
 
-    EXPECT_EQ(delegateCommissioner1.mNumBusyResponses, 0u);
-    EXPECT_EQ(delegateCommissioner2.mNumBusyResponses, 1u);
+    gPairingServer.Shutdown();
+}
+
+#endif // CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES > 1
+
+// Benchmark: a burst of initiators sends Sigma1 at the same time, and every initiator that is answered with
+// Busy retries in the next round. Reports the number of rounds and the time until all sessions are established,
+// which scales with CHIP_CONFIG_CASE_SERVER_MAX_CONCURRENT_HANDSHAKES.
+TEST_F(TestCASESession, BenchmarkConcurrentHandshakes)
+{
+    constexpr size_t kInitiators = 8;
+
+    TemporarySessionManager sessionManager(*this);
+
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
+              CHIP_NO_ERROR);
+    gPairingServer.ResetStatistics();
+
+    size_t established = 0;
+    size_t rounds      = 0;
+
+    const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    while (established < kInitiators && rounds < kInitiators)
+    {
+        const size_t pending = kInitiators - established;
+        TestCASESecurePairingDelegate delegateCommissioners[kInitiators];
+        CASESession pairingCommissioners[kInitiators];
+
+        for (size_t i = 0; i < pending; i++)
+        {
+            pairingCommissioners[i].SetGroupDataProvider(&gCommissionerGroupDataProvider);
+            ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioners[i]);
+            EXPECT_SUCCESS(pairingCommissioners[i].EstablishSession(
+                sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                nullptr, nullptr, &delegateCommissioners[i], NullOptional));
+        }
+
+        ServiceEvents();
+
+        for (size_t i = 0; i < pending; i++)
+        {
+            established += delegateCommissioners[i].mNumPairingComplete;
+        }
+        rounds++;
+    }
+    const System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    const auto & stats = gPairingServer.GetStatistics();
+    ChipLogProgress(Test, "%u concurrent Sigma1 with %u handshake slots: %u rounds, %u busy, peak %u, %u us until all established",
+                    static_cast<unsigned>(kInitiators), static_cast<unsigned>(CASEServer::kMaxConcurrentHandshakes),
+                    static_cast<unsigned>(rounds), static_cast<unsigned>(stats.sigma1Busy),
+                    static_cast<unsigned>(stats.peakConcurrentHandshakes), static_cast<unsigned>(elapsed.count()));
+
+    EXPECT_EQ(established, kInitiators);
+    EXPECT_EQ(stats.sigma1Admitted, kInitiators);
+    EXPECT_LE(stats.peakConcurrentHandshakes, CASEServer::kMaxConcurrentHandshakes);
+
+    gPairingServer.Shutdown();
+}
+
+#if CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
+// Benchmark: sequential CASE handshakes between the same two nodes, with the verified certificate chain caches of
+// both fabric tables emptied before every handshake, and then kept. Reports the time per handshake.
+TEST_F(TestCASESession, BenchmarkHandshakesWithCertChainCache)
+{
+    constexpr unsigned kHandshakes = 20;
+
+    TemporarySessionManager sessionManager(*this);
+
+    EXPECT_EQ(gPairingServer.ListenForSessionEstablishment(&GetExchangeManager(), &GetSecureSessionManager(), &gDeviceFabrics,
+                                                           nullptr, nullptr, &gDeviceGroupDataProvider),
+              CHIP_NO_ERROR);
+
+    auto runHandshakes = [&](bool keepCache) {
+        gCommissionerFabrics.ClearVerifiedCertChainCache();
+        gDeviceFabrics.ClearVerifiedCertChainCache();
+
+        const System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (unsigned i = 0; i < kHandshakes; i++)
+        {
+            if (!keepCache)
+            {
+                gCommissionerFabrics.ClearVerifiedCertChainCache();
+                gDeviceFabrics.ClearVerifiedCertChainCache();
+            }
+
+            TestCASESecurePairingDelegate delegateCommissioner;
+            CASESession pairingCommissioner;
+            pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+            ExchangeContext * contextCommissioner = NewUnauthenticatedExchangeToBob(&pairingCommissioner);
+            EXPECT_SUCCESS(pairingCommissioner.EstablishSession(
+                sessionManager, &gCommissionerFabrics, ScopedNodeId{ Node01_01, gCommissionerFabricIndex }, contextCommissioner,
+                nullptr, nullptr, &delegateCommissioner, NullOptional));
+
+            ServiceEvents();
+
+            EXPECT_EQ(delegateCommissioner.mNumPairingComplete, 1u);
+        }
+        return (System::SystemClock().GetMonotonicMicroseconds64() - start).count() / kHandshakes;
+    };
+
+    const uint64_t uncachedUs = runHandshakes(/* keepCache = */ false);
+    const uint64_t cachedUs   = runHandshakes(/* keepCache = */ true);
+
+    ChipLogProgress(Test, "CASE handshake: %u us without the certificate chain cache, %u us with it",
+                    static_cast<unsigned>(uncachedUs), static_cast<unsigned>(cachedUs));
+
+    EXPECT_GT(gDeviceFabrics.GetVerifiedCertChainCache()->Count(), 0u);
+    EXPECT_GT(gCommissionerFabrics.GetVerifiedCertChainCache()->Count(), 0u);
 
     gPairingServer.Shutdown();
 }
 
+#endif // CHIP_CONFIG_VERIFIED_CERT_CHAIN_CACHE_SIZE > 0
+
 #if CHIP_WITH_NLFAULTINJECTION
 
 /* This tests that Corrupting Signature during a CASE Handshake will lead to CASE Failing and to the Correct Error returned.
@@ -0,0 +1,399 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CountingPersistentStorageDelegate.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <protocols/secure_channel/CachedSessionResumptionStorage.h>
+#include <system/SystemClock.h>
+
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kCapacity = CachedSessionResumptionStorage::kCapacity;
+
+struct SessionVector
+{
+    SessionResumptionStorage::ResumptionIdStorage resumptionId;
+    Crypto::P256ECDHDerivedSecret sharedSecret;
+    ScopedNodeId node;
+    CATValues cats;
+};
+
+std::vector<SessionVector> MakeVectors(size_t count, FabricIndex fabricIndex = 1)
+{
+    std::vector<SessionVector> vectors(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto & vector = vectors[i];
+        EXPECT_SUCCESS(Crypto::DRBG_get_bytes(vector.resumptionId.data(), vector.resumptionId.size()));
+        // Set the first bytes to our index to ensure uniqueness for the FindByResumptionId call.
+        vector.resumptionId[0] = static_cast<uint8_t>(i);
+        vector.resumptionId[1] = static_cast<uint8_t>(i >> 8);
+        vector.resumptionId[2] = fabricIndex;
+        EXPECT_SUCCESS(vector.sharedSecret.SetLength(vector.sharedSecret.Capacity()));
+        EXPECT_SUCCESS(Crypto::DRBG_get_bytes(vector.sharedSecret.Bytes(), vector.sharedSecret.Length()));
+        vector.node           = ScopedNodeId(static_cast<NodeId>(i + 1), fabricIndex);
+        vector.cats.values[0] = static_cast<CASEAuthTag>(rand());
+    }
+    return vectors;
+}
+
+CHIP_ERROR SaveVector(SessionResumptionStorage & sessionStorage, const SessionVector & vector)
+{
+    return sessionStorage.Save(vector.node, vector.resumptionId, vector.sharedSecret, vector.cats);
+}
+
+void ExpectFound(SessionResumptionStorage & sessionStorage, const SessionVector & vector)
+{
+    ScopedNodeId outNode;
+    SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    Crypto::P256ECDHDerivedSecret outSharedSecret;
+    CATValues outCats;
+
+    EXPECT_SUCCESS(sessionStorage.FindByScopedNodeId(vector.node, outResumptionId, outSharedSecret, outCats));
+    EXPECT_EQ(outResumptionId, vector.resumptionId);
+    EXPECT_EQ(memcmp(vector.sharedSecret.ConstBytes(), outSharedSecret.ConstBytes(), vector.sharedSecret.Length()), 0);
+    EXPECT_EQ(vector.cats, outCats);
+
+    EXPECT_SUCCESS(sessionStorage.FindByResumptionId(vector.resumptionId, outNode, outSharedSecret, outCats));
+    EXPECT_EQ(outNode, vector.node);
+    EXPECT_EQ(memcmp(vector.sharedSecret.ConstBytes(), outSharedSecret.ConstBytes(), vector.sharedSecret.Length()), 0);
+    EXPECT_EQ(vector.cats, outCats);
+}
+
+void ExpectNotFound(SessionResumptionStorage & sessionStorage, const SessionVector & vector)
+{
+    ScopedNodeId outNode;
+    SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    Crypto::P256ECDHDerivedSecret outSharedSecret;
+    CATValues outCats;
+
+    EXPECT_NE(sessionStorage.FindByScopedNodeId(vector.node, outResumptionId, outSharedSecret, outCats), CHIP_NO_ERROR);
+    EXPECT_NE(sessionStorage.FindByResumptionId(vector.resumptionId, outNode, outSharedSecret, outCats), CHIP_NO_ERROR);
+}
+
+// Also counts the writes of the session resumption index.
+class CountingStorage : public CountingPersistentStorageDelegate
+{
+public:
+    size_t mIndexWrites = 0;
+
+protected:
+    CHIP_ERROR SyncSetKeyValueInternal(const char * key, const void * value, uint16_t size) override
+    {
+        if (strcmp(key, DefaultStorageKeyAllocator::SessionResumptionIndex().KeyName()) == 0)
+        {
+            mIndexWrites++;
+        }
+        return CountingPersistentStorageDelegate::SyncSetKeyValueInternal(key, value, size);
+    }
+};
+
+TEST(TestCachedSessionResumptionStorage, TestSaveAndFind)
+{
+    TestPersistentStorageDelegate storage;
+    auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+    EXPECT_SUCCESS(sessionStorage->Init(&storage));
+
+    auto vectors = MakeVectors(kCapacity + 1);
+    for (size_t i = 0; i < kCapacity; ++i)
+    {
+        EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[i]));
+    }
+    EXPECT_EQ(sessionStorage->Count(), kCapacity);
+
+    for (size_t i = 0; i < kCapacity; ++i)
+    {
+        ExpectFound(*sessionStorage, vectors[i]);
+
+        ScopedNodeId node;
+        EXPECT_SUCCESS(sessionStorage->FindNodeByResumptionId(vectors[i].resumptionId, node));
+        EXPECT_EQ(node, vectors[i].node);
+    }
+
+    ScopedNodeId outNode;
+    SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+    Crypto::P256ECDHDerivedSecret outSharedSecret;
+    CATValues outCats;
+    EXPECT_EQ(sessionStorage->FindByScopedNodeId(vectors[kCapacity].node, outResumptionId, outSharedSecret, outCats),
+              CHIP_ERROR_KEY_NOT_FOUND);
+    EXPECT_EQ(sessionStorage->FindByResumptionId(vectors[kCapacity].resumptionId, outNode, outSharedSecret, outCats),
+              CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST(TestCachedSessionResumptionStorage, TestLeastRecentlyUsedIsReplaced)
+{
+    TestPersistentStorageDelegate storage;
+    auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+    EXPECT_SUCCESS(sessionStorage->Init(&storage));
+
+    auto vectors = MakeVectors(kCapacity + 1);
+    for (size_t i = 0; i < kCapacity; ++i)
+    {
+        EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[i]));
+    }
+
+    // Looking up the oldest session makes the second oldest one the least recently used.
+    ScopedNodeId outNode;
+    Crypto::P256ECDHDerivedSecret outSharedSecret;
+    CATValues outCats;
+    EXPECT_SUCCESS(sessionStorage->FindByResumptionId(vectors[0].resumptionId, outNode, outSharedSecret, outCats));
+
+    EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[kCapacity]));
+    EXPECT_EQ(sessionStorage->Count(), kCapacity);
+
+    ExpectFound(*sessionStorage, vectors[0]);
+    ExpectFound(*sessionStorage, vectors[kCapacity]);
+    if (kCapacity > 1)
+    {
+        ExpectNotFound(*sessionStorage, vectors[1]);
+
+        // The replaced session is removed from storage.
+        SimpleSessionResumptionStorage simpleStorage;
+        EXPECT_SUCCESS(simpleStorage.Init(&storage));
+        ExpectNotFound(simpleStorage, vectors[1]);
+    }
+}
+
+TEST(TestCachedSessionResumptionStorage, TestIndexWritesAreBatched)
+{
+    CountingStorage storage;
+    auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+    EXPECT_SUCCESS(sessionStorage->Init(&storage));
+
+    auto vectors = MakeVectors(3);
+
+    // Adding a peer writes the index.
+    EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[0]));
+    EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[1]));
+    EXPECT_EQ(storage.mIndexWrites, 2u);
+
+    // Saving a new session for a known peer does not.
+    for (int i = 0; i < 5; ++i)
+    {
+        SessionVector stale   = vectors[0];
+        SessionVector updated = vectors[0];
+        EXPECT_SUCCESS(Crypto::DRBG_get_bytes(updated.resumptionId.data(), updated.resumptionId.size()));
+        EXPECT_SUCCESS(SaveVector(*sessionStorage, updated));
+        ExpectFound(*sessionStorage, updated);
+
+        stale.node = ScopedNodeId();
+        ExpectNotFound(*sessionStorage, stale);
+        vectors[0] = updated;
+    }
+    EXPECT_EQ(storage.mIndexWrites, 2u);
+
+    // Removing a peer is batched with the next write.
+    EXPECT_SUCCESS(sessionStorage->Delete(vectors[1].node));
+    ExpectNotFound(*sessionStorage, vectors[1]);
+    EXPECT_EQ(storage.mIndexWrites, 2u);
+
+    // Until then, the stored index still lists the removed peer, which a reload skips.
+    {
+        auto reloaded = std::make_unique<CachedSessionResumptionStorage>();
+        EXPECT_SUCCESS(reloaded->Init(&storage));
+        EXPECT_EQ(reloaded->Count(), 1u);
+        ExpectFound(*reloaded, vectors[0]);
+        ExpectNotFound(*reloaded, vectors[1]);
+    }
+
+    EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[2]));
+    EXPECT_EQ(storage.mIndexWrites, 3u);
+
+    EXPECT_SUCCESS(sessionStorage->Delete(vectors[2].node));
+    EXPECT_SUCCESS(sessionStorage->FlushIndex());
+    EXPECT_EQ(storage.mIndexWrites, 4u);
+    EXPECT_SUCCESS(sessionStorage->FlushIndex());
+    EXPECT_EQ(storage.mIndexWrites, 4u);
+
+    DefaultSessionResumptionStorage::SessionIndex index;
+    EXPECT_SUCCESS(sessionStorage->LoadIndex(index));
+    EXPECT_EQ(index.mSize, 1u);
+    EXPECT_EQ(index.mNodes[0], vectors[0].node);
+}
+
+TEST(TestCachedSessionResumptionStorage, TestStorageIsCompatibleWithSimpleSessionResumptionStorage)
+{
+    TestPersistentStorageDelegate storage;
+    auto vectors = MakeVectors(kCapacity);
+
+    // Sessions saved by SimpleSessionResumptionStorage are found by CachedSessionResumptionStorage...
+    {
+        SimpleSessionResumptionStorage simpleStorage;
+        EXPECT_SUCCESS(simpleStorage.Init(&storage));
+        for (size_t i = 0; i < kCapacity / 2; ++i)
+        {
+            EXPECT_SUCCESS(SaveVector(simpleStorage, vectors[i]));
+        }
+    }
+
+    auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+    EXPECT_SUCCESS(sessionStorage->Init(&storage));
+    EXPECT_EQ(sessionStorage->Count(), kCapacity / 2);
+    for (size_t i = kCapacity / 2; i < kCapacity; ++i)
+    {
+        EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[i]));
+    }
+
+    // ... and the other way around.
+    SimpleSessionResumptionStorage simpleStorage;
+    EXPECT_SUCCESS(simpleStorage.Init(&storage));
+    for (const auto & vector : vectors)
+    {
+        ExpectFound(*sessionStorage, vector);
+        ExpectFound(simpleStorage, vector);
+    }
+}
+
+TEST(TestCachedSessionResumptionStorage, TestDeleteAll)
+{
+    TestPersistentStorageDelegate storage;
+    auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+    EXPECT_SUCCESS(sessionStorage->Init(&storage));
+
+    auto vectors1 = MakeVectors(kCapacity / 3, 1);
+    auto vectors2 = MakeVectors(kCapacity / 3, 2);
+    for (size_t i = 0; i < vectors1.size(); ++i)
+    {
+        EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors1[i]));
+        EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors2[i]));
+    }
+
+    EXPECT_SUCCESS(sessionStorage->DeleteAll(1));
+    EXPECT_EQ(sessionStorage->Count(), vectors2.size());
+
+    auto reloaded = std::make_unique<CachedSessionResumptionStorage>();
+    EXPECT_SUCCESS(reloaded->Init(&storage));
+    EXPECT_EQ(reloaded->Count(), vectors2.size());
+    for (size_t i = 0; i < vectors1.size(); ++i)
+    {
+        ExpectNotFound(*sessionStorage, vectors1[i]);
+        ExpectNotFound(*reloaded, vectors1[i]);
+        ExpectFound(*sessionStorage, vectors2[i]);
+        ExpectFound(*reloaded, vectors2[i]);
+    }
+
+    EXPECT_SUCCESS(sessionStorage->DeleteAll(2));
+    EXPECT_EQ(sessionStorage->Count(), 0u);
+}
+
+TEST(TestCachedSessionResumptionStorage, TestCallsThroughBaseClasses)
+{
+    TestPersistentStorageDelegate storage;
+    auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+
+    // Calls through a SimpleSessionResumptionStorage or DefaultSessionResumptionStorage keep the index in sync
+    SimpleSessionResumptionStorage & simpleStorage   = *sessionStorage;
+    DefaultSessionResumptionStorage & defaultStorage = *sessionStorage;
+    EXPECT_SUCCESS(simpleStorage.Init(&storage));
+
+    auto vectors = MakeVectors(2);
+    EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[0]));
+    EXPECT_SUCCESS(SaveVector(*sessionStorage, vectors[1]));
+    EXPECT_EQ(sessionStorage->Count(), 2u);
+
+    ScopedNodeId node;
+    EXPECT_SUCCESS(defaultStorage.FindNodeByResumptionId(vectors[1].resumptionId, node));
+    EXPECT_EQ(node, vectors[1].node);
+
+    EXPECT_SUCCESS(defaultStorage.Delete(vectors[0].node));
+    EXPECT_EQ(sessionStorage->Count(), 1u);
+    ExpectNotFound(*sessionStorage, vectors[0]);
+    ExpectFound(*sessionStorage, vectors[1]);
+}
+
+// Benchmark: resumption lookups (by resumption ID, as a responder does for Sigma1, and by peer, as an initiator does) and
+// re-saves of known peers, with the storage full, against SimpleSessionResumptionStorage.
+TEST(TestCachedSessionResumptionStorage, BenchmarkLookups)
+{
+    constexpr size_t kLookups = 20000;
+    constexpr size_t kSaves   = 2000;
+
+    auto vectors = MakeVectors(kCapacity);
+
+    auto run = [&](SessionResumptionStorage & sessionStorage, CountingStorage & storage, const char * name) {
+        for (const auto & vector : vectors)
+        {
+            EXPECT_SUCCESS(SaveVector(sessionStorage, vector));
+        }
+
+        std::minstd_rand random(42);
+        ScopedNodeId outNode;
+        SessionResumptionStorage::ResumptionIdStorage outResumptionId;
+        Crypto::P256ECDHDerivedSecret outSharedSecret;
+        CATValues outCats;
+
+        size_t reads     = storage.mReads;
+        uint64_t startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kLookups; ++i)
+        {
+            const auto & vector = vectors[random() % vectors.size()];
+            if (i % 2 == 0)
+            {
+                EXPECT_SUCCESS(sessionStorage.FindByResumptionId(vector.resumptionId, outNode, outSharedSecret, outCats));
+            }
+            else
+            {
+                EXPECT_SUCCESS(sessionStorage.FindByScopedNodeId(vector.node, outResumptionId, outSharedSecret, outCats));
+            }
+        }
+        uint64_t lookupUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+        reads             = storage.mReads - reads;
+
+        size_t writes = storage.mWrites;
+        startUs       = System::SystemClock().GetMonotonicMicroseconds64().count();
+        for (size_t i = 0; i < kSaves; ++i)
+        {
+            EXPECT_SUCCESS(SaveVector(sessionStorage, vectors[random() % vectors.size()]));
+        }
+        uint64_t saveUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+        writes          = storage.mWrites - writes;
+
+        ChipLogProgress(Test, "%s, %u entries: %u lookups/s (%u.%02u storage reads each), %u saves/s (%u.%02u storage writes each)",
+                        name, static_cast<unsigned>(vectors.size()), static_cast<unsigned>(kLookups * 1000000 / (lookupUs + 1)),
+                        static_cast<unsigned>(reads / kLookups), static_cast<unsigned>(reads * 100 / kLookups % 100),
+                        static_cast<unsigned>(kSaves * 1000000 / (saveUs + 1)), static_cast<unsigned>(writes / kSaves),
+                        static_cast<unsigned>(writes * 100 / kSaves % 100));
+    };
+
+    {
+        CountingStorage storage;
+        SimpleSessionResumptionStorage sessionStorage;
+        EXPECT_SUCCESS(sessionStorage.Init(&storage));
+        run(sessionStorage, storage, "SimpleSessionResumptionStorage");
+    }
+    {
+        CountingStorage storage;
+        auto sessionStorage = std::make_unique<CachedSessionResumptionStorage>();
+        EXPECT_SUCCESS(sessionStorage->Init(&storage));
+        run(*sessionStorage, storage, "CachedSessionResumptionStorage");
+    }
+}
+
+} // namespace
@@ -288,6 +288,34 @@
 #define CHIP_SYSTEM_CONFIG_POOL_USE_HEAP 0
 #endif /* CHIP_SYSTEM_CONFIG_POOL_USE_HEAP */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_POOL_USE_SLAB
+ *
+ *  @brief
+ *      When pools are allocated from the heap, allocate their objects from slabs of several objects
+ *      by default, instead of one heap allocation per object.
+ *
+ *      Slab pools create and release objects in constant time, but keep their slabs until they are
+ *      destroyed. Builds with AddressSanitizer keep using one heap allocation per object, so that
+ *      use-after-free errors are still detected.
+ *
+ *      Off by default. A single pool can use slabs regardless, by being declared with ObjectPoolMem::kSlab.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_POOL_USE_SLAB
+#define CHIP_SYSTEM_CONFIG_POOL_USE_SLAB 0
+#endif /* CHIP_SYSTEM_CONFIG_POOL_USE_SLAB */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE
+ *
+ *  @brief
+ *      Size, in bytes, of the objects of a slab of a slab pool. A slab holds at least one object, and no
+ *      more than the pool size given for the static allocation case.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE
+#define CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE 4096
+#endif /* CHIP_SYSTEM_CONFIG_POOL_SLAB_SIZE */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_NO_LOCKING
  *
@@ -531,6 +559,18 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+ *
+ *  @brief
+ *      The maximum number of ready descriptors retrieved by a single epoll_wait() call in the
+ *      epoll-based System::Layer implementation. Additional ready descriptors are picked up on
+ *      the next event loop iteration.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+#define CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS 64
+#endif // CHIP_SYSTEM_CONFIG_EPOLL_MAX_EVENTS
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
@@ -0,0 +1,267 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This is a unit test suite for socket watches of the event-loop based
+ *      System::Layer implementations (LayerImplSelect and LayerImplEpoll).
+ *
+ *      It also contains a benchmark that measures wakeup latency and CPU time
+ *      per socket event as a function of the number of watched sockets.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+#include <system/SystemConfig.h>
+#include <system/SystemLayerImpl.h>
+
+#include <sys/eventfd.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+uint64_t NowNs(clockid_t clock)
+{
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000u + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+struct WatchedEventFd
+{
+    int fd                 = kInvalidFd;
+    SocketWatchToken token = 0;
+    size_t readCount       = 0;
+    bool stopOnRead        = false;
+    LayerImpl * layer      = nullptr;
+
+    static void OnEvents(SocketEvents events, intptr_t data)
+    {
+        auto * self = reinterpret_cast<WatchedEventFd *>(data);
+        if (events.Has(SocketEventFlags::kRead))
+        {
+            eventfd_t value;
+            if (eventfd_read(self->fd, &value) == 0)
+            {
+                self->readCount++;
+            }
+            if (self->stopOnRead)
+            {
+                EXPECT_SUCCESS(self->layer->StopWatchingSocket(&self->token));
+            }
+        }
+    }
+};
+
+class TestSystemSocketWatch : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        ASSERT_EQ(Platform::MemoryInit(), CHIP_NO_ERROR);
+        ASSERT_EQ(sLayer.Init(), CHIP_NO_ERROR);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sLayer.Shutdown();
+        Platform::MemoryShutdown();
+    }
+
+    void TearDown() override
+    {
+        for (auto & w : mWatches)
+        {
+            if (w.token != sLayer.InvalidSocketWatchToken())
+            {
+                EXPECT_SUCCESS(sLayer.StopWatchingSocket(&w.token));
+            }
+            close(w.fd);
+        }
+        mWatches.clear();
+    }
+
+    // Opens and watches up to `count` eventfds for reading; returns the number actually watched,
+    // which may be smaller when the layer's watch pool or the process descriptor limit is exhausted.
+    size_t WatchEventFds(size_t count)
+    {
+        mWatches.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            WatchedEventFd w;
+            w.layer = &sLayer;
+            w.fd    = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (w.fd < 0)
+            {
+                break;
+            }
+            if (sLayer.StartWatchingSocket(w.fd, &w.token) != CHIP_NO_ERROR)
+            {
+                close(w.fd);
+                break;
+            }
+            mWatches.push_back(w);
+        }
+        for (auto & w : mWatches)
+        {
+            EXPECT_SUCCESS(sLayer.SetCallback(w.token, WatchedEventFd::OnEvents, reinterpret_cast<intptr_t>(&w)));
+            EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingRead(w.token));
+        }
+        return mWatches.size();
+    }
+
+    static void ServiceEvents()
+    {
+        sLayer.PrepareEvents();
+        sLayer.WaitForEvents();
+        sLayer.HandleEvents();
+    }
+
+    static LayerImpl sLayer;
+    std::vector<WatchedEventFd> mWatches;
+};
+
+LayerImpl TestSystemSocketWatch::sLayer;
+
+TEST_F(TestSystemSocketWatch, DispatchesOnlyReadySockets)
+{
+    ASSERT_EQ(WatchEventFds(4), 4u);
+
+    EXPECT_EQ(eventfd_write(mWatches[2].fd, 1), 0);
+    ServiceEvents();
+
+    EXPECT_EQ(mWatches[0].readCount, 0u);
+    EXPECT_EQ(mWatches[1].readCount, 0u);
+    EXPECT_EQ(mWatches[2].readCount, 1u);
+    EXPECT_EQ(mWatches[3].readCount, 0u);
+}
+
+TEST_F(TestSystemSocketWatch, ClearedRequestIsNotDispatched)
+{
+    ASSERT_EQ(WatchEventFds(1), 1u);
+
+    EXPECT_SUCCESS(sLayer.ClearCallbackOnPendingRead(mWatches[0].token));
+    EXPECT_EQ(eventfd_write(mWatches[0].fd, 1), 0);
+
+    // Make sure the loop does not block: a zero-delay timer bounds the wait.
+    EXPECT_SUCCESS(sLayer.StartTimer(Clock::kZero, [](Layer *, void *) {}, nullptr));
+    ServiceEvents();
+    EXPECT_EQ(mWatches[0].readCount, 0u);
+
+    EXPECT_SUCCESS(sLayer.RequestCallbackOnPendingRead(mWatches[0].token));
+    ServiceEvents();
+    EXPECT_EQ(mWatches[0].readCount, 1u);
+}
+
+TEST_F(TestSystemSocketWatch, StartWatchingSameFdReturnsSameToken)
+{
+    ASSERT_EQ(WatchEventFds(1), 1u);
+
+    SocketWatchToken token = sLayer.InvalidSocketWatchToken();
+    EXPECT_SUCCESS(sLayer.StartWatchingSocket(mWatches[0].fd, &token));
+    EXPECT_EQ(token, mWatches[0].token);
+}
+
+TEST_F(TestSystemSocketWatch, StopWatchingFromCallback)
+{
+    ASSERT_EQ(WatchEventFds(2), 2u);
+
+    // Both sockets become ready in the same pass, and each callback stops watching its own socket.
+    mWatches[0].stopOnRead = true;
+    mWatches[1].stopOnRead = true;
+    EXPECT_EQ(eventfd_write(mWatches[0].fd, 1), 0);
+    EXPECT_EQ(eventfd_write(mWatches[1].fd, 1), 0);
+    ServiceEvents();
+
+    EXPECT_EQ(mWatches[0].readCount, 1u);
+    EXPECT_EQ(mWatches[1].readCount, 1u);
+    EXPECT_EQ(mWatches[0].token, sLayer.InvalidSocketWatchToken());
+    EXPECT_EQ(mWatches[1].token, sLayer.InvalidSocketWatchToken());
+}
+
+// Benchmark: wakeup latency and CPU per event while N sockets are watched and a single one is
+// ready at a time. With select() every wakeup scans all N watches; with epoll only the ready one.
+TEST_F(TestSystemSocketWatch, BenchmarkWakeupVsWatchedSockets)
+{
+    constexpr size_t kEventsPerRun = 500;
+
+    // 1000 eventfds do not fit the common soft descriptor limit of 1024.
+    struct rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+    {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+
+    for (size_t requested : { 10u, 100u, 1000u })
+    {
+        const size_t watched = WatchEventFds(requested);
+        if (watched < requested)
+        {
+            ChipLogProgress(Test, "%u watched sockets: skipped, only %u could be watched", static_cast<unsigned>(requested),
+                            static_cast<unsigned>(watched));
+            TearDown();
+            continue;
+        }
+
+        uint64_t wallNs = 0;
+        uint64_t maxNs  = 0;
+        uint64_t cpuNs  = NowNs(CLOCK_THREAD_CPUTIME_ID);
+        for (size_t i = 0; i < kEventsPerRun; i++)
+        {
+            WatchedEventFd & w   = mWatches[(i * 7919) % watched];
+            const size_t before  = w.readCount;
+            const uint64_t start = NowNs(CLOCK_MONOTONIC);
+            ASSERT_EQ(eventfd_write(w.fd, 1), 0);
+            while (w.readCount == before)
+            {
+                ServiceEvents();
+            }
+            const uint64_t elapsed = NowNs(CLOCK_MONOTONIC) - start;
+            wallNs += elapsed;
+            maxNs = std::max(maxNs, elapsed);
+        }
+        cpuNs = NowNs(CLOCK_THREAD_CPUTIME_ID) - cpuNs;
+
+        ChipLogProgress(Test, "%u watched sockets: avg wakeup %u ns, max %u ns, cpu/event %u ns", static_cast<unsigned>(watched),
+                        static_cast<unsigned>(wallNs / kEventsPerRun), static_cast<unsigned>(maxNs),
+                        static_cast<unsigned>(cpuNs / kEventsPerRun));
+
+        size_t total = 0;
+        for (auto & w : mWatches)
+        {
+            total += w.readCount;
+        }
+        EXPECT_EQ(total, kEventsPerRun);
+
+        TearDown();
+    }
+}
+
+} // namespace
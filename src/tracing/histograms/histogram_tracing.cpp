@@ -0,0 +1,179 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histograms/histogram_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace chip {
+namespace Tracing {
+namespace Histograms {
+
+MetricHistogramBackend::MetricHistogramBackend()
+{
+    VerifyOrDie(System::Mutex::Init(mLock) == CHIP_NO_ERROR);
+}
+
+MetricHistogramBackend::Metric * MetricHistogramBackend::FindOrAddMetric(MetricKey key)
+{
+    for (auto & metric : mMetrics)
+    {
+        if (metric.key == nullptr)
+        {
+            metric.key = key;
+            return &metric;
+        }
+        // Keys are constants, but the same key may have several copies across translation units.
+        if (metric.key == key || strcmp(metric.key, key) == 0)
+        {
+            return &metric;
+        }
+    }
+    return nullptr;
+}
+
+void MetricHistogramBackend::Begin(Metric & metric, System::Clock::Microseconds64 now)
+{
+    if (metric.pendingBeginCount == kMaxPendingBegins)
+    {
+        // Too many operations in flight: forget the oldest.
+        metric.firstPendingBegin = (metric.firstPendingBegin + 1) % kMaxPendingBegins;
+        metric.pendingBeginCount--;
+    }
+    metric.pendingBegins[(metric.firstPendingBegin + metric.pendingBeginCount) % kMaxPendingBegins] = now;
+    metric.pendingBeginCount++;
+}
+
+void MetricHistogramBackend::End(Metric & metric, System::Clock::Microseconds64 now, bool failed)
+{
+    // Drop the begin events of operations that never ended.
+    while (metric.pendingBeginCount > 0 && now - metric.pendingBegins[metric.firstPendingBegin] > kMaxPendingAge)
+    {
+        metric.firstPendingBegin = (metric.firstPendingBegin + 1) % kMaxPendingBegins;
+        metric.pendingBeginCount--;
+    }
+
+    if (failed)
+    {
+        metric.errors++;
+    }
+    VerifyOrReturn(metric.pendingBeginCount > 0);
+
+    System::Clock::Microseconds64 duration = now - metric.pendingBegins[metric.firstPendingBegin];
+    metric.firstPendingBegin               = (metric.firstPendingBegin + 1) % kMaxPendingBegins;
+    metric.pendingBeginCount--;
+
+    if (!failed)
+    {
+        metric.isDuration = true;
+        metric.histogram.Record(static_cast<uint32_t>(std::min<uint64_t>(duration.count(), UINT32_MAX)));
+    }
+}
+
+void MetricHistogramBackend::LogMetricEvent(const MetricEvent & event)
+{
+    bool failed = (event.ValueType() == MetricEvent::Value::Type::kChipErrorCode && event.ValueErrorCode() != 0);
+    System::Clock::Microseconds64 now = System::SystemClock().GetMonotonicMicroseconds64();
+
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    Metric * metric = FindOrAddMetric(event.key());
+    VerifyOrReturn(metric != nullptr);
+
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        Begin(*metric, now);
+        break;
+    case MetricEvent::Type::kEndEvent:
+        End(*metric, now, failed);
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        if (failed)
+        {
+            metric->errors++;
+        }
+        else if (event.ValueType() == MetricEvent::Value::Type::kUInt32)
+        {
+            metric->histogram.Record(event.ValueUInt32());
+        }
+        else if (event.ValueType() == MetricEvent::Value::Type::kInt32 && event.ValueInt32() >= 0)
+        {
+            metric->histogram.Record(static_cast<uint32_t>(event.ValueInt32()));
+        }
+        break;
+    }
+}
+
+bool MetricHistogramBackend::GetSummaryAt(size_t index, MetricSummary & summary)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    const Metric & metric = mMetrics[index];
+    VerifyOrReturnValue(metric.key != nullptr, false);
+
+    summary.key        = metric.key;
+    summary.isDuration = metric.isDuration;
+    summary.count      = metric.histogram.Count();
+    summary.errors     = metric.errors;
+    summary.min        = metric.histogram.Min();
+    summary.p50        = metric.histogram.ValueAtPercentile(50);
+    summary.p90        = metric.histogram.ValueAtPercentile(90);
+    summary.p99        = metric.histogram.ValueAtPercentile(99);
+    summary.max        = metric.histogram.Max();
+    return true;
+}
+
+CHIP_ERROR MetricHistogramBackend::GetSummary(MetricKey key, MetricSummary & summary)
+{
+    for (size_t i = 0; i < kMaxMetrics; i++)
+    {
+        if (!GetSummaryAt(i, summary))
+        {
+            break;
+        }
+        if (summary.key == key || strcmp(summary.key, key) == 0)
+        {
+            return CHIP_NO_ERROR;
+        }
+    }
+    return CHIP_ERROR_NOT_FOUND;
+}
+
+void MetricHistogramBackend::Reset()
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & metric : mMetrics)
+    {
+        metric.isDuration        = false;
+        metric.errors            = 0;
+        metric.firstPendingBegin = 0;
+        metric.pendingBeginCount = 0;
+        metric.histogram.Reset();
+    }
+}
+
+} // namespace Histograms
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemClock.h>
+#include <system/SystemMutex.h>
+#include <tracing/backend.h>
+#include <tracing/histograms/metric_histogram.h>
+#include <tracing/metric_keys.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Histograms {
+
+/// Statistics of a metric key, as aggregated by MetricHistogramBackend.
+struct MetricSummary
+{
+    MetricKey key;
+
+    /// Whether values are durations between begin and end events, in microseconds. Otherwise, they
+    /// are the values of instant events (e.g. a retry count).
+    bool isDuration;
+
+    uint32_t count;  // Values recorded
+    uint32_t errors; // Events that reported an error; their durations are not recorded
+    uint32_t min;
+    uint32_t p50;
+    uint32_t p90;
+    uint32_t p99;
+    uint32_t max;
+};
+
+/// A Backend that aggregates metric events into a histogram per metric key:
+///
+///   - the durations between begin and end events (e.g. CASE establishment, IM round trips),
+///   - the non-negative values of instant events (e.g. MRP retransmissions, address resolution time).
+///
+/// Events that carry an error are counted per key instead.
+///
+/// Metric events do not identify the operation they belong to, so an end event is matched with the
+/// oldest outstanding begin event of its key. Outstanding begin events older than kMaxPendingAge (of
+/// operations that never ended) are dropped, so that they do not skew later durations.
+///
+/// Only the first kMaxMetrics keys seen are tracked; the memory used is fixed at construction.
+///
+/// THREAD SAFETY:
+///    All methods may be called from any thread.
+class MetricHistogramBackend : public ::chip::Tracing::Backend
+{
+public:
+    // About 2 KiB per metric key.
+    static constexpr size_t kMaxMetrics       = 24;
+    static constexpr size_t kMaxPendingBegins = 8;
+
+    static constexpr System::Clock::Seconds32 kMaxPendingAge = System::Clock::Seconds32(600);
+
+    MetricHistogramBackend();
+
+    MetricHistogramBackend(const MetricHistogramBackend &)             = delete;
+    MetricHistogramBackend & operator=(const MetricHistogramBackend &) = delete;
+
+    void LogMetricEvent(const MetricEvent & event) override;
+
+    /// Gets the statistics of `key`. Returns CHIP_ERROR_NOT_FOUND if no event of that key was seen.
+    CHIP_ERROR GetSummary(MetricKey key, MetricSummary & summary);
+
+    /// Calls `callback` with the statistics of every tracked key, in the order they were first seen.
+    /// The callback must not call back into this backend.
+    template <typename F>
+    void ForEachSummary(F callback)
+    {
+        for (size_t i = 0; i < kMaxMetrics; i++)
+        {
+            MetricSummary summary;
+            if (GetSummaryAt(i, summary))
+            {
+                callback(summary);
+            }
+        }
+    }
+
+    /// Clears all statistics.
+    void Reset();
+
+private:
+    struct Metric
+    {
+        MetricKey key   = nullptr;
+        bool isDuration = false;
+        uint32_t errors = 0;
+        MetricHistogram histogram;
+
+        // Times of the outstanding begin events, oldest first, in a ring.
+        System::Clock::Microseconds64 pendingBegins[kMaxPendingBegins];
+        size_t firstPendingBegin = 0;
+        size_t pendingBeginCount = 0;
+    };
+
+    Metric * FindOrAddMetric(MetricKey key);
+    bool GetSummaryAt(size_t index, MetricSummary & summary);
+    static void Begin(Metric & metric, System::Clock::Microseconds64 now);
+    static void End(Metric & metric, System::Clock::Microseconds64 now, bool failed);
+
+    System::Mutex mLock;
+    Metric mMetrics[kMaxMetrics];
+};
+
+} // namespace Histograms
+} // namespace Tracing
+} // namespace chip
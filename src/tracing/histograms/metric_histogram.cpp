@@ -0,0 +1,105 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/histograms/metric_histogram.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace Tracing {
+namespace Histograms {
+
+namespace {
+
+uint32_t HighestBitIndex(uint32_t value)
+{
+    uint32_t index = 0;
+    while (value >>= 1)
+    {
+        index++;
+    }
+    return index;
+}
+
+} // namespace
+
+size_t MetricHistogram::BucketIndex(uint32_t value)
+{
+    if (value < kSubBuckets)
+    {
+        return value;
+    }
+
+    // Values of [2^e, 2^(e+1)) fall in group e - kSubBucketBits + 1, whose buckets are 2^(group - 1) wide.
+    uint32_t group    = HighestBitIndex(value) - kSubBucketBits + 1;
+    uint32_t subIndex = (value >> (group - 1)) - kSubBuckets;
+    return group * kSubBuckets + subIndex;
+}
+
+uint32_t MetricHistogram::BucketHighestValue(size_t index)
+{
+    if (index < kSubBuckets)
+    {
+        return static_cast<uint32_t>(index);
+    }
+
+    uint32_t group    = static_cast<uint32_t>(index / kSubBuckets);
+    uint32_t subIndex = static_cast<uint32_t>(index % kSubBuckets);
+    uint64_t lowest   = static_cast<uint64_t>(kSubBuckets + subIndex) << (group - 1);
+    return static_cast<uint32_t>(lowest + (uint64_t{ 1 } << (group - 1)) - 1);
+}
+
+void MetricHistogram::Record(uint32_t value)
+{
+    mBuckets[BucketIndex(value)]++;
+    mMin = (mCount == 0) ? value : std::min(mMin, value);
+    mMax = (mCount == 0) ? value : std::max(mMax, value);
+    mCount++;
+}
+
+void MetricHistogram::Reset()
+{
+    *this = MetricHistogram();
+}
+
+uint32_t MetricHistogram::ValueAtPercentile(uint32_t percent) const
+{
+    if (mCount == 0)
+    {
+        return 0;
+    }
+
+    // The rank of the value, counting from 1.
+    uint64_t rank = (static_cast<uint64_t>(std::min<uint32_t>(percent, 100)) * mCount + 99) / 100;
+    rank          = std::max<uint64_t>(rank, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; i++)
+    {
+        seen += mBuckets[i];
+        if (seen >= rank)
+        {
+            return std::max(mMin, std::min(BucketHighestValue(i), mMax));
+        }
+    }
+    return mMax;
+}
+
+} // namespace Histograms
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,63 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace Histograms {
+
+/// A histogram of uint32_t values with log-linear buckets, in the manner of HdrHistogram.
+///
+/// Values below kSubBuckets are counted exactly. Above, every power of two is split into
+/// kSubBuckets buckets of equal width, so that percentiles are reported within 1/kSubBuckets
+/// (6.25%) of the recorded values, in constant memory and time.
+class MetricHistogram
+{
+public:
+    static constexpr uint32_t kSubBucketBits = 4;
+    static constexpr uint32_t kSubBuckets    = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount     = kSubBuckets * (32 - kSubBucketBits + 1);
+
+    void Record(uint32_t value);
+    void Reset();
+
+    uint32_t Count() const { return mCount; }
+    uint32_t Min() const { return mMin; }
+    uint32_t Max() const { return mMax; }
+
+    /// The value that `percent` percent of the recorded values are at most, to the bucket precision
+    /// (reported as the highest value of its bucket, and never above Max()). 0 if nothing was recorded.
+    uint32_t ValueAtPercentile(uint32_t percent) const;
+
+    /// Exposed for tests.
+    static size_t BucketIndex(uint32_t value);
+    static uint32_t BucketHighestValue(size_t index);
+
+private:
+    uint32_t mBuckets[kBucketCount] = {};
+    uint32_t mCount                 = 0;
+    uint32_t mMin                   = 0;
+    uint32_t mMax                   = 0;
+};
+
+} // namespace Histograms
+} // namespace Tracing
+} // namespace chip
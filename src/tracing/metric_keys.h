@@ -51,6 +51,13 @@ constexpr MetricKey kMetricDeviceOperationalDiscovery = "core_dev_operational_di
 // Operational Discovery Attempt Count
 constexpr MetricKey kMetricDeviceOperationalDiscoveryAttemptCount = "core_dev_operational_discovery_attempt_ctr";
 
+// Operational address lookups served from, or missing, the address cache
+constexpr MetricKey kMetricAddressResolveCacheHit  = "core_addr_resolve_cache_hit";
+constexpr MetricKey kMetricAddressResolveCacheMiss = "core_addr_resolve_cache_miss";
+
+// Time from the start of an operational address lookup to its first address, in milliseconds
+constexpr MetricKey kMetricAddressResolveTimeToFirstAddress = "core_addr_resolve_time_to_first_addr";
+
 // CASE Session
 constexpr MetricKey kMetricDeviceCASESession = "core_dev_case_session";
 
@@ -72,11 +79,23 @@ constexpr MetricKey kMetricDeviceCASESessionSigma2Resume = "core_dev_case_sessio
 // CASE Session SigmaFinished
 constexpr MetricKey kMetricDeviceCASESessionSigmaFinished = "core_dev_case_session_sigma_finished";
 
+// CASE Server Sigma1 admitted to a handshake slot (value: handshakes in progress)
+constexpr MetricKey kMetricDeviceCASEServerSigma1Admitted = "core_dev_case_server_sigma1_admitted";
+
+// CASE Server Sigma1 rejected with Busy (value: minimum wait time in ms)
+constexpr MetricKey kMetricDeviceCASEServerSigma1Busy = "core_dev_case_server_sigma1_busy";
+
 // MRP Retry Counter
 constexpr MetricKey kMetricDeviceRMPRetryCount = "core_dev_rmp_retry_count";
 
 // Subscription setup
 constexpr MetricKey kMetricDeviceSubscriptionSetup = "core_dev_subscription_setup";
 
+// Read interaction, from the Read Request to the end of the initial report
+constexpr MetricKey kMetricDeviceReadInteraction = "core_dev_read_interaction";
+
+// Invoke interaction, from the Invoke Request to the last Invoke Response
+constexpr MetricKey kMetricDeviceInvokeInteraction = "core_dev_invoke_interaction";
+
 } // namespace Tracing
 } // namespace chip
@@ -0,0 +1,90 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace chip {
+namespace Tracing {
+namespace RingBuffer {
+
+/// Format of ring buffer trace dumps, shared by the backend writing them and the
+/// decoder reading them. Dumps are in the byte order of the traced host:
+///
+///   FileHeader
+///   Record...                       records of all threads, oldest first per thread
+///   Record of kind kEndOfRecords    whose value is the number of strings that follow
+///   (StringHeader, char[length])... labels and groups referenced by the records
+
+/// What a record represents.
+enum class RecordKind : uint8_t
+{
+    kBegin         = 1, // TraceBegin(label, group)
+    kEnd           = 2, // TraceEnd(label, group)
+    kInstant       = 3, // TraceInstant(label, group)
+    kCounter       = 4, // TraceCounter(label)
+    kMetricBegin   = 5, // LogMetricEvent of a kBeginEvent; label is the metric key
+    kMetricEnd     = 6, // LogMetricEvent of a kEndEvent
+    kMetricInstant = 7, // LogMetricEvent of a kInstantEvent
+    kEndOfRecords  = 0xFF,
+};
+
+/// A trace record. Labels and groups are stored as the addresses of their (constant) strings,
+/// which dumps resolve through their string table.
+struct Record
+{
+    uint64_t timestampUs; // Monotonic time of the event
+    uint64_t label;       // Address of the label, or of the metric key
+    uint64_t group;       // Address of the group, 0 if none
+    uint64_t info;        // Kind, thread, metric value type and value; see PackInfo
+
+    static constexpr uint64_t PackInfo(RecordKind kind, uint8_t thread, uint8_t valueType, uint32_t value)
+    {
+        return static_cast<uint64_t>(value) | (static_cast<uint64_t>(kind) << 32) | (static_cast<uint64_t>(thread) << 40) |
+            (static_cast<uint64_t>(valueType) << 48);
+    }
+
+    RecordKind Kind() const { return static_cast<RecordKind>((info >> 32) & 0xFF); }
+    uint8_t Thread() const { return static_cast<uint8_t>((info >> 40) & 0xFF); }
+    /// A MetricEvent::Value::Type, for metric records.
+    uint8_t ValueType() const { return static_cast<uint8_t>((info >> 48) & 0xFF); }
+    uint32_t Value() const { return static_cast<uint32_t>(info); }
+};
+
+static_assert(sizeof(Record) == 32, "Records are fixed size");
+
+struct FileHeader
+{
+    static constexpr char kMagic[8]    = { 'M', 'T', 'R', 'R', 'I', 'N', 'G', '\0' };
+    static constexpr uint32_t kVersion = 1;
+
+    char magic[8];
+    uint32_t version;    // kVersion; reads differently if the dump comes from a host of the other byte order
+    uint32_t recordSize; // sizeof(Record)
+};
+
+struct StringHeader
+{
+    uint64_t address; // Address the records refer to the string by
+    uint32_t length;  // Length of the string that follows, without terminator
+    uint32_t reserved;
+};
+
+} // namespace RingBuffer
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,377 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/ring_buffer/ring_buffer_tracing.h>
+
+#include <lib/support/CodeUtils.h>
+#include <tracing/metric_event.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <new>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace chip {
+namespace Tracing {
+namespace RingBuffer {
+
+namespace {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Dumping from signal handlers requires lock-free atomics");
+
+constexpr size_t kWordsPerRecord = sizeof(Record) / sizeof(uint64_t);
+
+// Records copied out of a ring at a time while dumping, and distinct strings a dump can resolve.
+// Both live on the stack of the dumping thread, as dumping may not allocate.
+constexpr size_t kDumpChunkRecords = 64;
+constexpr size_t kMaxDumpStrings   = 1024;
+
+std::atomic<uint64_t> gNextGeneration{ 1 };
+
+struct ThreadRingCache
+{
+    uint64_t generation = 0;
+    void * ring         = nullptr;
+};
+
+thread_local ThreadRingCache tThreadRingCache;
+
+uint64_t NowMicroseconds()
+{
+    using namespace std::chrono;
+    return static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count());
+}
+
+size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+CHIP_ERROR WriteAll(int fd, const void * data, size_t size)
+{
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    while (size > 0)
+    {
+        ssize_t written = write(fd, bytes, size);
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(written > 0, CHIP_ERROR_WRITE_FAILED);
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+    return CHIP_NO_ERROR;
+}
+
+/// The distinct non-null string addresses referenced by dumped records, in a fixed-size open addressing table.
+class DumpStringSet
+{
+public:
+    void Add(uint64_t address)
+    {
+        VerifyOrReturn(address != 0);
+        for (size_t i = 0, slot = Hash(address); i < kMaxDumpStrings; i++, slot = (slot + 1) % kMaxDumpStrings)
+        {
+            if (mAddresses[slot] == address)
+            {
+                return;
+            }
+            if (mAddresses[slot] == 0)
+            {
+                mAddresses[slot] = address;
+                mCount++;
+                return;
+            }
+        }
+        // Full: the decoder shows unresolved addresses instead of strings.
+    }
+
+    uint32_t Count() const { return mCount; }
+
+    CHIP_ERROR Write(int fd) const
+    {
+        for (uint64_t address : mAddresses)
+        {
+            if (address == 0)
+            {
+                continue;
+            }
+
+            const char * string = reinterpret_cast<const char *>(static_cast<uintptr_t>(address));
+            StringHeader header = {};
+            header.address      = address;
+            header.length       = static_cast<uint32_t>(strlen(string));
+            ReturnErrorOnFailure(WriteAll(fd, &header, sizeof(header)));
+            ReturnErrorOnFailure(WriteAll(fd, string, header.length));
+        }
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    static size_t Hash(uint64_t address)
+    {
+        return static_cast<size_t>(((address >> 3) * 0x9E3779B97F4A7C15ull) >> 32) % kMaxDumpStrings;
+    }
+
+    uint64_t mAddresses[kMaxDumpStrings] = {};
+    uint32_t mCount                      = 0;
+};
+
+} // namespace
+
+/// The ring of a single thread. Only that thread writes to it; Dump() reads it concurrently.
+///
+/// Every word of a slot is an atomic, so that reading a slot while it is being overwritten is not a data
+/// race. Dump() tells such torn records apart by the `mClaimed` count, which the writer bumps before it
+/// starts overwriting a slot: a record copied out of the ring is intact if the ring did not wrap around
+/// it by the time the copy completed.
+class RingBufferBackend::ThreadRing
+{
+public:
+    ThreadRing(size_t capacity, uint8_t thread) : mCapacity(capacity), mThread(thread) {}
+
+    bool Init()
+    {
+        mSlots.reset(new (std::nothrow) std::atomic<uint64_t>[mCapacity * kWordsPerRecord]());
+        return mSlots != nullptr;
+    }
+
+    uint8_t Thread() const { return mThread; }
+
+    void Append(const Record & record)
+    {
+        uint64_t index = mCommitted.load(std::memory_order_relaxed);
+        mClaimed.store(index + 1, std::memory_order_relaxed);
+        // Orders the claim before the slot stores, for Dump() to see the claim if it sees any of them.
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::atomic<uint64_t> * slot = &mSlots[(index & (mCapacity - 1)) * kWordsPerRecord];
+        slot[0].store(record.timestampUs, std::memory_order_relaxed);
+        slot[1].store(record.label, std::memory_order_relaxed);
+        slot[2].store(record.group, std::memory_order_relaxed);
+        slot[3].store(record.info, std::memory_order_relaxed);
+
+        mCommitted.store(index + 1, std::memory_order_release);
+    }
+
+    CHIP_ERROR Dump(int fd, DumpStringSet & strings) const
+    {
+        uint64_t end   = mCommitted.load(std::memory_order_acquire);
+        uint64_t index = (end > mCapacity) ? end - mCapacity : 0;
+
+        Record chunk[kDumpChunkRecords];
+        while (index < end)
+        {
+            size_t count = static_cast<size_t>(std::min<uint64_t>(end - index, kDumpChunkRecords));
+            for (size_t i = 0; i < count; i++)
+            {
+                const std::atomic<uint64_t> * slot = &mSlots[((index + i) & (mCapacity - 1)) * kWordsPerRecord];
+                chunk[i].timestampUs               = slot[0].load(std::memory_order_relaxed);
+                chunk[i].label                     = slot[1].load(std::memory_order_relaxed);
+                chunk[i].group                     = slot[2].load(std::memory_order_relaxed);
+                chunk[i].info                      = slot[3].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Records the writer claimed the slots of in the meantime were overwritten, possibly partially.
+            uint64_t claimed     = mClaimed.load(std::memory_order_relaxed);
+            uint64_t firstIntact = (claimed > mCapacity) ? claimed - mCapacity : 0;
+            size_t skipped       = (firstIntact > index) ? static_cast<size_t>(std::min<uint64_t>(firstIntact - index, count)) : 0;
+
+            for (size_t i = skipped; i < count; i++)
+            {
+                strings.Add(chunk[i].label);
+                strings.Add(chunk[i].group);
+            }
+            ReturnErrorOnFailure(WriteAll(fd, &chunk[skipped], (count - skipped) * sizeof(Record)));
+            index += count;
+        }
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    const size_t mCapacity;
+    const uint8_t mThread;
+    std::unique_ptr<std::atomic<uint64_t>[]> mSlots;
+
+    std::atomic<uint64_t> mClaimed{ 0 };   // Records whose slot the writer started to write
+    std::atomic<uint64_t> mCommitted{ 0 }; // Records completely written
+};
+
+RingBufferBackend::RingBufferBackend(size_t recordsPerThread) :
+    mRecordsPerThread(RoundUpToPowerOfTwo(recordsPerThread)), mGeneration(gNextGeneration.fetch_add(1))
+{}
+
+RingBufferBackend::~RingBufferBackend()
+{
+    for (auto & ring : mThreadRings)
+    {
+        delete ring.load();
+    }
+}
+
+RingBufferBackend::ThreadRing * RingBufferBackend::CurrentThreadRing()
+{
+    if (tThreadRingCache.generation == mGeneration)
+    {
+        return static_cast<ThreadRing *>(tThreadRingCache.ring);
+    }
+    return RegisterCurrentThread();
+}
+
+RingBufferBackend::ThreadRing * RingBufferBackend::RegisterCurrentThread()
+{
+    ThreadRing * ring = nullptr;
+    size_t thread     = mThreadCount.fetch_add(1);
+    if (thread < kMaxThreads)
+    {
+        ring = new (std::nothrow) ThreadRing(mRecordsPerThread, static_cast<uint8_t>(thread));
+        if (ring != nullptr && !ring->Init())
+        {
+            delete ring;
+            ring = nullptr;
+        }
+        mThreadRings[thread].store(ring, std::memory_order_release);
+    }
+
+    // Threads that did not get a ring are not traced, rather than retrying on every event.
+    tThreadRingCache.generation = mGeneration;
+    tThreadRingCache.ring       = ring;
+    return ring;
+}
+
+void RingBufferBackend::Append(RecordKind kind, const char * label, const char * group, uint8_t valueType, uint32_t value)
+{
+    ThreadRing * ring = CurrentThreadRing();
+    VerifyOrReturn(ring != nullptr);
+
+    Record record;
+    record.timestampUs = NowMicroseconds();
+    record.label       = reinterpret_cast<uintptr_t>(label);
+    record.group       = reinterpret_cast<uintptr_t>(group);
+    record.info        = Record::PackInfo(kind, ring->Thread(), valueType, value);
+    ring->Append(record);
+}
+
+void RingBufferBackend::TraceBegin(const char * label, const char * group)
+{
+    Append(RecordKind::kBegin, label, group);
+}
+
+void RingBufferBackend::TraceEnd(const char * label, const char * group)
+{
+    Append(RecordKind::kEnd, label, group);
+}
+
+void RingBufferBackend::TraceInstant(const char * label, const char * group)
+{
+    Append(RecordKind::kInstant, label, group);
+}
+
+void RingBufferBackend::TraceCounter(const char * label)
+{
+    Append(RecordKind::kCounter, label, nullptr);
+}
+
+void RingBufferBackend::LogMetricEvent(const MetricEvent & event)
+{
+    RecordKind kind = RecordKind::kMetricInstant;
+    switch (event.type())
+    {
+    case MetricEvent::Type::kBeginEvent:
+        kind = RecordKind::kMetricBegin;
+        break;
+    case MetricEvent::Type::kEndEvent:
+        kind = RecordKind::kMetricEnd;
+        break;
+    case MetricEvent::Type::kInstantEvent:
+        kind = RecordKind::kMetricInstant;
+        break;
+    }
+
+    uint32_t value = 0;
+    switch (event.ValueType())
+    {
+    case MetricEvent::Value::Type::kInt32:
+        value = static_cast<uint32_t>(event.ValueInt32());
+        break;
+    case MetricEvent::Value::Type::kUInt32:
+        value = event.ValueUInt32();
+        break;
+    case MetricEvent::Value::Type::kChipErrorCode:
+        value = event.ValueErrorCode();
+        break;
+    case MetricEvent::Value::Type::kUndefined:
+        break;
+    }
+
+    Append(kind, event.key(), nullptr, static_cast<uint8_t>(event.ValueType()), value);
+}
+
+CHIP_ERROR RingBufferBackend::Dump(const char * path) const
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    CHIP_ERROR err = Dump(fd);
+    if (close(fd) != 0 && err == CHIP_NO_ERROR)
+    {
+        err = CHIP_ERROR_WRITE_FAILED;
+    }
+    return err;
+}
+
+CHIP_ERROR RingBufferBackend::Dump(int fd) const
+{
+    FileHeader header = {};
+    memcpy(header.magic, FileHeader::kMagic, sizeof(header.magic));
+    header.version    = FileHeader::kVersion;
+    header.recordSize = sizeof(Record);
+    ReturnErrorOnFailure(WriteAll(fd, &header, sizeof(header)));
+
+    DumpStringSet strings;
+    size_t threadCount = std::min(mThreadCount.load(), kMaxThreads);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        // Null while the thread is still allocating its ring, or if it could not.
+        const ThreadRing * ring = mThreadRings[i].load(std::memory_order_acquire);
+        if (ring != nullptr)
+        {
+            ReturnErrorOnFailure(ring->Dump(fd, strings));
+        }
+    }
+
+    Record endOfRecords = {};
+    endOfRecords.info   = Record::PackInfo(RecordKind::kEndOfRecords, 0, 0, strings.Count());
+    ReturnErrorOnFailure(WriteAll(fd, &endOfRecords, sizeof(endOfRecords)));
+    return strings.Write(fd);
+}
+
+} // namespace RingBuffer
+} // namespace Tracing
+} // namespace chip
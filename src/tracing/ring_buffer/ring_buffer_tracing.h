@@ -0,0 +1,87 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <tracing/backend.h>
+#include <tracing/ring_buffer/ring_buffer_format.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace chip {
+namespace Tracing {
+namespace RingBuffer {
+
+/// A Backend that records binary trace records into per-thread ring buffers, overwriting the oldest
+/// records once a ring is full.
+///
+/// Tracing an event costs a clock read and a handful of stores to memory owned by the calling thread:
+/// nothing is formatted, allocated or locked (except for the ring of a thread, allocated on the first
+/// event of that thread), so the backend can stay registered in production. Rings are written to a
+/// file on demand by Dump(), and converted offline to Chrome/Perfetto trace JSON by the ring buffer
+/// trace decoder.
+///
+/// Labels and groups are recorded by address, which relies on them being constant strings (as required
+/// of all tracing labels).
+///
+/// THREAD SAFETY:
+///    Every thread writes to its own ring only. Dump() may be called from any thread, concurrently with
+///    tracing, and only uses async-signal-safe functions so that it can be called from a signal handler.
+///    Threads beyond kMaxThreads, counted over the lifetime of the backend, are not traced.
+class RingBufferBackend : public ::chip::Tracing::Backend
+{
+public:
+    static constexpr size_t kMaxThreads              = 32;
+    static constexpr size_t kDefaultRecordsPerThread = 8192;
+
+    /// recordsPerThread is rounded up to a power of two.
+    explicit RingBufferBackend(size_t recordsPerThread = kDefaultRecordsPerThread);
+    ~RingBufferBackend();
+
+    /// Writes the records currently held by the rings to the file at `path`, replacing it.
+    CHIP_ERROR Dump(const char * path) const;
+
+    /// Writes the records currently held by the rings to `fd`.
+    CHIP_ERROR Dump(int fd) const;
+
+    void TraceBegin(const char * label, const char * group) override;
+    void TraceEnd(const char * label, const char * group) override;
+    void TraceInstant(const char * label, const char * group) override;
+    void TraceCounter(const char * label) override;
+    void LogMetricEvent(const MetricEvent &) override;
+
+private:
+    class ThreadRing;
+
+    void Append(RecordKind kind, const char * label, const char * group, uint8_t valueType = 0, uint32_t value = 0);
+    ThreadRing * CurrentThreadRing();
+    ThreadRing * RegisterCurrentThread();
+
+    const size_t mRecordsPerThread;
+    const uint64_t mGeneration; // Tells the thread-local ring caches of different backends apart
+
+    std::atomic<size_t> mThreadCount{ 0 };
+    std::atomic<ThreadRing *> mThreadRings[kMaxThreads] = {};
+};
+
+} // namespace RingBuffer
+} // namespace Tracing
+} // namespace chip
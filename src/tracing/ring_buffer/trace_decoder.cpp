@@ -0,0 +1,231 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/ring_buffer/trace_decoder.h>
+
+#include <lib/support/CodeUtils.h>
+#include <tracing/metric_event.h>
+#include <tracing/ring_buffer/ring_buffer_format.h>
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace chip {
+namespace Tracing {
+namespace RingBuffer {
+
+namespace {
+
+using ValueType = MetricEvent::Value::Type;
+
+template <typename T>
+bool ReadStruct(std::istream & input, T & value)
+{
+    input.read(reinterpret_cast<char *>(&value), sizeof(value));
+    return input.gcount() == static_cast<std::streamsize>(sizeof(value));
+}
+
+void WriteJsonString(std::ostream & out, const std::string & value)
+{
+    out << '"';
+    for (char c : value)
+    {
+        switch (c)
+        {
+        case '"':
+            out << "\\\"";
+            break;
+        case '\\':
+            out << "\\\\";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                out << escaped;
+            }
+            else
+            {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+class StringTable
+{
+public:
+    void Add(uint64_t address, std::string value) { mStrings[address] = std::move(value); }
+
+    std::string Lookup(uint64_t address) const
+    {
+        auto it = mStrings.find(address);
+        if (it != mStrings.end())
+        {
+            return it->second;
+        }
+
+        // The dump could not resolve all of its strings.
+        char unresolved[32];
+        snprintf(unresolved, sizeof(unresolved), "0x%" PRIx64, address);
+        return unresolved;
+    }
+
+private:
+    std::unordered_map<uint64_t, std::string> mStrings;
+};
+
+void WriteMetricValue(std::ostream & out, const Record & record)
+{
+    switch (static_cast<ValueType>(record.ValueType()))
+    {
+    case ValueType::kInt32:
+        out << ",\"args\":{\"value\":" << static_cast<int32_t>(record.Value()) << "}";
+        break;
+    case ValueType::kUInt32:
+        out << ",\"args\":{\"value\":" << record.Value() << "}";
+        break;
+    case ValueType::kChipErrorCode: {
+        char error[16];
+        snprintf(error, sizeof(error), "0x%08" PRIx32, record.Value());
+        out << ",\"args\":{\"error\":\"" << error << "\"}";
+        break;
+    }
+    case ValueType::kUndefined:
+    default:
+        break;
+    }
+}
+
+} // namespace
+
+CHIP_ERROR ConvertToChromeTrace(std::istream & dump, std::ostream & json)
+{
+    FileHeader header;
+    VerifyOrReturnError(ReadStruct(dump, header), CHIP_ERROR_READ_FAILED);
+    VerifyOrReturnError(memcmp(header.magic, FileHeader::kMagic, sizeof(header.magic)) == 0, CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+    VerifyOrReturnError(header.version == FileHeader::kVersion && header.recordSize == sizeof(Record),
+                        CHIP_ERROR_VERSION_MISMATCH);
+
+    std::vector<Record> records;
+    Record record;
+    while (true)
+    {
+        VerifyOrReturnError(ReadStruct(dump, record), CHIP_ERROR_READ_FAILED);
+        if (record.Kind() == RecordKind::kEndOfRecords)
+        {
+            break;
+        }
+        records.push_back(record);
+    }
+
+    StringTable strings;
+    for (uint32_t i = 0; i < record.Value(); i++)
+    {
+        StringHeader stringHeader;
+        VerifyOrReturnError(ReadStruct(dump, stringHeader), CHIP_ERROR_READ_FAILED);
+        std::string value(stringHeader.length, '\0');
+        dump.read(value.data(), static_cast<std::streamsize>(value.size()));
+        VerifyOrReturnError(dump.gcount() == static_cast<std::streamsize>(value.size()), CHIP_ERROR_READ_FAILED);
+        strings.Add(stringHeader.address, std::move(value));
+    }
+
+    // Threads are dumped one after the other; counters and viewers want a single timeline.
+    std::stable_sort(records.begin(), records.end(),
+                     [](const Record & a, const Record & b) { return a.timestampUs < b.timestampUs; });
+
+    std::unordered_map<uint64_t, uint64_t> counters;
+    bool first = true;
+
+    json << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (const Record & r : records)
+    {
+        const char * phase = nullptr;
+        switch (r.Kind())
+        {
+        case RecordKind::kBegin:
+        case RecordKind::kMetricBegin:
+            phase = "B";
+            break;
+        case RecordKind::kEnd:
+        case RecordKind::kMetricEnd:
+            phase = "E";
+            break;
+        case RecordKind::kInstant:
+        case RecordKind::kMetricInstant:
+            phase = "i";
+            break;
+        case RecordKind::kCounter:
+            phase = "C";
+            break;
+        default:
+            break;
+        }
+        if (phase == nullptr)
+        {
+            continue;
+        }
+
+        json << (first ? "\n" : ",\n") << "{\"name\":";
+        first = false;
+        WriteJsonString(json, strings.Lookup(r.label));
+        if (r.group != 0)
+        {
+            json << ",\"cat\":";
+            WriteJsonString(json, strings.Lookup(r.group));
+        }
+        else if (r.Kind() >= RecordKind::kMetricBegin)
+        {
+            json << ",\"cat\":\"Metric\"";
+        }
+        json << ",\"ph\":\"" << phase << "\",\"ts\":" << r.timestampUs << ",\"pid\":1,\"tid\":" << (r.Thread() + 1);
+
+        switch (r.Kind())
+        {
+        case RecordKind::kInstant:
+        case RecordKind::kMetricInstant:
+            json << ",\"s\":\"t\"";
+            break;
+        case RecordKind::kCounter:
+            json << ",\"args\":{\"count\":" << ++counters[r.label] << "}";
+            break;
+        default:
+            break;
+        }
+        if (r.Kind() >= RecordKind::kMetricBegin)
+        {
+            WriteMetricValue(json, r);
+        }
+        json << "}";
+    }
+    json << "\n]}\n";
+
+    VerifyOrReturnError(json.good(), CHIP_ERROR_WRITE_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace RingBuffer
+} // namespace Tracing
+} // namespace chip
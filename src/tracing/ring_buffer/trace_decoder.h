@@ -0,0 +1,40 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <lib/core/CHIPError.h>
+
+#include <istream>
+#include <ostream>
+
+namespace chip {
+namespace Tracing {
+namespace RingBuffer {
+
+/// Converts a dump written by RingBufferBackend::Dump() to Chrome trace event JSON, which
+/// both chrome://tracing and the Perfetto UI open.
+///
+/// Records are ordered by time. Each traced thread becomes a track, scopes become begin/end
+/// events and counters count their occurrences. Metric values are shown as event arguments.
+///
+/// As this uses std::string, this is NOT for use on embedded devices.
+CHIP_ERROR ConvertToChromeTrace(std::istream & dump, std::ostream & json);
+
+} // namespace RingBuffer
+} // namespace Tracing
+} // namespace chip
@@ -0,0 +1,73 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <tracing/ring_buffer/trace_decoder.h>
+
+#include <lib/core/ErrorStr.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+// clang-format off
+const char * const sHelp =
+    "Usage: ring-buffer-trace-decoder <dump> [<output.json>]\n"
+    "\n"
+    "Converts a ring buffer trace dump to Chrome trace event JSON, for chrome://tracing\n"
+    "or https://ui.perfetto.dev. Writes to standard output if no output file is given.\n"
+    "\n";
+// clang-format on
+
+} // namespace
+
+int main(int argc, const char ** argv)
+{
+    if (argc < 2 || argc > 3)
+    {
+        fputs(sHelp, stderr);
+        return 1;
+    }
+
+    std::ifstream dump(argv[1], std::ios::binary);
+    if (!dump.is_open())
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    std::ofstream outputFile;
+    if (argc == 3)
+    {
+        outputFile.open(argv[2], std::ios::out | std::ios::trunc);
+        if (!outputFile.is_open())
+        {
+            fprintf(stderr, "Cannot open %s\n", argv[2]);
+            return 1;
+        }
+    }
+
+    CHIP_ERROR err = chip::Tracing::RingBuffer::ConvertToChromeTrace(dump, (argc == 3) ? outputFile : std::cout);
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Cannot decode %s: %s\n", argv[1], chip::ErrorStr(err));
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <system/RAIIMockClock.h>
+#include <tracing/histograms/histogram_tracing.h>
+#include <tracing/histograms/metric_histogram.h>
+#include <tracing/metric_event.h>
+
+#include <string>
+#include <vector>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::Histograms;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr MetricKey kTestDuration = "test_duration";
+constexpr MetricKey kTestValue    = "test_value";
+
+TEST(TestMetricHistograms, TestBucketsCoverAllValues)
+{
+    // Small values have a bucket each.
+    for (uint32_t value = 0; value < MetricHistogram::kSubBuckets; value++)
+    {
+        EXPECT_EQ(MetricHistogram::BucketIndex(value), value);
+        EXPECT_EQ(MetricHistogram::BucketHighestValue(value), value);
+    }
+
+    // Buckets are contiguous, and each value falls in the bucket that ends at or above it.
+    EXPECT_EQ(MetricHistogram::BucketIndex(16), 16u);
+    EXPECT_EQ(MetricHistogram::BucketIndex(31), 31u);
+    EXPECT_EQ(MetricHistogram::BucketIndex(32), 32u);
+    EXPECT_EQ(MetricHistogram::BucketIndex(33), 32u);
+    EXPECT_EQ(MetricHistogram::BucketHighestValue(32), 33u);
+    EXPECT_EQ(MetricHistogram::BucketIndex(UINT32_MAX), MetricHistogram::kBucketCount - 1);
+    EXPECT_EQ(MetricHistogram::BucketHighestValue(MetricHistogram::kBucketCount - 1), UINT32_MAX);
+
+    for (uint32_t value : { 100u, 1000u, 65535u, 65536u, 1234567u, 0x80000000u })
+    {
+        size_t index = MetricHistogram::BucketIndex(value);
+        EXPECT_LE(value, MetricHistogram::BucketHighestValue(index));
+        EXPECT_GT(value, MetricHistogram::BucketHighestValue(index - 1));
+    }
+}
+
+TEST(TestMetricHistograms, TestPercentiles)
+{
+    MetricHistogram histogram;
+    EXPECT_EQ(histogram.ValueAtPercentile(50), 0u);
+
+    // 1..100 in a shuffled order.
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        histogram.Record((i * 37) % 100 + 1);
+    }
+
+    EXPECT_EQ(histogram.Count(), 100u);
+    EXPECT_EQ(histogram.Min(), 1u);
+    EXPECT_EQ(histogram.Max(), 100u);
+    EXPECT_EQ(histogram.ValueAtPercentile(0), 1u);
+    EXPECT_EQ(histogram.ValueAtPercentile(100), 100u);
+
+    // Within the bucket precision of the exact values.
+    EXPECT_GE(histogram.ValueAtPercentile(50), 50u);
+    EXPECT_LE(histogram.ValueAtPercentile(50), 50u + 50u / MetricHistogram::kSubBuckets);
+    EXPECT_GE(histogram.ValueAtPercentile(90), 90u);
+    EXPECT_LE(histogram.ValueAtPercentile(90), 90u + 90u / MetricHistogram::kSubBuckets);
+    EXPECT_GE(histogram.ValueAtPercentile(99), 99u);
+    EXPECT_LE(histogram.ValueAtPercentile(99), 100u);
+
+    histogram.Reset();
+    EXPECT_EQ(histogram.Count(), 0u);
+    EXPECT_EQ(histogram.Max(), 0u);
+}
+
+TEST(TestMetricHistograms, TestDurations)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+    MetricHistogramBackend backend;
+
+    MetricSummary summary;
+    EXPECT_EQ(backend.GetSummary(kTestDuration, summary), CHIP_ERROR_NOT_FOUND);
+
+    // Two overlapping operations, ended in order: 10 ms and 15 ms.
+    clock.SetMonotonic(1000_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestDuration));
+    clock.SetMonotonic(1005_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestDuration));
+    clock.SetMonotonic(1010_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestDuration, CHIP_NO_ERROR));
+    clock.SetMonotonic(1020_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestDuration));
+
+    // A failed operation only counts as an error.
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestDuration));
+    clock.SetMonotonic(1500_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestDuration, CHIP_ERROR_TIMEOUT));
+
+    // An end without a begin is not a duration.
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestDuration));
+
+    ASSERT_EQ(backend.GetSummary(kTestDuration, summary), CHIP_NO_ERROR);
+    EXPECT_STREQ(summary.key, kTestDuration);
+    EXPECT_TRUE(summary.isDuration);
+    EXPECT_EQ(summary.count, 2u);
+    EXPECT_EQ(summary.errors, 1u);
+    EXPECT_EQ(summary.min, 10000u);
+    EXPECT_GE(summary.p50, 10000u);
+    EXPECT_LT(summary.p50, 15000u);
+    EXPECT_EQ(summary.p99, 15000u);
+    EXPECT_EQ(summary.max, 15000u);
+}
+
+TEST(TestMetricHistograms, TestStaleBeginsAreDropped)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+    MetricHistogramBackend backend;
+
+    // An operation that never ended...
+    clock.SetMonotonic(1000_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestDuration));
+
+    // ... must not be paired with a later one.
+    clock.AdvanceMonotonic(MetricHistogramBackend::kMaxPendingAge + 1_s);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kBeginEvent, kTestDuration));
+    clock.AdvanceMonotonic(30_ms64);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, kTestDuration));
+
+    MetricSummary summary;
+    ASSERT_EQ(backend.GetSummary(kTestDuration, summary), CHIP_NO_ERROR);
+    EXPECT_EQ(summary.count, 1u);
+    EXPECT_EQ(summary.max, 30000u);
+}
+
+TEST(TestMetricHistograms, TestInstantValues)
+{
+    MetricHistogramBackend backend;
+
+    for (uint32_t retries : { 1u, 1u, 2u, 5u })
+    {
+        backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestValue, retries));
+    }
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestValue, int32_t(3)));
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestValue, int32_t(-1)));
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestValue, CHIP_ERROR_NO_MEMORY));
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, kTestValue, CHIP_NO_ERROR));
+
+    // Keys with the same contents are the same metric.
+    std::string sameKey(kTestValue);
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, sameKey.c_str(), 4u));
+
+    MetricSummary summary;
+    ASSERT_EQ(backend.GetSummary(kTestValue, summary), CHIP_NO_ERROR);
+    EXPECT_FALSE(summary.isDuration);
+    EXPECT_EQ(summary.count, 6u);
+    EXPECT_EQ(summary.errors, 1u);
+    EXPECT_EQ(summary.min, 1u);
+    EXPECT_EQ(summary.p50, 2u);
+    EXPECT_EQ(summary.max, 5u);
+
+    std::vector<std::string> keys;
+    backend.ForEachSummary([&keys](const MetricSummary & s) { keys.emplace_back(s.key); });
+    ASSERT_EQ(keys.size(), 1u);
+    EXPECT_EQ(keys[0], kTestValue);
+
+    backend.Reset();
+    ASSERT_EQ(backend.GetSummary(kTestValue, summary), CHIP_NO_ERROR);
+    EXPECT_EQ(summary.count, 0u);
+    EXPECT_EQ(summary.errors, 0u);
+}
+
+} // namespace
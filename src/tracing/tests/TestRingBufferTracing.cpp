@@ -0,0 +1,183 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <tracing/metric_event.h>
+#include <tracing/ring_buffer/ring_buffer_tracing.h>
+#include <tracing/ring_buffer/trace_decoder.h>
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace chip;
+using namespace chip::Tracing;
+using namespace chip::Tracing::RingBuffer;
+
+namespace {
+
+size_t CountOccurrences(const std::string & text, const std::string & pattern)
+{
+    size_t count = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+    {
+        count++;
+    }
+    return count;
+}
+
+/// Dumps `backend` to a temporary file and decodes it.
+std::string DumpAndDecode(const RingBufferBackend & backend)
+{
+    char path[] = "/tmp/ring-buffer-trace-XXXXXX";
+    int fd      = mkstemp(path);
+    EXPECT_GE(fd, 0);
+    EXPECT_EQ(backend.Dump(fd), CHIP_NO_ERROR);
+    close(fd);
+
+    std::ifstream dump(path, std::ios::binary);
+    std::ostringstream json;
+    EXPECT_EQ(ConvertToChromeTrace(dump, json), CHIP_NO_ERROR);
+    unlink(path);
+    return json.str();
+}
+
+TEST(TestRingBufferTracing, TestEmptyDump)
+{
+    RingBufferBackend backend;
+    EXPECT_EQ(DumpAndDecode(backend), "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n");
+}
+
+TEST(TestRingBufferTracing, TestRecordsAreDecoded)
+{
+    RingBufferBackend backend;
+
+    backend.TraceBegin("Outer", "Group");
+    backend.TraceInstant("Quote\"d", "Group");
+    backend.TraceCounter("Counter");
+    backend.TraceCounter("Counter");
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kInstantEvent, "metric_int", int32_t(-5)));
+    backend.LogMetricEvent(MetricEvent(MetricEvent::Type::kEndEvent, "metric_error", CHIP_ERROR_INTERNAL));
+    backend.TraceEnd("Outer", "Group");
+
+    std::string json = DumpAndDecode(backend);
+    EXPECT_NE(json.find("{\"name\":\"Outer\",\"cat\":\"Group\",\"ph\":\"B\""), std::string::npos);
+    EXPECT_NE(json.find("{\"name\":\"Outer\",\"cat\":\"Group\",\"ph\":\"E\""), std::string::npos);
+    EXPECT_NE(json.find("{\"name\":\"Quote\\\"d\",\"cat\":\"Group\",\"ph\":\"i\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"count\":1}"), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"count\":2}"), std::string::npos);
+    EXPECT_NE(json.find("{\"name\":\"metric_int\",\"cat\":\"Metric\",\"ph\":\"i\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"value\":-5}"), std::string::npos);
+    EXPECT_NE(json.find("{\"name\":\"metric_error\",\"cat\":\"Metric\",\"ph\":\"E\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"error\":\"0x000000ac\"}"), std::string::npos);
+
+    // Events are in order.
+    EXPECT_LT(json.find("\"ph\":\"B\""), json.find("\"ph\":\"i\""));
+    EXPECT_LT(json.find("\"ph\":\"i\""), json.find("\"ph\":\"E\""));
+}
+
+TEST(TestRingBufferTracing, TestRingKeepsNewestRecords)
+{
+    RingBufferBackend backend(16);
+
+    for (int i = 0; i < 50; i++)
+    {
+        backend.TraceInstant("Old", "Group");
+    }
+    for (int i = 0; i < 50; i++)
+    {
+        backend.TraceInstant("New", "Group");
+    }
+
+    std::string json = DumpAndDecode(backend);
+    EXPECT_EQ(CountOccurrences(json, "\"name\":\"Old\""), 0u);
+    EXPECT_EQ(CountOccurrences(json, "\"name\":\"New\""), 16u);
+}
+
+TEST(TestRingBufferTracing, TestThreadsHaveTheirOwnRings)
+{
+    constexpr int kThreads         = 4;
+    constexpr int kEventsPerThread = 100;
+
+    RingBufferBackend backend(1024);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < kThreads; i++)
+    {
+        threads.emplace_back([&backend] {
+            for (int n = 0; n < kEventsPerThread; n++)
+            {
+                backend.TraceBegin("Work", "Thread");
+                backend.TraceEnd("Work", "Thread");
+            }
+        });
+    }
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    std::string json = DumpAndDecode(backend);
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"B\""), static_cast<size_t>(kThreads * kEventsPerThread));
+    EXPECT_EQ(CountOccurrences(json, "\"ph\":\"E\""), static_cast<size_t>(kThreads * kEventsPerThread));
+    for (int tid = 1; tid <= kThreads; tid++)
+    {
+        EXPECT_EQ(CountOccurrences(json, "\"tid\":" + std::to_string(tid) + "}"), static_cast<size_t>(2 * kEventsPerThread));
+    }
+}
+
+TEST(TestRingBufferTracing, TestDumpWhileTracing)
+{
+    RingBufferBackend backend(64);
+    std::atomic<bool> stop{ false };
+
+    std::thread writer([&] {
+        while (!stop)
+        {
+            backend.TraceInstant("Busy", "Thread");
+        }
+    });
+
+    // Every dump must decode, whatever the writer overwrote while it was being taken.
+    for (int i = 0; i < 20; i++)
+    {
+        std::string json = DumpAndDecode(backend);
+        EXPECT_LE(CountOccurrences(json, "\"name\":\"Busy\""), 64u);
+        EXPECT_EQ(CountOccurrences(json, "\"name\":\"0x"), 0u);
+    }
+
+    stop = true;
+    writer.join();
+}
+
+TEST(TestRingBufferTracing, TestRejectsInvalidDumps)
+{
+    std::istringstream notADump("not a ring buffer trace dump");
+    std::ostringstream json;
+    EXPECT_EQ(ConvertToChromeTrace(notADump, json), CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+
+    std::istringstream empty("");
+    EXPECT_EQ(ConvertToChromeTrace(empty, json), CHIP_ERROR_READ_FAILED);
+}
+
+} // namespace
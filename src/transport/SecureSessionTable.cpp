@@ -24,6 +24,29 @@
 namespace chip {
 namespace Transport {
 
+template <typename... Args>
+SecureSession * SecureSessionTable::AllocateEntry(Args &&... args)
+{
+    SecureSession * session = mEntries.CreateObject(*this, std::forward<Args>(args)...);
+    VerifyOrReturnValue(session != nullptr, nullptr);
+
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    if (!mLocalSessionIdIndex.Insert(session->GetLocalSessionId(), session))
+    {
+        mEntries.ReleaseObject(session);
+        return nullptr;
+    }
+    if (!mPeerIndex.Insert(HashPeer(session->GetPeer()), session))
+    {
+        mLocalSessionIdIndex.Remove(session->GetLocalSessionId(), session);
+        mEntries.ReleaseObject(session);
+        return nullptr;
+    }
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
+    return session;
+}
+
 Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(SecureSession::Type secureSessionType,
                                                                           uint16_t localSessionId, NodeId localNodeId,
                                                                           NodeId peerNodeId, CATValues peerCATs,
@@ -51,8 +74,8 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
         }
     }
 
-    SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
-                                                   peerSessionId, fabricIndex, config);
+    SecureSession * result =
+        AllocateEntry(secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs, peerSessionId, fabricIndex, config);
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -72,7 +95,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     //
     if (mEntries.Allocated() < GetMaxSessionTableSize())
     {
-        allocated = mEntries.CreateObject(*this, secureSessionType, sessionId.Value());
+        allocated = AllocateEntry(secureSessionType, sessionId.Value());
     }
     else
     {
@@ -215,7 +238,7 @@ SecureSession * SecureSessionTable::EvictAndAllocate(uint16_t localSessionId, Se
         if (newCount < prevCount)
         {
             ChipLogProgress(SecureChannel, "Successfully evicted a session!");
-            auto * retSession = mEntries.CreateObject(*this, secureSessionType, localSessionId);
+            auto * retSession = AllocateEntry(secureSessionType, localSessionId);
             VerifyOrDie(session != nullptr);
             return retSession;
         }
@@ -338,6 +361,10 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
 
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    SecureSession * result = mLocalSessionIdIndex.Find(
+        localSessionId, [localSessionId](const SecureSession * session) { return session->GetLocalSessionId() == localSessionId; });
+#else
     SecureSession * result = nullptr;
     mEntries.ForEachActiveObject([&](auto session) {
         if (session->GetLocalSessionId() == localSessionId)
@@ -347,11 +374,28 @@ Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t
         }
         return Loop::Continue;
     });
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
+    {
+        if (candidate == kUnsecuredSessionId)
+        {
+            continue;
+        }
+        auto matchesCandidate = [candidate](const SecureSession * session) { return session->GetLocalSessionId() == candidate; };
+        if (mLocalSessionIdIndex.Find(candidate, matchesCandidate) == nullptr)
+        {
+            return MakeOptional<uint16_t>(candidate);
+        }
+    }
+    return NullOptional;
+#else
     uint16_t candidate_base = 0;
     uint64_t candidate_mask = 0;
     for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
@@ -400,6 +444,7 @@ Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
     }
 
     return NullOptional;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
 }
 
 } // namespace Transport
@@ -18,6 +18,7 @@
 
 #include <lib/core/CHIPError.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/HashIndex.h>
 #include <lib/support/Pool.h>
 #include <lib/support/SortUtils.h>
 #include <system/TimeSource.h>
@@ -39,7 +40,14 @@ inline constexpr uint16_t kUnsecuredSessionId = 0;
 class SecureSessionTable
 {
 public:
-    ~SecureSessionTable() { mEntries.ReleaseAll(); }
+    ~SecureSessionTable()
+    {
+        mEntries.ReleaseAll();
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        mLocalSessionIdIndex.Clear();
+        mPeerIndex.Clear();
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
 
     void Init() { mNextSessionId = chip::Crypto::GetRandU16(); }
 
@@ -76,7 +84,14 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        VerifyOrDie(mLocalSessionIdIndex.Remove(session->GetLocalSessionId(), session));
+        VerifyOrDie(mPeerIndex.Remove(HashPeer(session->GetPeer()), session));
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        mEntries.ReleaseObject(session);
+    }
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -84,6 +99,38 @@ public:
         return mEntries.ForEachActiveObject(std::forward<Function>(function));
     }
 
+    /**
+     * Call `function(SecureSession *)` for every session, in any state, whose peer is the given
+     * ScopedNodeId. Uses the peer index when CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX is enabled.
+     */
+    template <typename Function>
+    Loop ForEachSessionWithPeer(const ScopedNodeId & peer, Function && function)
+    {
+        auto matchingPeer = [&peer, &function](SecureSession * session) {
+            return (session->GetPeer() == peer) ? function(session) : Loop::Continue;
+        };
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        return mPeerIndex.ForEach(HashPeer(peer), matchingPeer);
+#else
+        return mEntries.ForEachActiveObject(std::move(matchingPeer));
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+
+    // Called by a session before and after its peer (node ID or fabric index) changes, to keep the peer index up to date.
+    // This is an internal API, using raw pointer to a session is allowed here.
+    void OnPeerChanging(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        VerifyOrDie(mPeerIndex.Remove(HashPeer(session->GetPeer()), session));
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+    void OnPeerChanged(SecureSession * session)
+    {
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+        VerifyOrDie(mPeerIndex.Insert(HashPeer(session->GetPeer()), session));
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    }
+
     /**
      * Get a secure session given its session ID.
      *
@@ -100,7 +147,7 @@ public:
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionWithPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
@@ -110,7 +157,7 @@ public:
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
+            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE &&
                 oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
@@ -240,16 +287,27 @@ private:
     SecureSession * EvictAndAllocate(uint16_t localSessionId, SecureSession::Type secureSessionType,
                                      const ScopedNodeId & sessionEvictionHint);
 
+    /**
+     * Construct a session in the pool and add it to the indexes, if enabled.
+     *
+     * @return the new session, or nullptr if the pool or the indexes are full
+     */
+    template <typename... Args>
+    SecureSession * AllocateEntry(Args &&... args);
+
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
+     * Without the session table index, the search algorithm iterates over the session ID space in the
+     * outer loop and the session table in the inner loop to locate an available session ID from the
+     * starting mNextSessionId clue.
      *
      * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).
+     *
+     * With the session table index, candidate IDs starting at mNextSessionId are looked up in the
+     * local session ID index, and since the session ID space is sparsely used the first candidate
+     * is almost always available.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
@@ -259,6 +317,20 @@ private:
     bool mRunningEvictionLogic = false;
     ObjectPool<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mEntries;
 
+#if CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+    static uint32_t HashPeer(const ScopedNodeId & peer)
+    {
+        const NodeId nodeId = peer.GetNodeId();
+        return static_cast<uint32_t>(nodeId) ^ static_cast<uint32_t>(nodeId >> 32) ^
+            (static_cast<uint32_t>(peer.GetFabricIndex()) << 24);
+    }
+
+    // Every session in mEntries is indexed by its local session ID and by its peer (sessions still being
+    // established are indexed under an undefined peer until they are activated).
+    HashIndex<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mLocalSessionIdIndex;
+    HashIndex<SecureSession, CHIP_CONFIG_SECURE_SESSION_POOL_SIZE> mPeerIndex;
+#endif // CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX
+
     size_t GetMaxSessionTableSize() const
     {
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <transport/SessionCryptoWorkerPool.h>
+
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace Transport {
+
+void SessionCryptoWorkerPool::JobQueue::Push(Job & job)
+{
+    job.mNext = nullptr;
+    if (tail == nullptr)
+    {
+        head = &job;
+    }
+    else
+    {
+        tail->mNext = &job;
+    }
+    tail = &job;
+}
+
+SessionCryptoWorkerPool::Job * SessionCryptoWorkerPool::JobQueue::Pop()
+{
+    Job * job = head;
+    if (job != nullptr)
+    {
+        head       = job->mNext;
+        job->mNext = nullptr;
+        if (head == nullptr)
+        {
+            tail = nullptr;
+        }
+    }
+    return job;
+}
+
+CHIP_ERROR SessionCryptoWorkerPool::Init(System::LayerSelectLoop & systemLayer, size_t threadCount)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(threadCount > 0 && threadCount <= kMaxThreads, CHIP_ERROR_INVALID_ARGUMENT);
+
+#if CHIP_SYSTEM_CONFIG_USE_LIBEV || CHIP_SYSTEM_CONFIG_USE_LWIP
+    // libev event loops cannot be signaled, and LwIP packet buffers cannot be allocated off the Matter thread.
+    (void) systemLayer;
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#else
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = false;
+    }
+
+    mSystemLayer = &systemLayer;
+    mThreadCount = threadCount;
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        Worker & worker = mWorkers[i];
+        worker.thread   = std::thread([this, &worker] { WorkerMain(worker); });
+    }
+    mSystemLayer->AddLoopHandler(*this);
+
+    ChipLogProgress(Inet, "Session crypto offloaded to %u worker threads", static_cast<unsigned>(threadCount));
+    return CHIP_NO_ERROR;
+#endif
+}
+
+void SessionCryptoWorkerPool::Shutdown()
+{
+    VerifyOrReturn(IsInitialized());
+
+    WaitForAllJobs();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    for (size_t i = 0; i < mThreadCount; i++)
+    {
+        mWorkers[i].wakeUp.notify_one();
+        mWorkers[i].thread.join();
+    }
+
+    mSystemLayer->RemoveLoopHandler(*this);
+    mSystemLayer = nullptr;
+    mThreadCount = 0;
+}
+
+void SessionCryptoWorkerPool::Submit(Job & job, uint32_t orderingKey)
+{
+    VerifyOrDie(IsInitialized());
+
+    Worker & worker = mWorkers[orderingKey % mThreadCount];
+    bool wakeWorker;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        // A worker only sleeps once its queue is empty, so it needs no wake up while it has jobs left.
+        wakeWorker = worker.jobs.Empty();
+        worker.jobs.Push(job);
+    }
+    mPendingJobCount++;
+    if (wakeWorker)
+    {
+        worker.wakeUp.notify_one();
+    }
+}
+
+void SessionCryptoWorkerPool::WaitForCompletedJobs()
+{
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mJobFinished.wait(lock, [this] { return mPendingJobCount == 0 || !mFinishedJobs.Empty(); });
+    }
+    CompleteFinishedJobs();
+}
+
+void SessionCryptoWorkerPool::WaitForAllJobs()
+{
+    while (mPendingJobCount > 0)
+    {
+        WaitForCompletedJobs();
+    }
+}
+
+void SessionCryptoWorkerPool::CompleteFinishedJobs()
+{
+    // Jobs are taken one at a time: completing a job may complete further jobs (e.g. when it waits for room
+    // to submit another one), which must not overtake the jobs that finished before them.
+    while (true)
+    {
+        Job * job;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            job = mFinishedJobs.Pop();
+        }
+        VerifyOrReturn(job != nullptr);
+
+        mPendingJobCount--;
+        job->Complete();
+    }
+}
+
+void SessionCryptoWorkerPool::WorkerMain(Worker & worker)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        worker.wakeUp.wait(lock, [this, &worker] { return mStopping || !worker.jobs.Empty(); });
+        Job * job = worker.jobs.Pop();
+        if (job == nullptr)
+        {
+            // Stopping, and all jobs have run.
+            return;
+        }
+
+        lock.unlock();
+        job->Run();
+        lock.lock();
+
+        bool wakeMatterThread = mFinishedJobs.Empty();
+        mFinishedJobs.Push(*job);
+        mJobFinished.notify_one();
+        if (wakeMatterThread)
+        {
+            // A previous wake up is still pending otherwise. Signal() only writes to the wake pipe of the
+            // event loop, so it is safe to call with the lock held.
+            mSystemLayer->Signal();
+        }
+    }
+}
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
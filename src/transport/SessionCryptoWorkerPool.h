@@ -0,0 +1,146 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *   This file defines a pool of worker threads that runs the cryptography of
+ *   secure sessions off the Matter thread.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
+#include <lib/core/CHIPError.h>
+#include <system/SystemLayer.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace chip {
+namespace Transport {
+
+/**
+ * A bounded pool of worker threads for message encryption and decryption.
+ *
+ * Jobs are submitted from the Matter thread along with an ordering key, e.g. the local session ID of the
+ * message. Jobs with the same key run one after the other on the same worker and complete on the Matter
+ * thread in the order they were submitted, so that messages of a session keep their order while messages
+ * of independent sessions are processed in parallel.
+ *
+ * Completions are delivered by the event loop of the System::LayerSelectLoop the pool is initialized with,
+ * which the workers wake up through Signal().
+ *
+ * Job::Run() must only touch state owned by the job, and the crypto backend must support being used from
+ * several threads at once.
+ */
+class SessionCryptoWorkerPool : private System::EventLoopHandler
+{
+public:
+    static constexpr size_t kMaxThreads = CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_THREADS;
+
+    class Job
+    {
+    public:
+        virtual ~Job() = default;
+
+        /// Does the work of the job. Called on a worker thread.
+        virtual void Run() = 0;
+
+        /// Called on the Matter thread once Run() has returned. The pool no longer references the job
+        /// once this is called, so the job may release itself.
+        virtual void Complete() = 0;
+
+    private:
+        friend class SessionCryptoWorkerPool;
+        Job * mNext = nullptr;
+    };
+
+    SessionCryptoWorkerPool() = default;
+    ~SessionCryptoWorkerPool() override { Shutdown(); }
+
+    SessionCryptoWorkerPool(const SessionCryptoWorkerPool &)             = delete;
+    SessionCryptoWorkerPool & operator=(const SessionCryptoWorkerPool &) = delete;
+
+    /**
+     * Starts `threadCount` workers (at most kMaxThreads) whose jobs complete in the event loop of `systemLayer`.
+     *
+     * @retval CHIP_ERROR_NOT_IMPLEMENTED if the event loop cannot be woken up from other threads.
+     */
+    CHIP_ERROR Init(System::LayerSelectLoop & systemLayer, size_t threadCount);
+
+    /// Completes all submitted jobs and stops the workers.
+    void Shutdown();
+
+    bool IsInitialized() const { return mSystemLayer != nullptr; }
+    size_t GetThreadCount() const { return mThreadCount; }
+
+    /// Number of jobs submitted that have not completed yet.
+    size_t GetPendingJobCount() const { return mPendingJobCount; }
+
+    /// Queues `job` to run after the jobs previously submitted with the same `orderingKey`.
+    void Submit(Job & job, uint32_t orderingKey);
+
+    /// Completes the jobs that have run, first waiting for one to finish if there are pending jobs but none has run yet.
+    void WaitForCompletedJobs();
+
+    /// Waits for all submitted jobs to run and completes them.
+    void WaitForAllJobs();
+
+private:
+    struct JobQueue
+    {
+        Job * head = nullptr;
+        Job * tail = nullptr;
+
+        bool Empty() const { return head == nullptr; }
+        void Push(Job & job);
+        Job * Pop();
+    };
+
+    struct Worker
+    {
+        std::thread thread;
+        std::condition_variable wakeUp;
+        JobQueue jobs; // guarded by mMutex
+    };
+
+    void HandleEvents() override { CompleteFinishedJobs(); }
+
+    void WorkerMain(Worker & worker);
+    void CompleteFinishedJobs();
+
+    System::LayerSelectLoop * mSystemLayer = nullptr;
+    Worker mWorkers[kMaxThreads];
+    size_t mThreadCount     = 0;
+    size_t mPendingJobCount = 0; // only used on the Matter thread
+
+    std::mutex mMutex;
+    std::condition_variable mJobFinished;
+    JobQueue mFinishedJobs; // guarded by mMutex
+    bool mStopping = false; // guarded by mMutex
+};
+
+} // namespace Transport
+} // namespace chip
+
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
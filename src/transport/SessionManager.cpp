@@ -146,6 +146,11 @@ void SessionManager::Shutdown()
     // Ensure that we don't create new sessions as we iterate our session table.
     mState = State::kNotReady;
 
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+    // Release the messages still being decrypted; they are no longer dispatched.
+    SetCryptoWorkerPool(nullptr);
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
     // Just in case some consumer forgot to do it, expire all our secure
     // sessions.  Note that this stands a good chance of crashing with a
     // null-deref if there are in fact any secure sessions left, since they will
@@ -582,9 +587,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionWithPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -594,10 +598,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionWithPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -879,8 +883,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
 {
     MATTER_TRACE_SCOPE("Secure Unicast Message Dispatch", "SessionManager");
 
-    CHIP_ERROR err = CHIP_NO_ERROR;
-
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     if (peerAddress.GetTransportType() == Transport::Type::kTcp && ctxt->conn.IsNull())
     {
@@ -939,8 +941,6 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     PacketHeader packetHeader;
     ReturnOnFailure(packetHeader.DecodeAndConsume(msg));
 
-    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
-
     if (msg.IsNull())
     {
         ChipLogError(Inet, "Secure transport received Unicast NULL packet, discarding");
@@ -967,6 +967,15 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     CHIP_ERROR nonceResult = CryptoContext::BuildNonce(
         nonce, packetHeader.GetSecurityFlags(), packetHeader.GetMessageCounter(),
         secureSession->GetSecureSessionType() == SecureSession::Type::kCASE ? secureSession->GetPeerNodeId() : kUndefinedNodeId);
+
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+    if (mCryptoWorkerPool != nullptr && nonceResult == CHIP_NO_ERROR)
+    {
+        OffloadDecryption(session.Value(), peerAddress, packetHeader, nonce, std::move(msg), messageTotalSize);
+        return;
+    }
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
     if ((nonceResult != CHIP_NO_ERROR) ||
         SecureMessageCodec::Decrypt(secureSession->GetCryptoContext(), nonce, payloadHeader, packetHeader, msg) != CHIP_NO_ERROR)
     {
@@ -974,7 +983,20 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
         return;
     }
 
-    err =
+    DecryptedSecureUnicastMessageDispatch(session.Value(), peerAddress, packetHeader, payloadHeader, std::move(msg),
+                                          messageTotalSize);
+}
+
+void SessionManager::DecryptedSecureUnicastMessageDispatch(const SessionHandle & session,
+                                                           const Transport::PeerAddress & peerAddress,
+                                                           const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                                           System::PacketBufferHandle && msg,
+                                                           [[maybe_unused]] size_t messageTotalSize)
+{
+    Transport::SecureSession * secureSession             = session->AsSecureSession();
+    SessionMessageDelegate::DuplicateMessage isDuplicate = SessionMessageDelegate::DuplicateMessage::No;
+
+    CHIP_ERROR err =
         secureSession->GetSessionMessageCounter().GetPeerMessageCounter().VerifyEncryptedUnicast(packetHeader.GetMessageCounter());
     if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
     {
@@ -1020,8 +1042,8 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
                                                              mFabricTable->GetPendingNewFabricIndex());
         }
 
-        CountMessagesReceived(session.Value(), payloadHeader);
-        mCB->OnMessageReceived(packetHeader, payloadHeader, session.Value(), isDuplicate, std::move(msg));
+        CountMessagesReceived(session, payloadHeader);
+        mCB->OnMessageReceived(packetHeader, payloadHeader, session, isDuplicate, std::move(msg));
     }
     else
     {
@@ -1029,6 +1051,80 @@ void SessionManager::SecureUnicastMessageDispatch(const PacketHeader & partialPa
     }
 }
 
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+SessionManager::DecryptJob::DecryptJob(SessionManager & sessionManager, const SessionHandle & session,
+                                       const Transport::PeerAddress & peerAddress, const PacketHeader & packetHeader,
+                                       const CryptoContext::NonceStorage & nonce, System::PacketBufferHandle && msg,
+                                       size_t messageTotalSize) :
+    mSessionManager(sessionManager),
+    mSession(*session->AsSecureSession()), mCryptoContext(session->AsSecureSession()->GetCryptoContext()),
+    mPeerAddress(peerAddress), mPacketHeader(packetHeader), mNonce(nonce), mMsg(std::move(msg)), mMessageTotalSize(messageTotalSize)
+{}
+
+void SessionManager::DecryptJob::Run()
+{
+    mResult = SecureMessageCodec::Decrypt(mCryptoContext, mNonce, mPayloadHeader, mPacketHeader, mMsg);
+}
+
+void SessionManager::SetCryptoWorkerPool(Transport::SessionCryptoWorkerPool * pool)
+{
+    if (mCryptoWorkerPool != nullptr)
+    {
+        // Dispatch in order what was received before.
+        mCryptoWorkerPool->WaitForAllJobs();
+    }
+    mCryptoWorkerPool = pool;
+}
+
+void SessionManager::OffloadDecryption(const SessionHandle & session, const Transport::PeerAddress & peerAddress,
+                                       const PacketHeader & packetHeader, const CryptoContext::NonceStorage & nonce,
+                                       System::PacketBufferHandle && msg, size_t messageTotalSize)
+{
+    // Bound the number of messages held by the workers. Beyond that, drop the message as if it was lost: its counter is not
+    // committed, so the peer's retransmission is accepted. Waiting for room here would dispatch queued messages from within
+    // the transport's receive callback.
+    DecryptJob * job = nullptr;
+    if (mDecryptJobs.Allocated() < CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES)
+    {
+        job = mDecryptJobs.CreateObject(*this, session, peerAddress, packetHeader, nonce, std::move(msg), messageTotalSize);
+    }
+    if (job == nullptr)
+    {
+        ChipLogError(Inet, "Secure transport received message, but could not queue it for decryption, discarding");
+        return;
+    }
+
+    // Messages of a session are decrypted by the same worker, and dispatched, in the order they were received.
+    mCryptoWorkerPool->Submit(*job, packetHeader.GetSessionId());
+}
+
+void SessionManager::OnDecryptJobComplete(DecryptJob & job)
+{
+    // The session may have changed state while the message was being decrypted.
+    Transport::SecureSession * secureSession = job.mSession->AsSecureSession();
+    if (mState != State::kInitialized)
+    {
+        // Shutting down; drop the message.
+    }
+    else if (job.mResult != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Secure transport received message, but failed to decode/authenticate it, discarding");
+    }
+    else if (!secureSession->IsDefunct() && !secureSession->IsActiveSession() && !secureSession->IsPendingEviction())
+    {
+        ChipLogError(Inet, "Secure transport received message on a session in an invalid state (state = '%s')",
+                     secureSession->GetStateStr());
+    }
+    else
+    {
+        DecryptedSecureUnicastMessageDispatch(job.mSession, job.mPeerAddress, job.mPacketHeader, job.mPayloadHeader,
+                                              std::move(job.mMsg), job.mMessageTotalSize);
+    }
+
+    mDecryptJobs.ReleaseObject(&job);
+}
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
 /**
  * Helper function to implement a single attempt to decrypt a groupcast message
  * using the given group key and privacy setting.
@@ -1304,13 +1400,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionWithPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                        &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                        &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
                 transportPayloadCapability == TransportPayloadCapability::kLargePayload)
@@ -35,6 +35,7 @@
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/Pool.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
 #include <protocols/secure_channel/Constants.h>
 #include <transport/CryptoContext.h>
@@ -44,6 +45,7 @@
 #include <transport/MessageStats.h>
 #include <transport/SecureSessionTable.h>
 #include <transport/Session.h>
+#include <transport/SessionCryptoWorkerPool.h>
 #include <transport/SessionDelegate.h>
 #include <transport/SessionHolder.h>
 #include <transport/SessionMessageDelegate.h>
@@ -175,6 +177,19 @@ public:
     /// ExchangeManager)
     void SetMessageDelegate(SessionMessageDelegate * cb) { mCB = cb; }
 
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+    /**
+     * @brief
+     *   Decrypt incoming secure unicast messages on the workers of `pool`, or on the Matter thread if `pool`
+     *   is null. Decrypted messages are verified against their session's message counter and dispatched
+     *   on the Matter thread, in the order they were received for each session.
+     *
+     *   `pool` must be initialized with the event loop of this SessionManager's System::Layer, and outlive
+     *   its use by this SessionManager. Messages queued on a previous pool are dispatched before this returns.
+     */
+    void SetCryptoWorkerPool(Transport::SessionCryptoWorkerPool * pool);
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     void SetConnectionDelegate(SessionConnectionDelegate * cb) { mConnDelegate = cb; }
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
@@ -578,6 +593,41 @@ private:
 
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
 
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+    /// Decryption of an incoming secure unicast message on a worker thread.
+    class DecryptJob : public Transport::SessionCryptoWorkerPool::Job
+    {
+    public:
+        DecryptJob(SessionManager & sessionManager, const SessionHandle & session, const Transport::PeerAddress & peerAddress,
+                   const PacketHeader & packetHeader, const CryptoContext::NonceStorage & nonce, System::PacketBufferHandle && msg,
+                   size_t messageTotalSize);
+
+        void Run() override;
+        void Complete() override { mSessionManager.OnDecryptJobComplete(*this); }
+
+        SessionManager & mSessionManager;
+        // A reference rather than a SessionHolder, so that the keys outlive the job even if the session is released meanwhile.
+        SessionHandle mSession;
+        // Captured on the Matter thread so that the worker does not need to go through the session.
+        const CryptoContext & mCryptoContext;
+        Transport::PeerAddress mPeerAddress;
+        PacketHeader mPacketHeader;
+        PayloadHeader mPayloadHeader;
+        CryptoContext::NonceStorage mNonce;
+        System::PacketBufferHandle mMsg;
+        size_t mMessageTotalSize;
+        CHIP_ERROR mResult = CHIP_NO_ERROR;
+    };
+
+    void OffloadDecryption(const SessionHandle & session, const Transport::PeerAddress & peerAddress,
+                           const PacketHeader & packetHeader, const CryptoContext::NonceStorage & nonce,
+                           System::PacketBufferHandle && msg, size_t messageTotalSize);
+    void OnDecryptJobComplete(DecryptJob & job);
+
+    Transport::SessionCryptoWorkerPool * mCryptoWorkerPool = nullptr;
+    ObjectPool<DecryptJob, CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES> mDecryptJobs;
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure unicast message.
      *
@@ -591,6 +641,20 @@ private:
     void SecureUnicastMessageDispatch(const PacketHeader & partialPacketHeader, const Transport::PeerAddress & peerAddress,
                                       System::PacketBufferHandle && msg, Transport::MessageTransportContext * ctxt = nullptr);
 
+    /**
+     * @brief Validate and dispatch a secure unicast message once it has been decrypted.
+     *
+     * @param session The session the message was received on.
+     * @param peerAddress The PeerAddress of the message as provided by the receiving Transport Endpoint.
+     * @param packetHeader The decoded PacketHeader of the message.
+     * @param payloadHeader The decrypted PayloadHeader of the message.
+     * @param msg The decrypted payload of the message.
+     * @param messageTotalSize The size of the message as received, for tracing.
+     */
+    void DecryptedSecureUnicastMessageDispatch(const SessionHandle & session, const Transport::PeerAddress & peerAddress,
+                                               const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                               System::PacketBufferHandle && msg, size_t messageTotalSize);
+
     /**
      * @brief Parse, decrypt, validate, and dispatch a secure group message.
      *
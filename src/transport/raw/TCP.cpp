@@ -400,7 +400,10 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(const Inet::TCPEndPointHandle & endPoi
         // The subtraction will not underflow because we successfully read kPacketSizeBytes.
         if (messageSize > (state->mReceived->TotalLength() - kPacketSizeBytes))
         {
-            // We have not yet received the complete message.
+            // We have not yet received the complete message. If the endpoint can, have it receive the rest of the
+            // message directly after what we have, so that the message comes back in a single buffer rather than in
+            // pieces to reassemble. Otherwise, keep the pieces until the rest arrives.
+            RETURN_SAFELY_IGNORED endPoint->ReceiveInto(std::move(state->mReceived), kPacketSizeBytes + messageSize);
             return CHIP_NO_ERROR;
         }
 
@@ -426,14 +429,34 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
     // `state->mReceived->Start()` currently points to the message data.
     // On exit, `state->mReceived` will have had `messageSize` bytes consumed, no matter what.
     System::PacketBufferHandle message;
+    size_t headLength = state.mReceived->DataLength();
 
-    if (state.mReceived->DataLength() == messageSize)
+    if (headLength == messageSize)
     {
         // In this case, the head packet buffer contains exactly the message.
         // This is common because typical messages fit in a network packet, and are delivered as such.
         // Peel off the head to pass upstream, which effectively consumes it from `state->mReceived`.
         message = state.mReceived.PopHead();
     }
+    else if (headLength > messageSize && headLength - messageSize < messageSize)
+    {
+        // The head packet buffer contains the message, followed by a shorter start of the next messages.
+        // This is common for large messages, which fill most of a read. Rather than copy the message, move what
+        // follows it to a fresh buffer, and peel off the head to pass upstream.
+        System::PacketBufferHandle rest =
+            System::PacketBufferHandle::NewWithData(state.mReceived->Start() + messageSize, headLength - messageSize, 0, 0);
+        if (rest.IsNull())
+        {
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        message = state.mReceived.PopHead();
+        message->SetDataLength(messageSize);
+        if (!state.mReceived.IsNull())
+        {
+            rest->AddToEnd(std::move(state.mReceived));
+        }
+        state.mReceived = std::move(rest);
+    }
     else
     {
         // The message is either longer or shorter than the head buffer.
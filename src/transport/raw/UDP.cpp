@@ -57,6 +57,7 @@ CHIP_ERROR UDP::Init(UdpListenParameters & params)
     SuccessOrExit(err);
 
     mUDPEndpointType = params.GetAddressType();
+    mQueueSends      = params.GetQueueSends();
 
     mState = State::kInitialized;
 
@@ -100,6 +101,10 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     // Drop the message and return. Free the buffer.
     CHIP_FAULT_INJECT(FaultInjection::kFault_DropOutgoingUDPMsg, msgBuf = nullptr; return CHIP_ERROR_CONNECTION_ABORTED;);
 
+    if (mQueueSends)
+    {
+        return mUDPEndPoint->QueueMsg(&addrInfo, std::move(msgBuf));
+    }
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
 }
 
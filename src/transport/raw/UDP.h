@@ -86,12 +86,26 @@ public:
         return *this;
     }
 
+    /**
+     * Whether outgoing messages are queued on the endpoint, so that messages sent during the same event loop iteration can be
+     * sent together (see Inet::UDPEndPoint::QueueMsg).  Errors that happen when the messages are eventually sent are logged
+     * rather than returned by SendMessage.
+     */
+    bool GetQueueSends() const { return mQueueSends; }
+    UdpListenParameters & SetQueueSends(bool queueSends)
+    {
+        mQueueSends = queueSends;
+
+        return *this;
+    }
+
 private:
     Inet::EndPointManager<Inet::UDPEndPoint> * mEndPointManager;   ///< Associated endpoint factory
     Inet::IPAddressType mAddressType = Inet::IPAddressType::kIPv6; ///< type of listening socket
     uint16_t mListenPort             = CHIP_PORT;                  ///< UDP listen port
     Inet::InterfaceId mInterfaceId   = Inet::InterfaceId::Null();  ///< Interface to listen on
     void * mNativeParams             = nullptr;
+    bool mQueueSends                 = false; ///< Queue outgoing messages on the endpoint
 };
 
 /** Implements a transport using UDP. */
@@ -152,6 +166,7 @@ private:
     Inet::UDPEndPointHandle mUDPEndPoint;                                 ///< UDP socket used by the transport
     Inet::IPAddressType mUDPEndpointType = Inet::IPAddressType::kUnknown; ///< Socket listening type
     State mState                         = State::kNotReady;              ///< State of the UDP transport
+    bool mQueueSends                     = false;                         ///< Queue outgoing messages on the endpoint
 };
 
 } // namespace Transport
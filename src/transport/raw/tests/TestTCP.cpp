@@ -23,6 +23,7 @@
 
 #include "NetworkTestHelpers.h"
 
+#include <algorithm>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
@@ -1056,4 +1057,64 @@ TEST_F(TestTCP, CheckMaxTCPMessageSizeBoundary)
     EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, 1);
 }
 
+TEST_F(TestTCP, LargeMessageThroughput)
+{
+    // Messages of the largest size, sent back to back: each spans many reads of the socket, and the
+    // send queue backs up. Every message must still arrive intact and in order.
+    constexpr int kMessageCount = 64;
+
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    uint16_t port;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(mIOContext);
+    ASSERT_SUCCESS(gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr, port));
+
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr, port);
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+
+    // Message i is the pattern starting at offset i.
+    static uint8_t sPattern[kMaxLargeAppMessageLen + kMessageCount];
+    for (size_t i = 0; i < sizeof(sPattern); i++)
+    {
+        sPattern[i] = static_cast<uint8_t>(i);
+    }
+
+    gMockTransportMgrDelegate.SetCallback(
+        [](const uint8_t * message, size_t length, int count, ActiveTCPConnectionHandle & conn, void * data) -> CHIP_ERROR {
+            VerifyOrReturnError(length == kMaxLargeAppMessageLen, CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+            VerifyOrReturnError(memcmp(message, &sPattern[count], length) == 0, CHIP_ERROR_INTERNAL);
+            return CHIP_NO_ERROR;
+        });
+
+    uint64_t startUs = System::SystemClock().GetMonotonicMicroseconds64().count();
+    for (int i = 0; i < kMessageCount; i++)
+    {
+        System::PacketBufferHandle buffer = System::PacketBufferHandle::NewWithData(&sPattern[i], kMaxLargeAppMessageLen);
+        ASSERT_FALSE(buffer.IsNull());
+
+        PacketHeader header;
+        header.SetSourceNodeId(kSourceNodeId)
+            .SetDestinationNodeId(kDestinationNodeId)
+            .SetMessageCounter(kMessageCounter + 1 + static_cast<uint32_t>(i));
+        ASSERT_SUCCESS(header.EncodeBeforeData(buffer));
+        ASSERT_SUCCESS(tcp.SendMessage(Transport::PeerAddress::TCP(addr, port), std::move(buffer)));
+    }
+
+    mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(30), [&gMockTransportMgrDelegate]() {
+        return gMockTransportMgrDelegate.mReceiveHandlerCallCount >= kMessageCount;
+    });
+    uint64_t elapsedUs = System::SystemClock().GetMonotonicMicroseconds64().count() - startUs;
+    EXPECT_EQ(gMockTransportMgrDelegate.mReceiveHandlerCallCount, kMessageCount);
+
+    uint64_t totalBytes = static_cast<uint64_t>(kMessageCount) * kMaxLargeAppMessageLen;
+    ChipLogProgress(Test, "TCP large message throughput: %d messages of %u bytes in %u us (%u MB/s)", kMessageCount,
+                    static_cast<unsigned>(kMaxLargeAppMessageLen), static_cast<unsigned>(elapsedUs),
+                    static_cast<unsigned>(totalBytes / std::max<uint64_t>(elapsedUs, 1)));
+
+    gMockTransportMgrDelegate.SetCallback(nullptr);
+}
+
 } // namespace
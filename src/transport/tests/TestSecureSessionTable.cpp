@@ -43,6 +43,8 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateLookups();
+    void BenchmarkLookups();
 
 private:
     struct SessionParameters
@@ -85,6 +87,11 @@ private:
     //
     void CreateSessionTable(std::vector<SessionParameters> & sessionParams);
 
+    //
+    // Fill a new session table with `count` active CASE sessions, spread over `peers` peers on kFabric1.
+    //
+    void CreateActiveSessions(size_t count, size_t peers, std::vector<uint16_t> & localSessionIds);
+
     Platform::UniquePtr<SecureSessionTable> mSessionTable;
     std::vector<Platform::UniquePtr<SessionNotificationListener>> mSessionList;
 };
@@ -127,6 +134,135 @@ void TestSecureSessionTable::CreateSessionTable(std::vector<SessionParameters> &
     }
 }
 
+void TestSecureSessionTable::CreateActiveSessions(size_t count, size_t peers, std::vector<uint16_t> & localSessionIds)
+{
+    mSessionList.clear();
+    localSessionIds.clear();
+
+    mSessionTable = Platform::MakeUnique<SecureSessionTable>();
+    ASSERT_NE(mSessionTable.get(), nullptr);
+    mSessionTable->Init();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto session = mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+        ASSERT_TRUE(session.HasValue());
+
+        // Activation retains the session, so it stays in the table once the handle goes away.
+        session.Value()->AsSecureSession()->Activate(
+            ScopedNodeId(1, kFabric1), ScopedNodeId(static_cast<NodeId>(2 + i % peers), kFabric1), CATValues(),
+            static_cast<uint16_t>(i),
+            ReliableMessageProtocolConfig(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                          System::Clock::Milliseconds16(0)));
+        localSessionIds.push_back(session.Value()->AsSecureSession()->GetLocalSessionId());
+    }
+}
+
+void TestSecureSessionTable::ValidateLookups()
+{
+    constexpr size_t kSessions = 12;
+    constexpr size_t kPeers    = 4;
+
+    std::vector<uint16_t> localSessionIds;
+    CreateActiveSessions(kSessions, kPeers, localSessionIds);
+
+    for (size_t i = 0; i < kSessions; i++)
+    {
+        auto session = mSessionTable->FindSecureSessionByLocalKey(localSessionIds[i]);
+        ASSERT_TRUE(session.HasValue());
+        EXPECT_EQ(session.Value()->AsSecureSession()->GetLocalSessionId(), localSessionIds[i]);
+        EXPECT_EQ(session.Value()->GetPeer(), ScopedNodeId(static_cast<NodeId>(2 + i % kPeers), kFabric1));
+
+        // Allocated session IDs are unique.
+        for (size_t j = 0; j < i; j++)
+        {
+            EXPECT_NE(localSessionIds[i], localSessionIds[j]);
+        }
+    }
+    EXPECT_FALSE(mSessionTable->FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+
+    size_t withPeer = 0;
+    mSessionTable->ForEachSessionWithPeer(ScopedNodeId(3, kFabric1), [&](SecureSession * session) {
+        EXPECT_EQ(session->GetPeer(), ScopedNodeId(3, kFabric1));
+        withPeer++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(withPeer, kSessions / kPeers);
+
+    withPeer = 0;
+    mSessionTable->ForEachSessionWithPeer(ScopedNodeId(3, kFabric2), [&](SecureSession *) {
+        withPeer++;
+        return Loop::Continue;
+    });
+    EXPECT_EQ(withPeer, 0u);
+
+    // Evicting sessions while iterating removes them from both lookups.
+    mSessionTable->ForEachSessionWithPeer(ScopedNodeId(3, kFabric1), [&](SecureSession * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+    mSessionTable->ForEachSessionWithPeer(ScopedNodeId(3, kFabric1), [&](SecureSession *) {
+        ADD_FAILURE() << "evicted session still indexed";
+        return Loop::Continue;
+    });
+    for (size_t i = 0; i < kSessions; i++)
+    {
+        EXPECT_EQ(mSessionTable->FindSecureSessionByLocalKey(localSessionIds[i]).HasValue(), (2 + i % kPeers) != 3);
+    }
+}
+
+//
+// Benchmark: cost of the per-message lookup by local session ID, the per-peer lookup and session ID
+// allocation as a function of the number of sessions in the table.
+//
+void TestSecureSessionTable::BenchmarkLookups()
+{
+    constexpr size_t kIterations = 20000;
+
+    for (size_t count : { size_t(8), size_t(32), size_t(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE - 1) })
+    {
+        std::vector<uint16_t> localSessionIds;
+        CreateActiveSessions(count, count / 2 + 1, localSessionIds);
+        ASSERT_EQ(localSessionIds.size(), count);
+
+        size_t found                        = 0;
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            found += mSessionTable->FindSecureSessionByLocalKey(localSessionIds[(i * 7919) % count]).HasValue() ? 1 : 0;
+        }
+        System::Clock::Microseconds64 byLocalKey = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        EXPECT_EQ(found, kIterations);
+
+        size_t visited = 0;
+        start          = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            mSessionTable->ForEachSessionWithPeer(ScopedNodeId(static_cast<NodeId>(2 + i % (count / 2 + 1)), kFabric1),
+                                                  [&visited](SecureSession *) {
+                                                      visited++;
+                                                      return Loop::Continue;
+                                                  });
+        }
+        System::Clock::Microseconds64 byPeer = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        EXPECT_GE(visited, kIterations);
+
+        start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (size_t i = 0; i < kIterations; i++)
+        {
+            // Pending sessions are released as soon as the handle goes away.
+            EXPECT_TRUE(mSessionTable->CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId()).HasValue());
+        }
+        System::Clock::Microseconds64 allocation = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        ChipLogProgress(SecureChannel, "%u sessions (index %s): by local key %u ns, by peer %u ns, allocate %u ns",
+                        static_cast<unsigned>(count), CHIP_CONFIG_SECURE_SESSION_TABLE_INDEX ? "on" : "off",
+                        static_cast<unsigned>(byLocalKey.count() * 1000 / kIterations),
+                        static_cast<unsigned>(byPeer.count() * 1000 / kIterations),
+                        static_cast<unsigned>(allocation.count() * 1000 / kIterations));
+    }
+}
+
 void TestSecureSessionTable::ValidateSessionSorting()
 {
     //
@@ -461,5 +597,15 @@ TEST_F(TestSecureSessionTable, ValidateSessionSorting)
     ValidateSessionSorting();
 }
 
+TEST_F(TestSecureSessionTable, ValidateLookups)
+{
+    ValidateLookups();
+}
+
+TEST_F(TestSecureSessionTable, BenchmarkLookups)
+{
+    BenchmarkLookups();
+}
+
 } // namespace Transport
 } // namespace chip
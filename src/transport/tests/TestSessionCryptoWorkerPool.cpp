@@ -0,0 +1,448 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the SessionCryptoWorkerPool and
+ *      its use by SessionManager to decrypt incoming messages.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <crypto/PersistentStorageOperationalKeystore.h>
+#include <lib/core/CHIPCore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <protocols/echo/Echo.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <system/SystemConfig.h>
+#include <transport/SessionCryptoWorkerPool.h>
+#include <transport/SessionManager.h>
+#include <transport/TransportMgr.h>
+#include <transport/tests/LoopbackTransportManager.h>
+
+// The pool needs a select-based LayerSelectLoop that can be signaled from other threads
+#if CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD && CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH &&                    \
+    !CHIP_SYSTEM_CONFIG_USE_LIBEV
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Transport;
+using namespace chip::Testing;
+
+using TestContext = LoopbackTransportManager;
+
+// Just enough init to replace a ton of boilerplate
+class FabricTableHolder
+{
+public:
+    FabricTableHolder() {}
+    ~FabricTableHolder()
+    {
+        mFabricTable.Shutdown();
+        mOpKeyStore.Finish();
+        mOpCertStore.Finish();
+    }
+
+    CHIP_ERROR Init()
+    {
+        ReturnErrorOnFailure(mOpKeyStore.Init(&mStorage));
+        ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+        chip::FabricTable::InitParams initParams;
+        initParams.storage             = &mStorage;
+        initParams.operationalKeystore = &mOpKeyStore;
+        initParams.opCertStore         = &mOpCertStore;
+
+        return mFabricTable.Init(initParams);
+    }
+
+    FabricTable & GetFabricTable() { return mFabricTable; }
+
+private:
+    chip::FabricTable mFabricTable;
+    chip::TestPersistentStorageDelegate mStorage;
+    chip::PersistentStorageOperationalKeystore mOpKeyStore;
+    chip::Credentials::PersistentStorageOpCertStore mOpCertStore;
+};
+
+class RecordingJob : public SessionCryptoWorkerPool::Job
+{
+public:
+    void Run() override
+    {
+        ranOffMatterThread = (std::this_thread::get_id() != matterThread);
+        // Leave time for jobs submitted later to overtake this one if ordering was not enforced.
+        std::this_thread::sleep_for(std::chrono::microseconds(100 * (id % 3)));
+    }
+    void Complete() override
+    {
+        completedOnMatterThread = (std::this_thread::get_id() == matterThread);
+        completionOrder->push_back(id);
+    }
+
+    std::thread::id matterThread;
+    std::vector<uint32_t> * completionOrder = nullptr;
+    uint32_t id                             = 0;
+    bool ranOffMatterThread                 = false;
+    bool completedOnMatterThread            = false;
+};
+
+class ReceivedMessageRecorder : public SessionMessageDelegate
+{
+public:
+    void OnMessageReceived(const PacketHeader & header, const PayloadHeader & payloadHeader, const SessionHandle & session,
+                           DuplicateMessage isDuplicate, System::PacketBufferHandle && msgBuf) override
+    {
+        EXPECT_EQ(std::this_thread::get_id(), mMatterThread);
+        EXPECT_EQ(isDuplicate, DuplicateMessage::No);
+
+        if (mExpectedPayload != nullptr)
+        {
+            ASSERT_EQ(msgBuf->DataLength(), mExpectedPayloadLength);
+            EXPECT_EQ(memcmp(msgBuf->Start(), mExpectedPayload, mExpectedPayloadLength), 0);
+        }
+
+        // Messages of a session are dispatched in the order they were sent.
+        uint16_t sessionId = session->AsSecureSession()->GetLocalSessionId();
+        auto last          = mLastCounters.find(sessionId);
+        if (last != mLastCounters.end())
+        {
+            EXPECT_GT(header.GetMessageCounter(), last->second);
+        }
+        mLastCounters[sessionId] = header.GetMessageCounter();
+        mReceived++;
+    }
+
+    std::thread::id mMatterThread    = std::this_thread::get_id();
+    const uint8_t * mExpectedPayload = nullptr;
+    size_t mExpectedPayloadLength    = 0;
+    std::map<uint16_t, uint32_t> mLastCounters;
+    size_t mReceived = 0;
+};
+
+class TestSessionCryptoWorkerPool : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(mContext.Init(), CHIP_NO_ERROR);
+        ASSERT_EQ(mFabricTableHolder.Init(), CHIP_NO_ERROR);
+        ASSERT_EQ(mSessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &mMessageCounterManager,
+                                       &mDeviceStorage, &mFabricTableHolder.GetFabricTable(), mSessionKeystore),
+                  CHIP_NO_ERROR);
+        mSessionManager.SetMessageDelegate(&mRecorder);
+    }
+
+    void TearDown() override
+    {
+        mSenders.clear();
+        mReceivers.clear();
+        mSessionManager.Shutdown();
+        mPool.Shutdown();
+        mContext.Shutdown();
+    }
+
+    System::LayerSelectLoop & SystemLayer() { return static_cast<System::LayerSelectLoop &>(mContext.GetSystemLayer()); }
+
+    // Creates pairs of sessions of the same SessionManager: messages prepared on the sender of a pair
+    // are received on its receiver.
+    void CreateSessionPairs(size_t count)
+    {
+        Inet::IPAddress addr;
+        Inet::IPAddress::FromString("::1", addr);
+        const PeerAddress peer = PeerAddress::UDP(addr, CHIP_PORT);
+
+        mSenders.resize(count);
+        mReceivers.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            auto senderId   = static_cast<uint16_t>(2 * i + 1);
+            auto receiverId = static_cast<uint16_t>(2 * i + 2);
+            ASSERT_EQ(mSessionManager.InjectPaseSessionWithTestKey(mSenders[i], senderId, kUndefinedNodeId, receiverId,
+                                                                   kUndefinedFabricIndex, peer,
+                                                                   CryptoContext::SessionRole::kInitiator),
+                      CHIP_NO_ERROR);
+            ASSERT_EQ(mSessionManager.InjectPaseSessionWithTestKey(mReceivers[i], receiverId, kUndefinedNodeId, senderId,
+                                                                   kUndefinedFabricIndex, peer,
+                                                                   CryptoContext::SessionRole::kResponder),
+                      CHIP_NO_ERROR);
+        }
+    }
+
+    // Encrypts `perSession` messages on every sender, interleaving the sessions.
+    std::vector<System::PacketBufferHandle> PrepareMessages(size_t perSession, const uint8_t * payload, size_t length)
+    {
+        std::vector<System::PacketBufferHandle> messages;
+        for (size_t i = 0; i < perSession; i++)
+        {
+            for (auto & sender : mSenders)
+            {
+                PayloadHeader payloadHeader;
+                payloadHeader.SetMessageType(Protocols::Echo::MsgType::EchoRequest);
+
+                EncryptedPacketBufferHandle prepared;
+                EXPECT_EQ(mSessionManager.PrepareMessage(sender.Get().Value(), payloadHeader,
+                                                         MessagePacketBuffer::NewWithData(payload, length), prepared),
+                          CHIP_NO_ERROR);
+                messages.push_back(prepared.CastToWritable());
+            }
+        }
+        return messages;
+    }
+
+    void Receive(std::vector<System::PacketBufferHandle> & messages)
+    {
+        Inet::IPAddress addr;
+        Inet::IPAddress::FromString("::1", addr);
+        for (auto & message : messages)
+        {
+            mSessionManager.OnMessageReceived(PeerAddress::UDP(addr, CHIP_PORT), std::move(message));
+        }
+    }
+
+    TestContext mContext;
+    FabricTableHolder mFabricTableHolder;
+    secure_channel::MessageCounterManager mMessageCounterManager;
+    TestPersistentStorageDelegate mDeviceStorage;
+    Crypto::DefaultSessionKeystore mSessionKeystore;
+    SessionManager mSessionManager;
+    ReceivedMessageRecorder mRecorder;
+    SessionCryptoWorkerPool mPool;
+    std::vector<SessionHolder> mSenders;
+    std::vector<SessionHolder> mReceivers;
+};
+
+TEST_F(TestSessionCryptoWorkerPool, JobsOfAKeyCompleteInOrder)
+{
+    ASSERT_EQ(mPool.Init(SystemLayer(), 3), CHIP_NO_ERROR);
+
+    constexpr uint32_t kKeys = 5;
+    RecordingJob jobs[40];
+    std::vector<uint32_t> completionOrder;
+    for (uint32_t i = 0; i < MATTER_ARRAY_SIZE(jobs); i++)
+    {
+        jobs[i].matterThread    = std::this_thread::get_id();
+        jobs[i].completionOrder = &completionOrder;
+        jobs[i].id              = i;
+        mPool.Submit(jobs[i], i % kKeys);
+    }
+    EXPECT_EQ(mPool.GetPendingJobCount(), MATTER_ARRAY_SIZE(jobs));
+
+    // Completions are delivered by the event loop
+    mContext.GetIOContext().DriveIOUntil(System::Clock::Seconds16(5),
+                                         [&] { return completionOrder.size() == MATTER_ARRAY_SIZE(jobs); });
+    ASSERT_EQ(completionOrder.size(), MATTER_ARRAY_SIZE(jobs));
+    EXPECT_EQ(mPool.GetPendingJobCount(), 0u);
+
+    std::vector<uint32_t> lastOfKey(kKeys, UINT32_MAX);
+    for (uint32_t id : completionOrder)
+    {
+        uint32_t & last = lastOfKey[id % kKeys];
+        EXPECT_TRUE(last == UINT32_MAX || last < id);
+        last = id;
+    }
+    for (auto & job : jobs)
+    {
+        EXPECT_TRUE(job.ranOffMatterThread);
+        EXPECT_TRUE(job.completedOnMatterThread);
+    }
+}
+
+TEST_F(TestSessionCryptoWorkerPool, ShutdownCompletesPendingJobs)
+{
+    ASSERT_EQ(mPool.Init(SystemLayer(), 2), CHIP_NO_ERROR);
+    EXPECT_EQ(mPool.Init(SystemLayer(), 2), CHIP_ERROR_INCORRECT_STATE);
+
+    RecordingJob jobs[10];
+    std::vector<uint32_t> completionOrder;
+    for (uint32_t i = 0; i < MATTER_ARRAY_SIZE(jobs); i++)
+    {
+        jobs[i].matterThread    = std::this_thread::get_id();
+        jobs[i].completionOrder = &completionOrder;
+        jobs[i].id              = i;
+        mPool.Submit(jobs[i], 7);
+    }
+
+    mPool.Shutdown();
+    EXPECT_FALSE(mPool.IsInitialized());
+    ASSERT_EQ(completionOrder.size(), MATTER_ARRAY_SIZE(jobs));
+    for (uint32_t i = 0; i < MATTER_ARRAY_SIZE(jobs); i++)
+    {
+        EXPECT_EQ(completionOrder[i], i);
+    }
+
+    EXPECT_EQ(mPool.Init(SystemLayer(), 0), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(mPool.Init(SystemLayer(), SessionCryptoWorkerPool::kMaxThreads + 1), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(TestSessionCryptoWorkerPool, SessionManagerDispatchesDecryptedMessagesInOrder)
+{
+    static const uint8_t kPayload[]  = "Hello from a worker thread!";
+    mRecorder.mExpectedPayload       = kPayload;
+    mRecorder.mExpectedPayloadLength = sizeof(kPayload);
+
+    ASSERT_EQ(mPool.Init(SystemLayer(), 4), CHIP_NO_ERROR);
+    mSessionManager.SetCryptoWorkerPool(&mPool);
+    CreateSessionPairs(6);
+
+    constexpr size_t kPerSession = CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES / 6;
+    auto messages                = PrepareMessages(kPerSession, kPayload, sizeof(kPayload));
+
+    // A message that does not authenticate is dropped after decryption, without affecting the others.
+    System::PacketBufferHandle & tampered = messages[messages.size() / 2];
+    tampered->Start()[tampered->DataLength() - 1] ^= 0x01;
+
+    // Messages are dispatched by the event loop, not while receiving.
+    Receive(messages);
+    EXPECT_EQ(mRecorder.mReceived, 0u);
+
+    mContext.GetIOContext().DriveIOUntil(System::Clock::Seconds16(5), [&] { return mRecorder.mReceived == messages.size() - 1; });
+    EXPECT_EQ(mRecorder.mReceived, messages.size() - 1);
+    EXPECT_EQ(mRecorder.mLastCounters.size(), mReceivers.size());
+    EXPECT_EQ(mPool.GetPendingJobCount(), 0u);
+
+    // Going back to decrypting on the Matter thread
+    mSessionManager.SetCryptoWorkerPool(nullptr);
+    mRecorder.mReceived = 0;
+    messages            = PrepareMessages(1, kPayload, sizeof(kPayload));
+    Receive(messages);
+    EXPECT_EQ(mRecorder.mReceived, messages.size());
+}
+
+TEST_F(TestSessionCryptoWorkerPool, SessionManagerDropsMessagesBeyondPendingLimit)
+{
+    static const uint8_t kPayload[] = "Too many";
+    constexpr size_t kPending       = CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES;
+    constexpr size_t kDropped       = 5;
+
+    ASSERT_EQ(mPool.Init(SystemLayer(), 2), CHIP_NO_ERROR);
+    mSessionManager.SetCryptoWorkerPool(&mPool);
+    CreateSessionPairs(1);
+
+    auto messages = PrepareMessages(kPending + kDropped, kPayload, sizeof(kPayload));
+    std::vector<System::PacketBufferHandle> retransmissions;
+    for (size_t i = kPending; i < messages.size(); i++)
+    {
+        retransmissions.push_back(messages[i].CloneData());
+    }
+
+    // The messages beyond the limit are dropped, rather than waiting for queued ones to be dispatched while receiving.
+    Receive(messages);
+    EXPECT_EQ(mRecorder.mReceived, 0u);
+    EXPECT_EQ(mPool.GetPendingJobCount(), kPending);
+
+    mContext.GetIOContext().DriveIOUntil(System::Clock::Seconds16(5), [&] { return mRecorder.mReceived == kPending; });
+    EXPECT_EQ(mRecorder.mReceived, kPending);
+
+    // Their counters were not committed, so that their retransmissions are accepted.
+    Receive(retransmissions);
+    mContext.GetIOContext().DriveIOUntil(System::Clock::Seconds16(5), [&] { return mRecorder.mReceived == kPending + kDropped; });
+    EXPECT_EQ(mRecorder.mReceived, kPending + kDropped);
+}
+
+TEST_F(TestSessionCryptoWorkerPool, SessionManagerDropsMessagesPendingAtShutdown)
+{
+    static const uint8_t kPayload[] = "Late";
+
+    ASSERT_EQ(mPool.Init(SystemLayer(), 2), CHIP_NO_ERROR);
+    mSessionManager.SetCryptoWorkerPool(&mPool);
+    CreateSessionPairs(2);
+
+    auto messages = PrepareMessages(4, kPayload, sizeof(kPayload));
+    Receive(messages);
+
+    mSenders.clear();
+    mReceivers.clear();
+    mSessionManager.Shutdown();
+    EXPECT_EQ(mPool.GetPendingJobCount(), 0u);
+    EXPECT_EQ(mRecorder.mReceived, 0u);
+}
+
+//
+// Benchmark: receive throughput of secure unicast messages of independent sessions, decrypted on the
+// Matter thread and on pools of increasing size.
+//
+TEST_F(TestSessionCryptoWorkerPool, BenchmarkReceiveThroughput)
+{
+    constexpr size_t kSessions    = 8;
+    constexpr size_t kPerSession  = 250;
+    constexpr size_t kPayloadSize = 1024;
+    static uint8_t payload[kPayloadSize];
+    std::fill(std::begin(payload), std::end(payload), static_cast<uint8_t>(0x5a));
+
+    CreateSessionPairs(kSessions);
+
+    Inet::IPAddress addr;
+    Inet::IPAddress::FromString("::1", addr);
+    const PeerAddress peer = PeerAddress::UDP(addr, CHIP_PORT);
+
+    const size_t hardwareThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    for (size_t threads : { size_t(0), size_t(1), size_t(2), size_t(4), size_t(8) })
+    {
+        if (threads > std::min(hardwareThreads, SessionCryptoWorkerPool::kMaxThreads))
+        {
+            continue;
+        }
+        if (threads > 0)
+        {
+            ASSERT_EQ(mPool.Init(SystemLayer(), threads), CHIP_NO_ERROR);
+            mSessionManager.SetCryptoWorkerPool(&mPool);
+        }
+
+        auto messages       = PrepareMessages(kPerSession, payload, sizeof(payload));
+        mRecorder.mReceived = 0;
+
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (auto & message : messages)
+        {
+            // Dispatch completed messages between receptions, as the event loop would, so that none is dropped.
+            if (threads > 0 && mPool.GetPendingJobCount() >= CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD_MAX_PENDING_MESSAGES)
+            {
+                mPool.WaitForCompletedJobs();
+            }
+            mSessionManager.OnMessageReceived(peer, std::move(message));
+        }
+        if (threads > 0)
+        {
+            mPool.WaitForAllJobs();
+        }
+        System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        EXPECT_EQ(mRecorder.mReceived, messages.size());
+
+        ChipLogProgress(SecureChannel, "%u-byte messages of %u sessions, %u worker threads: %u messages/s",
+                        static_cast<unsigned>(kPayloadSize), static_cast<unsigned>(kSessions), static_cast<unsigned>(threads),
+                        static_cast<unsigned>(messages.size() * 1000000 / std::max<uint64_t>(elapsed.count(), 1)));
+
+        mSessionManager.SetCryptoWorkerPool(nullptr);
+        mPool.Shutdown();
+    }
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_SESSION_CRYPTO_OFFLOAD && CHIP_SYSTEM_CONFIG_USE_SOCKETS && !CHIP_SYSTEM_CONFIG_USE_DISPATCH && ...